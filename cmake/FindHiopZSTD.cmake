@@ -0,0 +1,44 @@
+#[[
+
+Exports target `ZSTD`
+
+Users may set the following variables:
+
+- HIOP_ZSTD_DIR
+
+]]
+
+find_library(ZSTD_LIBRARY
+  NAMES
+  zstd
+  PATHS
+  ${ZSTD_DIR} $ENV{ZSTD_DIR} ${HIOP_ZSTD_DIR}
+  ENV LD_LIBRARY_PATH ENV DYLD_LIBRARY_PATH
+  PATH_SUFFIXES
+  lib64 lib)
+
+if(ZSTD_LIBRARY)
+  get_filename_component(ZSTD_LIBRARY_DIR ${ZSTD_LIBRARY} DIRECTORY)
+endif()
+
+find_path(ZSTD_INCLUDE_DIR
+  NAMES
+  zstd.h
+  PATHS
+  ${ZSTD_DIR} $ENV{ZSTD_DIR} ${HIOP_ZSTD_DIR} ${ZSTD_LIBRARY_DIR}/..
+  PATH_SUFFIXES
+  include)
+
+if(ZSTD_LIBRARY AND ZSTD_INCLUDE_DIR)
+  message(STATUS "Found zstd include: ${ZSTD_INCLUDE_DIR}")
+  message(STATUS "Found zstd library: ${ZSTD_LIBRARY}")
+  add_library(ZSTD INTERFACE)
+  target_link_libraries(ZSTD INTERFACE ${ZSTD_LIBRARY})
+  target_include_directories(ZSTD INTERFACE ${ZSTD_INCLUDE_DIR})
+  install(TARGETS ZSTD EXPORT hiop-targets)
+else()
+  message(STATUS "zstd was not found.")
+endif()
+
+set(ZSTD_INCLUDE_DIR CACHE PATH "Path to zstd.h")
+set(ZSTD_LIBRARY CACHE PATH "Path to zstd library")
@@ -0,0 +1,677 @@
+#include "hiopNlpFormulation.hpp"
+#include "hiopInterface.hpp"
+#include "hiopLinSolver.hpp"
+#include "hiopLinSolverSymDenseLapack.hpp"
+#include "hiopLinSolverSymDenseLDLT.hpp"
+#include "hiopVectorPar.hpp"
+#include "hiopMatrixDenseRowMajor.hpp"
+#include "hiopTimer.hpp"
+#include "hiopKKTDump.hpp"
+
+#ifdef HIOP_USE_COINHSL
+#include "hiopLinSolverSymSparseMA57.hpp"
+#endif
+#ifdef HIOP_USE_PARDISO
+#include "hiopLinSolverSparsePARDISO.hpp"
+#endif
+#ifdef HIOP_USE_STRUMPACK
+#include "hiopLinSolverSparseSTRUMPACK.hpp"
+#endif
+#ifdef HIOP_USE_GINKGO
+#include "hiopLinSolverSparseGinkgo.hpp"
+#endif
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace hiop;
+
+/**
+ * Linear system loaded from a .iajaaa file (see src/LinAlg/csr_iajaaa.md) or from a binary .hkkt file written
+ * with the option `write_kkt_format binary` (see hiopKKTDump.hpp). The matrix is kept as its strictly
+ * lower triangular part, sorted by rows and columns, and its diagonal, which is the layout of the KKT triplet
+ * matrices passed by HiOp to the sparse linear solvers. The dumps of the sparse KKT systems store the lower
+ * triangle and the dumps of the MDS and dense KKT systems store the upper triangle; both are accepted.
+ */
+struct KKTDump
+{
+  int n;
+  int nx;
+  int meq;
+  int mineq;
+  int nnz_file;
+  std::vector<int> irow;
+  std::vector<int> jcol;
+  std::vector<double> vals;
+  std::vector<double> diag;
+  std::vector<std::vector<double>> rhs;
+  std::vector<std::vector<double>> sol;
+
+  bool load(const std::string& fname)
+  {
+    FILE* f = fopen(fname.c_str(), "r");
+    if(NULL == f) {
+      printf("could not open '%s'\n", fname.c_str());
+      return false;
+    }
+    bool ok = (5 == fscanf(f, "%d %d %d %d %d", &n, &nx, &meq, &mineq, &nnz_file)) && n > 0 && nnz_file >= 0;
+    std::vector<int> row_ptr(ok ? n + 1 : 0);
+    std::vector<int> col(ok ? nnz_file : 0);
+    std::vector<double> val(ok ? nnz_file : 0);
+    for(int i = 0; ok && i <= n; i++) {
+      ok = (1 == fscanf(f, "%d", &row_ptr[i]));
+    }
+    for(int k = 0; ok && k < nnz_file; k++) {
+      ok = (1 == fscanf(f, "%d", &col[k]));
+    }
+    for(int k = 0; ok && k < nnz_file; k++) {
+      ok = (1 == fscanf(f, "%lf", &val[k]));
+    }
+    ok = ok && row_ptr[0] == 1 && row_ptr[n] == nnz_file + 1;
+    if(!ok) {
+      printf("malformed matrix in '%s'\n", fname.c_str());
+      fclose(f);
+      return false;
+    }
+
+    // rhs-solution pairs until the end of the file; an incomplete pair (e.g., failed solve) is dropped
+    rhs.clear();
+    sol.clear();
+    while(true) {
+      std::vector<double> r(n), s(n);
+      bool pair_ok = true;
+      for(int i = 0; pair_ok && i < n; i++) {
+        pair_ok = (1 == fscanf(f, "%lf", &r[i]));
+      }
+      for(int i = 0; pair_ok && i < n; i++) {
+        pair_ok = (1 == fscanf(f, "%lf", &s[i]));
+      }
+      if(!pair_ok) {
+        break;
+      }
+      rhs.push_back(r);
+      sol.push_back(s);
+    }
+    fclose(f);
+
+    if(!set_csr(row_ptr.data(), col.data(), val.data(), 1, false)) {
+      printf("column index out of range in '%s'\n", fname.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  bool load(const hiopKKTDumpSystem& sys)
+  {
+    n = static_cast<int>(sys.n);
+    nx = static_cast<int>(sys.nx);
+    meq = static_cast<int>(sys.meq);
+    mineq = static_cast<int>(sys.mineq);
+    nnz_file = static_cast<int>(sys.vals.size());
+    // a right-hand side without solution (failed solve) is dropped
+    const size_t num_pairs = std::min(sys.rhs.size(), sys.sol.size());
+    rhs.assign(sys.rhs.begin(), sys.rhs.begin() + num_pairs);
+    sol.assign(sys.sol.begin(), sys.sol.begin() + num_pairs);
+    if(!set_csr(sys.row_ptr.data(), sys.col.data(), sys.vals.data(), 0, 'F' == sys.triangle)) {
+      printf("column index out of range\n");
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Sets the diagonal and the strict lower triangle from the CSR arrays with indexes starting at `base`, which
+   * contain one triangle of the matrix, or both if `lower_only`, in which case the upper entries are skipped.
+   */
+  template<typename T>
+  bool set_csr(const T* row_ptr, const T* col, const double* val, int base, bool lower_only)
+  {
+    // counting sort by row
+    diag.assign(n, 0.);
+    std::vector<int> cnt(n + 1, 0);
+    for(int i = 0; i < n; i++) {
+      for(T k = row_ptr[i] - base; k < row_ptr[i + 1] - base; k++) {
+        const int j = static_cast<int>(col[k] - base);
+        if(j < 0 || j >= n) {
+          return false;
+        }
+        if(i != j && !(lower_only && j > i)) {
+          cnt[std::max(i, j) + 1]++;
+        }
+      }
+    }
+    for(int i = 0; i < n; i++) {
+      cnt[i + 1] += cnt[i];
+    }
+    irow.resize(cnt[n]);
+    jcol.resize(cnt[n]);
+    vals.resize(cnt[n]);
+    for(int i = 0; i < n; i++) {
+      for(T k = row_ptr[i] - base; k < row_ptr[i + 1] - base; k++) {
+        const int j = static_cast<int>(col[k] - base);
+        if(i == j) {
+          diag[i] += val[k];
+        } else if(!(lower_only && j > i)) {
+          const int pos = cnt[std::max(i, j)]++;
+          irow[pos] = std::max(i, j);
+          jcol[pos] = std::min(i, j);
+          vals[pos] = val[k];
+        }
+      }
+    }
+    // columns within a row are sorted for upper triangle matrices, which are transposed above, and also for lower
+    // triangle matrices, since the CSR arrays written by HiOp are ordered
+    return true;
+  }
+
+  inline int nnz_lower() const { return static_cast<int>(vals.size()) + n; }
+
+  /// y = A*x, where A is the full symmetric matrix
+  void times_vec(const double* x, double* y) const
+  {
+    for(int i = 0; i < n; i++) {
+      y[i] = diag[i] * x[i];
+    }
+    for(size_t k = 0; k < vals.size(); k++) {
+      y[irow[k]] += vals[k] * x[jcol[k]];
+      y[jcol[k]] += vals[k] * x[irow[k]];
+    }
+  }
+
+  double max_abs_value() const
+  {
+    double amax = 0.;
+    for(double d : diag) {
+      amax = std::max(amax, std::fabs(d));
+    }
+    for(double v : vals) {
+      amax = std::max(amax, std::fabs(v));
+    }
+    return amax;
+  }
+};
+
+/**
+ * Placeholder NLP, only used to provide the options, logger, and run statistics needed by the linear solvers.
+ */
+class ReplayNlp : public hiopInterfaceDenseConstraints
+{
+public:
+  bool get_prob_sizes(size_type& n, size_type& m)
+  {
+    n = 1;
+    m = 0;
+    return true;
+  }
+  bool get_vars_info(const size_type&, double* xlow, double* xupp, NonlinearityType* type)
+  {
+    xlow[0] = -1e20;
+    xupp[0] = 1e20;
+    type[0] = hiopNonlinear;
+    return true;
+  }
+  bool get_cons_info(const size_type&, double*, double*, NonlinearityType*) { return true; }
+  bool eval_f(const size_type&, const double*, bool, double& obj_value)
+  {
+    obj_value = 0.;
+    return true;
+  }
+  bool eval_grad_f(const size_type&, const double*, bool, double* gradf)
+  {
+    gradf[0] = 0.;
+    return true;
+  }
+  bool eval_cons(const size_type&, const size_type&, const size_type&, const index_type*, const double*, bool, double*)
+  {
+    return true;
+  }
+  bool eval_Jac_cons(const size_type&, const size_type&, const size_type&, const index_type*, const double*, bool, double*)
+  {
+    return true;
+  }
+#ifdef HIOP_USE_MPI
+  bool get_MPI_comm(MPI_Comm& comm_out)
+  {
+    comm_out = MPI_COMM_SELF;
+    return true;
+  }
+#endif
+};
+
+/// Names of the solvers compiled in this build, dense first
+static std::vector<std::string> available_solvers()
+{
+  std::vector<std::string> names = {"lapack", "ldlt"};
+#ifdef HIOP_USE_COINHSL
+  names.push_back("ma57");
+#endif
+#ifdef HIOP_USE_PARDISO
+  names.push_back("pardiso");
+#endif
+#ifdef HIOP_USE_STRUMPACK
+  names.push_back("strumpack");
+#endif
+#ifdef HIOP_USE_GINKGO
+  names.push_back("ginkgo");
+#endif
+  return names;
+}
+
+static inline bool is_dense_solver(const std::string& name) { return name == "lapack" || name == "ldlt"; }
+
+/// Solvers offering `solve(hiopMatrix&)` for multiple right-hand sides
+static inline bool has_block_solve(const std::string& name) { return name != "lapack"; }
+
+static hiopLinSolver* create_solver(const std::string& name, const KKTDump& kkt, hiopNlpFormulation* nlp)
+{
+  if(name == "lapack") {
+    return new hiopLinSolverSymDenseLapack(kkt.n, nlp);
+  }
+  if(name == "ldlt") {
+    return new hiopLinSolverSymDenseLDLT(kkt.n, nlp);
+  }
+#ifdef HIOP_USE_COINHSL
+  if(name == "ma57") {
+    return new hiopLinSolverSymSparseMA57(kkt.n, kkt.nnz_lower(), nlp);
+  }
+#endif
+#ifdef HIOP_USE_PARDISO
+  if(name == "pardiso") {
+    return new hiopLinSolverSymSparsePARDISO(kkt.n, kkt.nnz_lower(), nlp);
+  }
+#endif
+#ifdef HIOP_USE_STRUMPACK
+  if(name == "strumpack") {
+    return new hiopLinSolverSymSparseSTRUMPACK(kkt.n, kkt.nnz_lower(), nlp);
+  }
+#endif
+#ifdef HIOP_USE_GINKGO
+  if(name == "ginkgo") {
+    return new hiopLinSolverSymSparseGinkgo(kkt.n, kkt.nnz_lower(), nlp);
+  }
+#endif
+  return nullptr;
+}
+
+/**
+ * Copies the system matrix into the solver: both triangles of the dense matrix for the dense solvers, and the lower
+ * triangle triplets with the diagonal entries at the end, as assembled by the sparse KKT classes, for the sparse
+ * solvers.
+ */
+static void set_matrix(hiopLinSolver* solver, const KKTDump& kkt)
+{
+  hiopLinSolverSymDense* dense = dynamic_cast<hiopLinSolverSymDense*>(solver);
+  if(dense) {
+    const int n = kkt.n;
+    double* M = dense->sysMatrix().local_data();
+    std::fill(M, M + static_cast<size_t>(n) * n, 0.);
+    for(int i = 0; i < n; i++) {
+      M[static_cast<size_t>(i) * n + i] = kkt.diag[i];
+    }
+    for(size_t k = 0; k < kkt.vals.size(); k++) {
+      M[static_cast<size_t>(kkt.irow[k]) * n + kkt.jcol[k]] = kkt.vals[k];
+      M[static_cast<size_t>(kkt.jcol[k]) * n + kkt.irow[k]] = kkt.vals[k];
+    }
+    return;
+  }
+  hiopLinSolverSymSparse* sparse = dynamic_cast<hiopLinSolverSymSparse*>(solver);
+  assert(sparse);
+  hiopMatrixSparse* M = sparse->sys_matrix();
+  assert(M->numberOfNonzeros() == kkt.nnz_lower());
+  const int nnz_offdiag = static_cast<int>(kkt.vals.size());
+  std::copy(kkt.irow.begin(), kkt.irow.end(), M->i_row());
+  std::copy(kkt.jcol.begin(), kkt.jcol.end(), M->j_col());
+  std::copy(kkt.vals.begin(), kkt.vals.end(), M->M());
+  for(int i = 0; i < kkt.n; i++) {
+    M->i_row()[nnz_offdiag + i] = M->j_col()[nnz_offdiag + i] = i;
+    M->M()[nnz_offdiag + i] = kkt.diag[i];
+  }
+}
+
+/// Resident memory of the process in MB, or a negative value if not available
+static double resident_memory_mb()
+{
+  FILE* f = fopen("/proc/self/statm", "r");
+  if(NULL == f) {
+    return -1.;
+  }
+  long size, resident;
+  const int nread = fscanf(f, "%ld %ld", &size, &resident);
+  fclose(f);
+  if(2 != nread) {
+    return -1.;
+  }
+  return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1024. * 1024.);
+}
+
+static inline bool has_extension(const std::string& name, const std::string& ext)
+{
+  return name.size() > ext.size() && name.compare(name.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+/// Appends the .iajaaa and .hkkt files in `path` (sorted by name) or `path` itself if it is not a directory
+static void collect_dumps(const std::string& path, std::vector<std::string>& files)
+{
+  DIR* dir = opendir(path.c_str());
+  if(NULL == dir) {
+    files.push_back(path);
+    return;
+  }
+  std::vector<std::string> found;
+  for(struct dirent* entry = readdir(dir); entry != NULL; entry = readdir(dir)) {
+    const std::string name = entry->d_name;
+    if(has_extension(name, ".iajaaa") || has_extension(name, ".hkkt")) {
+      found.push_back(path + "/" + name);
+    }
+  }
+  closedir(dir);
+  // kkt_linsys_2 before kkt_linsys_10
+  std::sort(found.begin(), found.end(), [](const std::string& a, const std::string& b) {
+    return a.size() != b.size() ? a.size() < b.size() : a < b;
+  });
+  files.insert(files.end(), found.begin(), found.end());
+}
+
+static void usage(const char* exeName)
+{
+  printf(
+      "KKT replay benchmark %s: loads linear systems saved by HiOp with the option 'write_kkt yes' (.iajaaa "
+      "files, or .hkkt files with 'write_kkt_format binary') and replays the factorization and the solves with "
+      "each linear solver available in this build, reporting the factorization and solve times, the number of "
+      "negative eigenvalues, the relative residual, and the increase of the resident memory. Options of the "
+      "linear solvers are read from hiop.options.\n",
+      exeName);
+  printf("Usage: \n");
+  printf("  '$ %s [-solvers name1,name2,...] [-reps k] [-nrhs k] [-dense_max n] [-selfcheck] path1 [path2 ...]'\n",
+         exeName);
+  printf("Arguments:\n");
+  printf("  'path': .iajaaa or .hkkt file, or directory containing such files.\n");
+  printf("  '-solvers': comma-separated list of solvers [optional, default all available:");
+  for(const std::string& name : available_solvers()) {
+    printf(" %s", name.c_str());
+  }
+  printf("].\n");
+  printf("  '-reps': number of factorizations of each matrix; the average time is reported [optional, default 1].\n");
+  printf(
+      "  '-nrhs': also solves a block of k right-hand sides (the saved ones, repeated) with one multiple "
+      "right-hand sides solve, and reports its time per right-hand side [optional, default 0: no block solve].\n");
+  printf("  '-dense_max': largest size of the systems replayed with the dense solvers [optional, default 5000].\n");
+  printf(
+      "  '-selfcheck': fails if a relative residual is larger than 1e-8, the solvers do not agree on the "
+      "number of negative eigenvalues, or the block solutions differ from the single solutions [optional].\n");
+}
+
+static bool parse_arguments(int argc,
+                            char** argv,
+                            std::vector<std::string>& solvers,
+                            int& reps,
+                            int& nrhs,
+                            int& dense_max,
+                            bool& self_check,
+                            std::vector<std::string>& files)
+{
+  const std::vector<std::string> available = available_solvers();
+  solvers = available;
+  reps = 1;
+  nrhs = 0;
+  dense_max = 5000;
+  self_check = false;
+  for(int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if(arg == "-selfcheck") {
+      self_check = true;
+    } else if(arg == "-reps" && i + 1 < argc) {
+      reps = std::max(1, atoi(argv[++i]));
+    } else if(arg == "-nrhs" && i + 1 < argc) {
+      nrhs = std::max(0, atoi(argv[++i]));
+    } else if(arg == "-dense_max" && i + 1 < argc) {
+      dense_max = atoi(argv[++i]);
+    } else if(arg == "-solvers" && i + 1 < argc) {
+      solvers.clear();
+      std::string list = argv[++i];
+      size_t pos = 0;
+      while(pos <= list.size()) {
+        const size_t comma = std::min(list.find(',', pos), list.size());
+        const std::string name = list.substr(pos, comma - pos);
+        if(std::find(available.begin(), available.end(), name) == available.end()) {
+          printf("solver '%s' is not available in this build\n", name.c_str());
+          return false;
+        }
+        solvers.push_back(name);
+        pos = comma + 1;
+      }
+    } else if(arg[0] == '-') {
+      return false;
+    } else {
+      collect_dumps(arg, files);
+    }
+  }
+  return !files.empty();
+}
+
+/**
+ * Factorizes `kkt` `reps` times and solves with the saved right-hand sides using each solver in `solvers`, and prints
+ * one line per solver. With `nrhs` positive, also solves a block of `nrhs` right-hand sides (the saved ones,
+ * repeated) with one multiple right-hand sides solve. Returns the number of selfcheck failures.
+ */
+static int replay(const KKTDump& kkt,
+                  const std::string& label,
+                  const std::vector<std::string>& solvers,
+                  int reps,
+                  int nrhs,
+                  int dense_max,
+                  bool self_check,
+                  hiopNlpFormulation& nlp)
+{
+  int fail = 0;
+  printf("\n%s: n=%d nnz=%d (nx=%d meq=%d mineq=%d), %lu right-hand side(s)\n",
+         label.c_str(),
+         kkt.n,
+         kkt.nnz_file,
+         kkt.nx,
+         kkt.meq,
+         kkt.mineq,
+         kkt.rhs.size());
+  printf("  %-10s %12s %12s %12s %8s %12s %12s %10s\n",
+         "solver",
+         "fact (s)",
+         "solve (s)",
+         "block (s)",
+         "neg eig",
+         "rel resid",
+         "sol diff",
+         "mem (MB)");
+
+  int neg_ref = -2;
+  for(const std::string& name : solvers) {
+    if(is_dense_solver(name) && kkt.n > dense_max) {
+      printf("  %-10s skipped (n > dense_max=%d)\n", name.c_str(), dense_max);
+      continue;
+    }
+    const double mem0 = resident_memory_mb();
+    hiopLinSolver* solver = create_solver(name, kkt, &nlp);
+    assert(solver);
+
+    // the matrix is copied before each factorization since the solvers may factorize in place
+    hiopStopwatch tm_fact, tm_solve;
+    int num_neg = -2;
+    for(int r = 0; r < reps; r++) {
+      set_matrix(solver, kkt);
+      tm_fact.start();
+      num_neg = solver->matrixChanged();
+      tm_fact.stop();
+    }
+    const double mem1 = resident_memory_mb();
+
+    // relative residual ||b-Ax||/(||A|| ||x|| + ||b||) and relative difference to the saved solution
+    double max_resid = 0., max_sol_diff = 0.;
+    bool solve_ok = true;
+    hiopVectorPar x(kkt.n);
+    std::vector<double> Ax(kkt.n);
+    std::vector<std::vector<double>> x_single(kkt.rhs.size());
+    const double amax = kkt.max_abs_value();
+    for(size_t r = 0; r < kkt.rhs.size(); r++) {
+      x.copyFrom(kkt.rhs[r].data());
+      tm_solve.start();
+      solve_ok = solver->solve(x) && solve_ok;
+      tm_solve.stop();
+
+      const double* xv = x.local_data_const();
+      x_single[r].assign(xv, xv + kkt.n);
+      kkt.times_vec(xv, Ax.data());
+      double rnorm = 0., bnorm = 0., xnorm = 0., dnorm = 0., snorm = 0.;
+      for(int i = 0; i < kkt.n; i++) {
+        rnorm = std::max(rnorm, std::fabs(kkt.rhs[r][i] - Ax[i]));
+        bnorm = std::max(bnorm, std::fabs(kkt.rhs[r][i]));
+        xnorm = std::max(xnorm, std::fabs(xv[i]));
+        dnorm = std::max(dnorm, std::fabs(xv[i] - kkt.sol[r][i]));
+        snorm = std::max(snorm, std::fabs(kkt.sol[r][i]));
+      }
+      const double resid = rnorm / (amax * xnorm + bnorm + 1e-300);
+      // NaN/Inf propagate to the report
+      max_resid = std::isfinite(resid) ? std::max(max_resid, resid) : resid;
+      max_sol_diff = std::max(max_sol_diff, dnorm / std::max(1., snorm));
+    }
+
+    // block solve, compared with the single solves of the same right-hand sides
+    double tm_block = -1., max_block_diff = 0.;
+    if(nrhs > 0 && !kkt.rhs.empty() && has_block_solve(name)) {
+      hiopMatrixDenseRowMajor X(nrhs, kkt.n);
+      double* dX = X.local_data();
+      for(int r = 0; r < nrhs; r++) {
+        const std::vector<double>& b = kkt.rhs[r % kkt.rhs.size()];
+        std::copy(b.begin(), b.end(), dX + static_cast<size_t>(r) * kkt.n);
+      }
+      hiopStopwatch tm;
+      tm.start();
+      solve_ok = solver->solve(X) && solve_ok;
+      tm.stop();
+      tm_block = tm.getElapsedTime() / nrhs;
+      for(int r = 0; r < nrhs; r++) {
+        const std::vector<double>& xs = x_single[r % kkt.rhs.size()];
+        double dnorm = 0., snorm = 0.;
+        for(int i = 0; i < kkt.n; i++) {
+          dnorm = std::max(dnorm, std::fabs(dX[static_cast<size_t>(r) * kkt.n + i] - xs[i]));
+          snorm = std::max(snorm, std::fabs(xs[i]));
+        }
+        const double diff = dnorm / std::max(1., snorm);
+        max_block_diff = std::isfinite(diff) ? std::max(max_block_diff, diff) : diff;
+      }
+    }
+    delete solver;
+
+    char block_str[32] = "-";
+    if(tm_block >= 0.) {
+      snprintf(block_str, sizeof(block_str), "%.5e", tm_block);
+    }
+    printf("  %-10s %12.5e %12.5e %12s %8d %12.3e %12.3e %10.1f%s\n",
+           name.c_str(),
+           tm_fact.getElapsedTime() / reps,
+           kkt.rhs.empty() ? 0. : tm_solve.getElapsedTime() / kkt.rhs.size(),
+           block_str,
+           num_neg,
+           max_resid,
+           max_sol_diff,
+           mem0 >= 0 ? mem1 - mem0 : -1.,
+           solve_ok ? "" : " (solve failed)");
+
+    if(self_check) {
+      if(!solve_ok || !(max_resid <= 1e-8)) {
+        printf("  selfcheck: %s has relative residual %g\n", name.c_str(), max_resid);
+        fail++;
+      }
+      if(!(max_block_diff <= 1e-8)) {
+        printf("  selfcheck: the block solutions of %s differ by %g from the single solutions\n",
+               name.c_str(),
+               max_block_diff);
+        fail++;
+      }
+      if(neg_ref == -2) {
+        neg_ref = num_neg;
+      } else if(num_neg != neg_ref) {
+        printf("  selfcheck: %s reports %d negative eigenvalues instead of %d\n", name.c_str(), num_neg, neg_ref);
+        fail++;
+      }
+    }
+  }
+  return fail;
+}
+
+int main(int argc, char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+  std::vector<std::string> solvers, files;
+  int reps, nrhs, dense_max;
+  bool self_check;
+  if(!parse_arguments(argc, argv, solvers, reps, nrhs, dense_max, self_check, files)) {
+    usage(argv[0]);
+#ifdef HIOP_USE_MPI
+    MPI_Finalize();
+#endif
+    return 1;
+  }
+
+  int fail = 0;
+  int num_replayed = 0;
+  {
+    ReplayNlp nlp_interface;
+    // options of the linear solvers can be set in hiop.options
+    hiopNlpDenseConstraints nlp(nlp_interface);
+
+    for(const std::string& fname : files) {
+      if(has_extension(fname, ".hkkt")) {
+        hiopKKTDumpReader reader;
+        hiopKKTDumpSystem sys;
+        std::string error;
+        if(reader.open(fname, error)) {
+          while(reader.read_next(sys, error)) {
+            KKTDump kkt;
+            if(!kkt.load(sys)) {
+              fail++;
+              continue;
+            }
+            const std::string label = fname + " #" + std::to_string(sys.counter);
+            fail += replay(kkt, label, solvers, reps, nrhs, dense_max, self_check, nlp);
+            num_replayed++;
+          }
+        }
+        if(!error.empty()) {
+          printf("%s\n", error.c_str());
+          fail++;
+        }
+        continue;
+      }
+
+      KKTDump kkt;
+      if(!kkt.load(fname)) {
+        fail++;
+        continue;
+      }
+      fail += replay(kkt, fname, solvers, reps, nrhs, dense_max, self_check, nlp);
+      num_replayed++;
+    }
+  }
+
+  printf("\nreplayed %d linear system(s) from %lu file(s)\n", num_replayed, files.size());
+  if(self_check) {
+    if(fail || 0 == num_replayed) {
+      printf("KKT replay selfcheck failed: %d errors\n", fail);
+    } else {
+      printf("KKT replay selfcheck passed\n");
+    }
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return (fail || 0 == num_replayed) ? 1 : 0;
+}
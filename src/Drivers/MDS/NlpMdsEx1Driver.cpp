@@ -138,6 +138,8 @@ int main(int argc, char** argv)
   nlp.options->SetStringValue("compute_mode", "hybrid");
 
   nlp.options->SetIntegerValue("verbosity_level", 3);
+  // keep the KKT linear system for the re-solve done by the self check
+  nlp.options->SetStringValue("keep_kkt", "yes");
   nlp.options->SetNumericValue("mu0", 1e-1);
   nlp.options->SetNumericValue("tolerance", 1e-5);
 
@@ -159,6 +161,19 @@ int main(int argc, char** argv)
       ret_code = 0;
     }
 
+    // re-solving the same NLP reuses the solver's objects (including the KKT linear system) and should
+    // reproduce the solve
+    const int num_iter = solver.getNumIterations();
+    status = solver.resolve();
+    if(status < 0 || fabs(solver.getObjective() - obj_value) > 1e-10 * fabs(obj_value) ||
+       solver.getNumIterations() != num_iter) {
+      printf("selfcheck: re-solve returned status %d, obj=%18.12e in %d iterations (%d iterations in the first solve)\n",
+             status,
+             solver.getObjective(),
+             solver.getNumIterations(),
+             num_iter);
+      ret_code = -1;
+    }
   } else {
     if(status < 0) {
       if(rank == 0) {
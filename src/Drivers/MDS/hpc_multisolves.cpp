@@ -1,4 +1,5 @@
 #include "NlpMdsEx1.hpp"
+#include "hiopBatchSolve.hpp"
 #include "hiopNlpFormulation.hpp"
 #include "hiopAlgFilterIPM.hpp"
 
@@ -10,12 +11,80 @@
 
 #include <thread>  // std::this_thread::sleep_for
 #include <chrono>  // std::chrono::seconds
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
 
 #include "hiopTimer.hpp"
 
 using namespace hiop;
 
+static bool parse_arguments(int argc,
+                            char** argv,
+                            bool& self_check,
+                            size_type& n_sp,
+                            size_type& n_de,
+                            int& num_probs_per_rank,
+                            int& num_workers)
+{
+  self_check = false;
+  n_de = 2000;
+  n_sp = 2 * n_de;
+  num_probs_per_rank = 5;
+  num_workers = 0;
+
+  if(argc > 1 && std::string(argv[argc - 1]) == "-selfcheck") {
+    self_check = true;
+    argc--;
+  }
+  switch(argc) {
+    case 1:
+      // no arguments
+      break;
+    case 5:  // 4 arguments
+    {
+      num_workers = atoi(argv[4]);
+      if(num_workers < 0) num_workers = 0;
+    }
+    case 4:  // 3 arguments
+    {
+      num_probs_per_rank = atoi(argv[3]);
+      if(num_probs_per_rank < 1) num_probs_per_rank = 1;
+    }
+    case 3:  // 2 arguments
+    {
+      n_sp = atoi(argv[1]);
+      if(n_sp < 0) n_sp = 0;
+      n_de = atoi(argv[2]);
+      if(n_de < 0) n_de = 0;
+    } break;
+    default:
+      return false;
+  }
+
+  return true;
+}
+
+static void usage(const char* exeName)
+{
+  printf("HiOp driver %s that solves, on each MPI rank, a batch of MDS Ex1 problems concurrently.\n", exeName);
+  printf("Usage: \n");
+  printf("  '$ %s sp_vars_size de_vars_size num_probs_per_rank num_workers -selfcheck'\n", exeName);
+  printf("Arguments, all integers, excepting string '-selfcheck'\n");
+  printf("  'sp_vars_size': # of sparse variables [default 4000, optional, needs de_vars_size]\n");
+  printf("  'de_vars_size': # of dense variables [default 2000, optional]\n");
+  printf("  'num_probs_per_rank': # of problems solved by each rank [default 5, optional]\n");
+  printf("  'num_workers': # of threads solving the problems of a rank; 0 for OpenMP default [default 0, optional]\n");
+  printf(
+      "  '-selfcheck': compares the optimal objectives with the one obtained by solving the first problem "
+      "separately. [optional]\n");
+}
+
 /** The driver performs multiple solves per MPI process using MDS Ex1
+ *
+ * The problems of a rank are solved concurrently by the threads of the rank using hiopBatchSolverMDS,
+ * which reuses the NLP formulation and solver objects of each thread.
  *
  * Intended to be used to test intra-node CPU cores affinity or GPU streams multiprocessing
  *
@@ -25,14 +94,16 @@ using namespace hiop;
 int main(int argc, char* argv[])
 {
   int ret;
-  ret = MPI_Init(&argc, &argv);
+  // the problems of a rank are solved on MPI_COMM_SELF from multiple threads
+  int provided;
+  ret = MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
   assert(ret == MPI_SUCCESS);
   if(MPI_SUCCESS != ret) {
     printf("MPI_Init failed\n");
     return -1;
   }
 
-  hiopTimer glob_timer, t;
+  hiopStopwatch glob_timer;
   glob_timer.start();
 
   int my_rank = 0, comm_size;
@@ -42,32 +113,58 @@ int main(int argc, char* argv[])
   ret = MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
   assert(ret == MPI_SUCCESS);
 
-  const int num_probs_per_rank = 5;
-  const int n_de = 2000;
-  const int n_sp = 2 * n_de;
+  bool self_check;
+  size_type n_sp, n_de;
+  int num_probs_per_rank, num_workers;
+  if(!parse_arguments(argc, argv, self_check, n_sp, n_de, num_probs_per_rank, num_workers)) {
+    if(0 == my_rank) {
+      usage(argv[0]);
+    }
+    MPI_Finalize();
+    return 1;
+  }
 
+  // user's NLPs -> implementation of hiop::hiopInterfaceMDS
+  std::vector<MdsEx1*> my_nlps;
+  std::vector<hiopInterfaceMDS*> probs;
   for(int i = 0; i < num_probs_per_rank; i++) {
-    t.start();
-    printf("[driver] Rank %d solves problem %d\n", my_rank, (i + 1));
-    fflush(stdout);
-
-    double obj_value = -1e+20;
-    [[maybe_unused]] hiopSolveStatus status;
+    my_nlps.push_back(new MdsEx1(n_sp, n_de));
+    probs.push_back(my_nlps.back());
+  }
 
-    // user's NLP -> implementation of hiop::hiopInterfaceMDS
-    MdsEx1* my_nlp = new MdsEx1(n_sp, n_de);
+  hiopBatchSolverMDS batch_solver(num_workers);
+  // only warnings and errors since the output of concurrent solves would be interleaved
+  batch_solver.set_integer_option("verbosity_level", 1);
+  batch_solver.solve(probs);
 
-    hiopNlpMDS nlp(*my_nlp);
+  // the reference objective is obtained by solving the first problem with its own NLP formulation and solver
+  double obj_ref = 0.;
+  if(self_check) {
+    hiopNlpMDS nlp(*my_nlps[0]);
+    nlp.options->SetIntegerValue("verbosity_level", 1);
     hiopAlgFilterIPMNewton solver(&nlp);
-    status = solver.run();
-    obj_value = solver.getObjective();
-
-    delete my_nlp;
+    solver.run();
+    obj_ref = solver.getObjective();
+  }
 
-    t.stop();
-    printf("[driver] Rank %d solved problem %d (obj=%12.5e) in %g sec\n", my_rank, (i + 1), obj_value, t.getElapsedTime());
-    fflush(stdout);
+  int n_fail = 0;
+  for(int i = 0; i < num_probs_per_rank; i++) {
+    const hiopBatchSolveResult& res = batch_solver.get_results()[i];
+    printf("[driver] Rank %d solved problem %d (status=%d, obj=%12.5e, iter=%d) in %g sec on worker %d\n",
+           my_rank,
+           (i + 1),
+           res.status,
+           res.objective,
+           res.num_iterations,
+           res.time,
+           res.worker);
+    if(self_check && (res.status < 0 || fabs(res.objective - obj_ref) > 1e-8 * (1. + fabs(obj_ref)))) {
+      printf("selfcheck: objective mismatch for problem %d of rank %d\n", (i + 1), my_rank);
+      n_fail++;
+    }
+    delete my_nlps[i];
   }
+  fflush(stdout);
 
   glob_timer.stop();
   double tmElapsed = glob_timer.getElapsedTime();
@@ -76,6 +173,7 @@ int main(int argc, char* argv[])
   std::this_thread::sleep_for(std::chrono::milliseconds((1 + my_rank) * 100));
 
   printf("[driver] Rank %d finished solves in %g seconds\n", my_rank, tmElapsed);
+  batch_solver.get_stats().print(stdout, "[driver] Batch statistics");
   fflush(stdout);
 
   double tmAvg, stdDevTm, aux;
@@ -90,14 +188,18 @@ int main(int argc, char* argv[])
     assert(ret == MPI_SUCCESS);
     stdDevTm = sqrt(stdDevTm);
   } else {
-    aux = 0.;
+    stdDevTm = 0.;
   }
   if(0 == my_rank) {
     printf("\n\nSummary: average time %g sec, std dev %.2f percent \n\n", tmAvg, 100 * stdDevTm / tmAvg);
   }
 
+  int n_fail_glob = n_fail;
+  ret = MPI_Allreduce(&n_fail, &n_fail_glob, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  assert(ret == MPI_SUCCESS);
+
   MPI_Finalize();
-  return 0;
+  return n_fail_glob > 0 ? 1 : 0;
 }
 
 /* -- BSUB submission file --
@@ -15,7 +15,7 @@ PriDecMasterProbleEx2::PriDecMasterProbleEx2(size_type nx, size_type ny, size_ty
       S_(S)
 {
   assert(nx == ny);
-  y_ = new double[ny_];
+  y_.resize(S_);
   sol_ = new double[nx_];
   obj_ = 1e20;
   basecase_ = new PriDecBasecaseProbleEx2(nx_);
@@ -24,7 +24,6 @@ PriDecMasterProbleEx2::PriDecMasterProbleEx2(size_type nx, size_type ny, size_ty
 
 PriDecMasterProbleEx2::~PriDecMasterProbleEx2()
 {
-  delete[] y_;
   delete[] sol_;
   delete basecase_;
 };
@@ -132,8 +131,20 @@ bool PriDecMasterProbleEx2::eval_f_rterm(size_type idx, const int& n, const doub
   }
   */
 
+  // the recourse solve is warm started from the solution of the previous outer iteration, when available
+  // (see PriDec option 'recourse_warm_start')
+  ex9_recourse->set_warm_start(&recourse_warm_start_, idx);
+  const bool warm_start = recourse_warm_start_.has(idx);
+
   hiopNlpMDS nlp(*ex9_recourse);
   nlp.options->SetStringValue("duals_update_type", "linear");
+  if(warm_start) {
+    nlp.options->SetStringValue("warm_start", "yes");
+  }
+  if(recourse_warm_start_.is_enabled()) {
+    // the duals of the slacks bounds are stored from iterate_full_callback
+    nlp.options->SetStringValue("iterate_full_callback", "yes");
+  }
   // nlp.options->SetStringValue("dualsInitialization", "zero");
   nlp.options->SetStringValue("Hessian", "analytical_exact");
 #ifdef HIOP_USE_GPU
@@ -152,10 +163,9 @@ bool PriDecMasterProbleEx2::eval_f_rterm(size_type idx, const int& n, const doub
   status = solver.run();
   assert(status <= hiopSolveStatus::User_Stopped);  // check solver status if necessary
   rval = solver.getObjective();
-  if(y_ == NULL) {
-    y_ = new double[ny_];
-  }
-  solver.getSolution(y_);
+  std::vector<double>& y = y_[idx];
+  y.resize(ny_);
+  solver.getSolution(y.data());
 
 #ifdef HIOP_USE_MPI
 // uncomment if want to monitor contingency computing time
@@ -176,9 +186,11 @@ bool PriDecMasterProbleEx2::eval_f_rterm(size_type idx, const int& n, const doub
 bool PriDecMasterProbleEx2::eval_grad_rterm(size_type idx, const int& n, double* x, hiopVector& grad)
 {
   assert(nx_ == n);
+  const std::vector<double>& y = y_[idx];
+  assert(static_cast<size_type>(y.size()) == ny_);
   double* grad_vec = grad.local_data();
   for(int i = 0; i < n; i++) {
-    grad_vec[i] = (x[i] - y_[i]);
+    grad_vec[i] = (x[i] - y[i]);
   }
   return true;
 };
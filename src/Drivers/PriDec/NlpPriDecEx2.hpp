@@ -2,6 +2,7 @@
 #define HIOP_EXAMPLE_PRIDEC_EX2
 
 #include <hiopVectorInt.hpp>
+#include <vector>
 // base interface (NLP specification for primal decomposable problems)
 #include "hiopInterfacePrimalDecomp.hpp"
 
@@ -114,7 +115,9 @@ private:
   /// number of sample to use, effectively the number of recourse terms
   size_type S_;
 
-  double* y_;
+  /// recourse solution of each contingency, computed by `eval_f_rterm` and used by `eval_grad_rterm`;
+  /// one per contingency since the recourse terms may be evaluated concurrently
+  std::vector<std::vector<double>> y_;
 
   double* sol_;
   double obj_;
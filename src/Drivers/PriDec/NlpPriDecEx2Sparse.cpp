@@ -11,7 +11,7 @@ PriDecMasterProbleEx2Sparse::PriDecMasterProbleEx2Sparse(size_type nx, size_type
       S_(S)
 {
   assert(nx == ny);
-  y_ = new double[ny_];
+  y_.resize(S_);
   sol_ = new double[nx_];
   obj_ = 1e20;
   basecase_ = new PriDecBasecaseProbleEx2(nx_);
@@ -20,7 +20,6 @@ PriDecMasterProbleEx2Sparse::PriDecMasterProbleEx2Sparse(size_type nx, size_type
 
 PriDecMasterProbleEx2Sparse::~PriDecMasterProbleEx2Sparse()
 {
-  delete[] y_;
   delete[] sol_;
   delete basecase_;
 };
@@ -147,10 +146,9 @@ bool PriDecMasterProbleEx2Sparse::eval_f_rterm(size_type idx, const int& n, cons
   status = solver.run();
   assert(status <= hiopSolveStatus::User_Stopped);  // check solver status if necessary
   rval = solver.getObjective();
-  if(y_ == nullptr) {
-    y_ = new double[ny_];
-  }
-  solver.getSolution(y_);
+  std::vector<double>& y = y_[idx];
+  y.resize(ny_);
+  solver.getSolution(y.data());
 
 #ifdef HIOP_USE_MPI
 // uncomment if want to monitor contingency computing time
@@ -171,9 +169,11 @@ bool PriDecMasterProbleEx2Sparse::eval_f_rterm(size_type idx, const int& n, cons
 bool PriDecMasterProbleEx2Sparse::eval_grad_rterm(size_type idx, const int& n, double* x, hiopVector& grad)
 {
   assert(nx_ == n);
+  const std::vector<double>& y = y_[idx];
+  assert(static_cast<size_type>(y.size()) == ny_);
   double* grad_vec = grad.local_data();
   for(int i = 0; i < n; i++) {
-    grad_vec[i] = (x[i] - y_[i]);
+    grad_vec[i] = (x[i] - y[i]);
   }
   return true;
 };
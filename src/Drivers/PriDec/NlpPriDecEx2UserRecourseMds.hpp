@@ -4,6 +4,8 @@
 #include <cstring>
 #include <cstdio>
 
+#include "hiopInterfacePrimalDecomp.hpp"
+
 /** This class provide an example of what a user of hiop::hiopInterfacePriDecProblem
  * should implement in order to provide the recourse problem to
  * hiop::hiopAlgPrimalDecomposition solver.
@@ -86,6 +88,13 @@ public:
     delete[] xi_;
   }
 
+  /// Sets the cache in which the iterates are stored and from which the solve is warm started
+  void set_warm_start(hiop::hiopInterfacePriDecProblem::RecourseWarmStart* warm_start, int idx)
+  {
+    warm_start_ = warm_start;
+    idx_ = idx;
+  }
+
   // set the ratio of sparse matrices
   void set_sparse(const double ratio)
   {
@@ -433,6 +442,65 @@ public:
     return false;
   }
 
+  /// Warm start point: the solution of this contingency at the previous outer iteration
+  bool get_warmstart_point(const size_type& n,
+                           const size_type& m,
+                           double* x0,
+                           double* z_bndL0,
+                           double* z_bndU0,
+                           double* lambda0,
+                           double* ineq_slack,
+                           double* vl0,
+                           double* vu0)
+  {
+    if(warm_start_ == nullptr) {
+      return false;
+    }
+    return warm_start_->get_warmstart_point(idx_, n, m, x0, z_bndL0, z_bndU0, lambda0, ineq_slack, vl0, vu0);
+  }
+
+  /// Stores the iterates in the warm start cache, so that the cache holds the solution at the end of the solve
+  bool iterate_callback(int iter,
+                        double obj_value,
+                        double logbar_obj_value,
+                        int n,
+                        const double* x,
+                        const double* z_L,
+                        const double* z_U,
+                        int m_ineq,
+                        const double* s,
+                        int m,
+                        const double* g,
+                        const double* lambda,
+                        double inf_pr,
+                        double inf_du,
+                        double onenorm_pr,
+                        double mu,
+                        double alpha_du,
+                        double alpha_pr,
+                        int ls_trials)
+  {
+    if(warm_start_ != nullptr) {
+      warm_start_->store_iterate(idx_, n, x, z_L, z_U, m_ineq, s, m, lambda);
+    }
+    return true;
+  }
+
+  bool iterate_full_callback(const double* x,
+                             const double* z_L,
+                             const double* z_U,
+                             const double* yc,
+                             const double* yd,
+                             const double* s,
+                             const double* v_L,
+                             const double* v_U)
+  {
+    if(warm_start_ != nullptr) {
+      warm_start_->store_ineq_duals(idx_, v_L, v_U);
+    }
+    return true;
+  }
+
   /**
    * This function computes the derivative of the recourse function with respect to x in the problem description,
    * which is the x_ in the protected variable, while x in the function implementation
@@ -463,6 +531,7 @@ protected:
   int nS_;
   int S_;
   int idx_;
+  hiop::hiopInterfacePriDecProblem::RecourseWarmStart* warm_start_ = nullptr;
   double sparse_ratio = 0.7;
   int nsparse_;
 };
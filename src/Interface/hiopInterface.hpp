@@ -471,7 +471,8 @@ public:
 
   /**
    * This method is used to provide user all the internal hiop iterates. @see solution_callback()
-   * for an explanation of the parameters.
+   * for an explanation of the parameters. It is called at each iteration, right after iterate_callback(),
+   * when the option `iterate_full_callback` is set to `yes`.
    *
    * @param[in] x array of (local) entries of the primal variables (managed by Umpire, see note below)
    * @param[in] z_L array of (local) entries of the dual variables for lower bounds (managed by Umpire, see note below)
@@ -491,6 +492,8 @@ public:
    * arrays from device to host first, and then passes/returns pointers on host for the arrays managed by Umpire. These
    * pointers can be then used in host memory space (without the need to rely on or use Umpire).
    *
+   * @note If the user (implementer) of this methods returns false, HiOp will stop the
+   * the optimization with hiop::hiopSolveStatus::User_Stopped return code.
    */
   virtual bool iterate_full_callback(const double* x,
                                      const double* z_L,
@@ -1,5 +1,7 @@
 #include "hiopInterfacePrimalDecomp.hpp"
 
+#include <algorithm>
+
 using namespace hiop;
 hiopInterfacePriDecProblem::RecourseApproxEvaluator::RecourseApproxEvaluator(int nc, const std::string& mem_space)
     : RecourseApproxEvaluator(nc, nc, mem_space)  // nc_ <= nx, nd=S
@@ -234,3 +236,111 @@ hiopVector* hiopInterfacePriDecProblem::RecourseApproxEvaluator::get_rgrad() con
 hiopVector* hiopInterfacePriDecProblem::RecourseApproxEvaluator::get_rhess() const { return rhess_; }
 
 hiopVector* hiopInterfacePriDecProblem::RecourseApproxEvaluator::get_x0() const { return x0_; }
+
+hiopInterfacePriDecProblem::RecourseWarmStart::RecourseWarmStart()
+    : enabled_(false)
+{}
+
+hiopInterfacePriDecProblem::RecourseWarmStart::~RecourseWarmStart() {}
+
+void hiopInterfacePriDecProblem::RecourseWarmStart::set_enabled(const bool enabled)
+{
+  enabled_ = enabled;
+  if(!enabled_) {
+    clear();
+  }
+}
+
+void hiopInterfacePriDecProblem::RecourseWarmStart::store_iterate(size_type idx,
+                                                                 int n,
+                                                                 const double* x,
+                                                                 const double* z_L,
+                                                                 const double* z_U,
+                                                                 int m_ineq,
+                                                                 const double* s,
+                                                                 int m,
+                                                                 const double* lambda)
+{
+  if(!enabled_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  Point& pt = points_[idx];
+  pt.x.assign(x, x + n);
+  pt.zl.assign(z_L, z_L + n);
+  pt.zu.assign(z_U, z_U + n);
+  pt.s.assign(s, s + m_ineq);
+  pt.lambda.assign(lambda, lambda + m);
+  // the duals of the slacks bounds of this iterate are not known yet
+  pt.complete = false;
+}
+
+void hiopInterfacePriDecProblem::RecourseWarmStart::store_ineq_duals(size_type idx, const double* v_L, const double* v_U)
+{
+  if(!enabled_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = points_.find(idx);
+  assert(it != points_.end() && "store_iterate should be called first");
+  if(it == points_.end()) {
+    return;
+  }
+  Point& pt = it->second;
+  const size_t m_ineq = pt.s.size();
+  pt.vl.assign(v_L, v_L + m_ineq);
+  pt.vu.assign(v_U, v_U + m_ineq);
+  pt.complete = true;
+}
+
+bool hiopInterfacePriDecProblem::RecourseWarmStart::has(size_type idx) const
+{
+  if(!enabled_) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = points_.find(idx);
+  return it != points_.end() && it->second.complete;
+}
+
+bool hiopInterfacePriDecProblem::RecourseWarmStart::get_warmstart_point(size_type idx,
+                                                                       const size_type& n,
+                                                                       const size_type& m,
+                                                                       double* x0,
+                                                                       double* z_bndL0,
+                                                                       double* z_bndU0,
+                                                                       double* lambda0,
+                                                                       double* ineq_slack,
+                                                                       double* vl0,
+                                                                       double* vu0) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = points_.find(idx);
+  if(it == points_.end() || !it->second.complete) {
+    return false;
+  }
+  const Point& pt = it->second;
+  if(static_cast<size_type>(pt.x.size()) != n || static_cast<size_type>(pt.lambda.size()) != m) {
+    return false;
+  }
+  std::copy(pt.x.begin(), pt.x.end(), x0);
+  std::copy(pt.zl.begin(), pt.zl.end(), z_bndL0);
+  std::copy(pt.zu.begin(), pt.zu.end(), z_bndU0);
+  std::copy(pt.lambda.begin(), pt.lambda.end(), lambda0);
+  std::copy(pt.s.begin(), pt.s.end(), ineq_slack);
+  std::copy(pt.vl.begin(), pt.vl.end(), vl0);
+  std::copy(pt.vu.begin(), pt.vu.end(), vu0);
+  return true;
+}
+
+void hiopInterfacePriDecProblem::RecourseWarmStart::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  points_.clear();
+}
+
+size_type hiopInterfacePriDecProblem::RecourseWarmStart::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<size_type>(points_.size());
+}
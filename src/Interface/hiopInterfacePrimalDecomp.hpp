@@ -6,6 +6,8 @@
 #include "LinAlgFactory.hpp"
 #include <cassert>
 #include <cstring>  //for memcpy
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace hiop
@@ -177,6 +179,90 @@ public:
   };
 
   virtual bool set_recourse_approx_evaluator(const int n, RecourseApproxEvaluator* evaluator) = 0;
+
+  /**
+   * Cache of the primal-dual solutions of the recourse problems solved on this rank, keyed by the index
+   * of the recourse term (contingency), used to warm start the recourse solves at the subsequent outer
+   * iterations of the PriDec solver. The cache is enabled by the PriDec option 'recourse_warm_start',
+   * which also makes the PriDec solver send a contingency, whenever possible, to the rank that solved it
+   * at the previous outer iteration.
+   *
+   * When the recourse problems are solved by HiOp, the recourse NLP (the user's hiopInterfaceBase
+   * object) of contingency `idx` fills the cache with its iterates by calling
+   *  - `store_iterate` from hiopInterfaceBase::iterate_callback and
+   *  - `store_ineq_duals` from hiopInterfaceBase::iterate_full_callback,
+   * which are called at each iteration, so that the cache holds the solution once the solve is done. The
+   * latter is called only when the option 'iterate_full_callback' of the recourse NLP is set to 'yes'.
+   * When `has(idx)` is true, the recourse NLP should be solved with option 'warm_start' set to 'yes'
+   * and its hiopInterfaceBase::get_warmstart_point should call `get_warmstart_point` below.
+   *
+   * The arrays are expected to be in host memory. The methods can be called concurrently (see PriDec
+   * option 'recourse_num_threads').
+   */
+  class RecourseWarmStart
+  {
+  public:
+    RecourseWarmStart();
+    virtual ~RecourseWarmStart();
+
+    /// Enables or disables the cache; when disabled, nothing is stored and `has` returns false
+    void set_enabled(const bool enabled);
+    bool is_enabled() const { return enabled_; }
+
+    /// Stores the primal variables, the bound duals, the inequality slacks and the constraint duals
+    void store_iterate(size_type idx,
+                       int n,
+                       const double* x,
+                       const double* z_L,
+                       const double* z_U,
+                       int m_ineq,
+                       const double* s,
+                       int m,
+                       const double* lambda);
+
+    /// Stores the duals of the slacks bounds; to be called after `store_iterate` for the same iterate
+    void store_ineq_duals(size_type idx, const double* v_L, const double* v_U);
+
+    /// Returns true if a complete primal-dual point is stored for contingency `idx`
+    bool has(size_type idx) const;
+
+    /**
+     * Copies the primal-dual point stored for contingency `idx` in the arrays of
+     * hiopInterfaceBase::get_warmstart_point. Returns false if there is no point or if its sizes differ.
+     */
+    bool get_warmstart_point(size_type idx,
+                             const size_type& n,
+                             const size_type& m,
+                             double* x0,
+                             double* z_bndL0,
+                             double* z_bndU0,
+                             double* lambda0,
+                             double* ineq_slack,
+                             double* vl0,
+                             double* vu0) const;
+
+    /// Removes all the stored points
+    void clear();
+
+    /// Number of contingencies with a stored point
+    size_type size() const;
+
+  private:
+    struct Point
+    {
+      std::vector<double> x, zl, zu, s, lambda, vl, vu;
+      bool complete = false;
+    };
+    bool enabled_;
+    std::unordered_map<size_type, Point> points_;
+    mutable std::mutex mutex_;
+  };
+
+  /// Returns the warm start cache of the recourse problems solved on this rank
+  RecourseWarmStart& get_recourse_warm_start() { return recourse_warm_start_; }
+
+protected:
+  RecourseWarmStart recourse_warm_start_;
 };
 
 }  // namespace hiop
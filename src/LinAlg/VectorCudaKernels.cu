@@ -67,6 +67,8 @@
 #include <thrust/execution_policy.h>
 #include <thrust/device_malloc.h>
 #include <thrust/device_free.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tuple.h>
 
 
 //#include <cmath>
@@ -210,6 +212,96 @@ struct thrust_istrue : public thrust::unary_function<int, bool>
     }
 };
 
+/// @brief r[i] = id[i] ? a[i]-b[i]-c[i] : 0, returns abs(r[i])
+struct thrust_bound_residual
+{
+  double* r_;
+  const double* a_;
+  const double* b_;
+  const double* c_;
+  const double* id_;
+
+  __host__ __device__
+  double operator()(const int& i) const
+  {
+    r_[i] = (id_[i] == 0.0) ? 0.0 : a_[i] - b_[i] - c_[i];
+    return fabs(r_[i]);
+  }
+};
+
+/// @brief r[i] = id[i] ? mu-s[i]*z[i] : 0, returns (abs(s[i]*z[i]), abs(r[i])) on the pattern
+struct thrust_complementarity_residual
+{
+  double* r_;
+  const double* s_;
+  const double* z_;
+  const double* id_;
+  const double mu_;
+
+  __host__ __device__
+  thrust::tuple<double,double> operator()(const int& i) const
+  {
+    if(id_[i] == 1.0) {
+      const double sz = s_[i]*z_[i];
+      r_[i] = mu_ - sz;
+      return thrust::make_tuple(fabs(sz), fabs(r_[i]));
+    }
+    r_[i] = 0.0;
+    return thrust::make_tuple(0.0, 0.0);
+  }
+};
+
+/// @brief fraction-to-the-boundary candidates (primal, dual) of a slack/dual pair, 1.0 off the pattern
+struct thrust_frac_to_bds_pair
+{
+  const double* s_;
+  const double* ds_;
+  const double* z_;
+  const double* dz_;
+  const double* id_;
+  const double tau_;
+
+  __host__ __device__
+  thrust::tuple<double,double> operator()(const int& i) const
+  {
+    double alpha_s = 1.0;
+    double alpha_z = 1.0;
+    if(id_[i] == 1.0) {
+      if(ds_[i] < 0) {
+        alpha_s = -tau_*s_[i]/ds_[i];
+      }
+      if(dz_[i] < 0) {
+        alpha_z = -tau_*z_[i]/dz_[i];
+      }
+    }
+    return thrust::make_tuple(alpha_s, alpha_z);
+  }
+};
+
+/// @brief componentwise max of two pairs
+struct thrust_tuple_max
+{
+  __host__ __device__
+  thrust::tuple<double,double> operator()(const thrust::tuple<double,double>& a,
+                                          const thrust::tuple<double,double>& b) const
+  {
+    return thrust::make_tuple(fmax(thrust::get<0>(a), thrust::get<0>(b)),
+                              fmax(thrust::get<1>(a), thrust::get<1>(b)));
+  }
+};
+
+/// @brief componentwise min of two pairs
+struct thrust_tuple_min
+{
+  __host__ __device__
+  thrust::tuple<double,double> operator()(const thrust::tuple<double,double>& a,
+                                          const thrust::tuple<double,double>& b) const
+  {
+    return thrust::make_tuple(fmin(thrust::get<0>(a), thrust::get<0>(b)),
+                              fmin(thrust::get<1>(a), thrust::get<1>(b)));
+  }
+};
+
 /** @brief Set y[i] = min(y[i],c), for i=[0,n_local-1] */
 __global__ void component_min_cu(int n, double* y, const double c)
 {
@@ -526,6 +618,16 @@ __global__ void set_match_pattern_cu(int n, int* yd, const double* xd, const dou
   }
 }
 
+/** @brief y = b + alpha*d */
+__global__ void copy_from_axpy_cu(int n, double* yd, const double* bd, double alpha, const double* dd)
+{
+  const int num_threads = blockDim.x * gridDim.x;
+  const int tid = blockIdx.x * blockDim.x + threadIdx.x;
+  for (int i = tid; i < n; i += num_threads) {
+    yd[i] = bd[i] + alpha*dd[i];
+  }
+}
+
 /** @brief Adjusts duals. */
 __global__ void adjust_duals_cu(int n, double* zd, const double* xd, const double* id, double mu, double kappa)
 {
@@ -1299,6 +1401,72 @@ void compute_cusum_kernel(int sz, int* buf, const double* id)
   thrust::inclusive_scan(dev_v, dev_v + sz, dev_v); // in-place scan
 }
 
+/** @brief y = b + alpha*d */
+void copy_from_axpy_kernel(int n, double* yd, const double* bd, double alpha, const double* dd)
+{
+  int num_blocks = (n+block_size-1)/block_size;
+  copy_from_axpy_cu<<<num_blocks,block_size>>>(n, yd, bd, alpha, dd);
+}
+
+/** @brief r = id ? a-b-c : 0, returns max(abs(r)) */
+double bound_residual_w_pattern_kernel(int n,
+                                       double* rd,
+                                       const double* ad,
+                                       const double* bd,
+                                       const double* cd,
+                                       const double* id)
+{
+  thrust_bound_residual res_op{rd, ad, bd, cd, id};
+  return thrust::transform_reduce(thrust::device,
+                                  thrust::counting_iterator<int>(0),
+                                  thrust::counting_iterator<int>(n),
+                                  res_op,
+                                  0.0,
+                                  thrust::maximum<double>());
+}
+
+/** @brief r = id ? mu-s*z : 0, returns max(abs(r)) and sets nrm_nlp to max(abs(s*z)) on the pattern */
+double complementarity_residual_kernel(int n,
+                                       double* rd,
+                                       double mu,
+                                       const double* sd,
+                                       const double* zd,
+                                       const double* id,
+                                       double& nrm_nlp)
+{
+  thrust_complementarity_residual res_op{rd, sd, zd, id, mu};
+  thrust::tuple<double,double> nrms = thrust::transform_reduce(thrust::device,
+                                                               thrust::counting_iterator<int>(0),
+                                                               thrust::counting_iterator<int>(n),
+                                                               res_op,
+                                                               thrust::make_tuple(0.0, 0.0),
+                                                               thrust_tuple_max());
+  nrm_nlp = thrust::get<0>(nrms);
+  return thrust::get<1>(nrms);
+}
+
+/** @brief fraction-to-the-boundary step lengths for the slack `s` and its dual `z` with pattern `id` */
+void min_frac_to_bds_pair_w_pattern_kernel(int n,
+                                           const double* sd,
+                                           const double* dsd,
+                                           const double* zd,
+                                           const double* dzd,
+                                           const double* id,
+                                           double tau,
+                                           double& alpha_primal,
+                                           double& alpha_dual)
+{
+  thrust_frac_to_bds_pair frac_op{sd, dsd, zd, dzd, id, tau};
+  thrust::tuple<double,double> alphas = thrust::transform_reduce(thrust::device,
+                                                                 thrust::counting_iterator<int>(0),
+                                                                 thrust::counting_iterator<int>(n),
+                                                                 frac_op,
+                                                                 thrust::make_tuple(1.0, 1.0),
+                                                                 thrust_tuple_min());
+  alpha_primal = thrust::get<0>(alphas);
+  alpha_dual = thrust::get<1>(alphas);
+}
+
 }
 
 }
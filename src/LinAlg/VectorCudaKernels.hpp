@@ -236,6 +236,37 @@ void set_to_linspace_kernel(int sz, int* buf, int i0, int di);
 /** @brief compute cusum from the given pattern*/
 void compute_cusum_kernel(int sz, int* buf, const double* id);
 
+/** @brief y = b + alpha*d */
+void copy_from_axpy_kernel(int n, double* yd, const double* bd, double alpha, const double* dd);
+
+/** @brief r = id ? a-b-c : 0, returns max(abs(r)) */
+double bound_residual_w_pattern_kernel(int n,
+                                       double* rd,
+                                       const double* ad,
+                                       const double* bd,
+                                       const double* cd,
+                                       const double* id);
+
+/** @brief r = id ? mu-s*z : 0, returns max(abs(r)) and sets nrm_nlp to max(abs(s*z)) on the pattern */
+double complementarity_residual_kernel(int n,
+                                       double* rd,
+                                       double mu,
+                                       const double* sd,
+                                       const double* zd,
+                                       const double* id,
+                                       double& nrm_nlp);
+
+/** @brief fraction-to-the-boundary step lengths for the slack `s` and its dual `z` with pattern `id` */
+void min_frac_to_bds_pair_w_pattern_kernel(int n,
+                                           const double* sd,
+                                           const double* dsd,
+                                           const double* zd,
+                                           const double* dzd,
+                                           const double* id,
+                                           double tau,
+                                           double& alpha_primal,
+                                           double& alpha_dual);
+
 }  // namespace cuda
 }  // namespace hiop
 #endif
@@ -65,8 +65,11 @@
 #include "hiopOptions.hpp"
 #include <LinAlgFactory.hpp>
 #include "hiopLinearOperator.hpp"
+#include "hiopReductionBatch.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace hiop
 {
@@ -694,4 +697,224 @@ bool hiopBiCGStabSolver::solve(hiopVector* b)
   return true;
 }
 
+/*
+ * class hiopFGMRESSolver
+ */
+hiopFGMRESSolver::hiopFGMRESSolver(int n,
+                                   hiopLinearOperator* A_opr,
+                                   hiopLinearOperator* Mleft_opr,
+                                   hiopLinearOperator* Mright_opr,
+                                   const hiopVector* x0,
+                                   MPI_Comm comm)
+    : hiopKrylovSolver(n, A_opr, Mleft_opr, Mright_opr, x0),
+      restart_{20},
+      comm_{comm},
+      res_{nullptr},
+      w_{nullptr}
+{}
+
+hiopFGMRESSolver::~hiopFGMRESSolver()
+{
+  for(auto* v: V_) {
+    delete v;
+  }
+  for(auto* z: Z_) {
+    delete z;
+  }
+  delete res_;
+  delete w_;
+}
+
+bool hiopFGMRESSolver::solve(hiopIterate* xsol, const hiopResidual* bresid)
+{
+  if(nullptr == b_) {
+    b_ = new hiopVectorCompoundPD(xsol);
+  }
+  b_->copy_from_resid(bresid);
+
+  return solve(b_);
+}
+
+double hiopFGMRESSolver::compute_residual(const hiopVector& b, const hiopVector& x)
+{
+  A_opr_->times_vec(*res_, x);
+  res_->axpy(-1.0, b);
+  res_->scale(-1.0);
+  return res_->twonorm();
+}
+
+bool hiopFGMRESSolver::solve(hiopVector* b)
+{
+  std::stringstream().swap(ss_info_);
+  // rhs = 0 --> solution = 0
+  const double n2b = b->twonorm();
+  if(n2b == 0.0) {
+    flag_ = 0;
+    iter_ = 0.;
+    rel_resid_ = 0;
+    abs_resid_ = 0;
+    ss_info_ << "FGMRES converged: actual normResid=" << abs_resid_ << " relResid=" << rel_resid_ << " iter=" << iter_
+             << std::endl;
+    return true;
+  }
+
+  if(nullptr == res_) {
+    res_ = b->alloc_clone();
+    w_ = b->alloc_clone();
+  }
+  if(nullptr == x0_) {
+    x0_ = b->alloc_clone();  // work vectors
+    x0_->setToZero();
+  }
+
+  // the Krylov subspace is never larger than the maximum number of iterations
+  const int m = static_cast<int>(std::max<size_type>(1, std::min<size_type>(restart_, maxit_)));
+  H_.assign((m + 1) * m, 0.);
+  cs_.assign(m, 0.);
+  sn_.assign(m, 0.);
+  g_.assign(m + 1, 0.);
+  std::vector<double> h2(m + 1);
+  hiopReductionBatch batch(comm_);
+
+  hiopVector* xk_ = x0_;
+  const double tolb = tol_ * n2b;  // relative tolerance
+  flag_ = 1;
+  index_type ii = 0;  // total number of iterations
+
+  double beta = compute_residual(*b, *xk_);
+  abs_resid_ = beta;
+  if(beta <= tolb) {
+    flag_ = 0;
+  }
+
+  // outer loop over the restarts
+  while(flag_ != 0 && ii < maxit_) {
+    if(V_.empty()) {
+      V_.push_back(b->alloc_clone());
+    }
+    V_[0]->copyFrom(*res_);
+    V_[0]->scale(1.0 / beta);
+    std::fill(g_.begin(), g_.end(), 0.);
+    g_[0] = beta;
+
+    // Arnoldi process
+    int j = 0;
+    bool happy_breakdown = false;
+    for(; j < m && ii < maxit_; ++j) {
+      if(static_cast<int>(Z_.size()) <= j) {
+        Z_.push_back(b->alloc_clone());
+      }
+      // z_j = M*v_j, with the preconditioner of this iteration
+      if(ML_opr_) {
+        ML_opr_->times_vec(*Z_[j], *V_[j]);
+      } else {
+        Z_[j]->copyFrom(*V_[j]);
+      }
+      if(MR_opr_) {
+        MR_opr_->times_vec(*Z_[j], *Z_[j]);
+      }
+      A_opr_->times_vec(*w_, *Z_[j]);
+      ++ii;
+
+      // classical Gram-Schmidt with one reorthogonalization; the dot products of each pass are batched
+      double* hj = &H_[j * (m + 1)];
+      for(int pass = 0; pass < 2; ++pass) {
+        double* h = 0 == pass ? hj : h2.data();
+        batch.clear();
+        const int first = batch.add_dots(*w_, j + 1, V_.data());
+        batch.reduce();
+        for(int i = 0; i <= j; i++) {
+          h[i] = batch.value(first + i);
+          w_->axpy(-h[i], *V_[i]);
+        }
+        if(1 == pass) {
+          for(int i = 0; i <= j; i++) {
+            hj[i] += h2[i];
+          }
+        }
+      }
+      // the norm is computed with scaling, the sum of the squares of the entries may overflow
+      const double hnext = w_->twonorm();
+      hj[j + 1] = hnext;
+
+      // apply the previous Givens rotations to the new column and compute the new one
+      for(int i = 0; i < j; i++) {
+        const double tmp = cs_[i] * hj[i] + sn_[i] * hj[i + 1];
+        hj[i + 1] = -sn_[i] * hj[i] + cs_[i] * hj[i + 1];
+        hj[i] = tmp;
+      }
+      const double denom = std::hypot(hj[j], hj[j + 1]);
+      if(denom == 0.0) {
+        // the preconditioned operator is singular
+        flag_ = 4;
+        break;
+      }
+      cs_[j] = hj[j] / denom;
+      sn_[j] = hj[j + 1] / denom;
+      hj[j] = denom;
+      hj[j + 1] = 0.;
+      g_[j + 1] = -sn_[j] * g_[j];
+      g_[j] = cs_[j] * g_[j];
+      abs_resid_ = std::abs(g_[j + 1]);
+
+      // lucky breakdown: the solution is in the current subspace
+      happy_breakdown = hnext <= std::numeric_limits<double>::epsilon() * beta;
+      if(abs_resid_ <= tolb || happy_breakdown) {
+        ++j;
+        break;
+      }
+      if(j + 1 < m) {
+        if(static_cast<int>(V_.size()) <= j + 1) {
+          V_.push_back(b->alloc_clone());
+        }
+        V_[j + 1]->copyFrom(*w_);
+        V_[j + 1]->scale(1.0 / hnext);
+      }
+    }
+
+    // x = x + Z*y, where y solves the triangular system H(0:j,0:j)*y = g(0:j)
+    std::vector<double> y(g_.begin(), g_.begin() + j);
+    for(int i = j - 1; i >= 0; i--) {
+      for(int k = i + 1; k < j; k++) {
+        y[i] -= H_[k * (m + 1) + i] * y[k];
+      }
+      y[i] /= H_[i * (m + 1) + i];
+    }
+    for(int i = 0; i < j; i++) {
+      xk_->axpy(y[i], *Z_[i]);
+    }
+    if(4 == flag_) {
+      break;
+    }
+
+    // the estimate of the residual from the least squares is checked against the actual residual
+    const double beta_prev = beta;
+    beta = compute_residual(*b, *xk_);
+    abs_resid_ = beta;
+    if(beta <= tolb) {
+      flag_ = 0;
+    } else if(happy_breakdown) {
+      // the subspace is invariant, but the solution in it does not meet the tolerance
+      flag_ = 2;
+    } else if(beta >= beta_prev) {
+      // no progress over a whole cycle
+      flag_ = 3;
+    }
+  }
+
+  iter_ = ii;
+  rel_resid_ = abs_resid_ / n2b;
+  b->copyFrom(*xk_);
+  if(flag_ == 0) {
+    ss_info_ << "FGMRES converged: actual normResid=" << abs_resid_ << " relResid=" << rel_resid_ << " iter=" << iter_
+             << std::endl;
+    return true;
+  }
+  ss_info_ << "FGMRES did NOT converged after " << ii << " iters." << std::endl;
+  ss_info_ << "\t - Error code " << flag_ << "\n\t - Abs res=" << abs_resid_ << "\n\t - Rel res=" << rel_resid_
+           << std::endl;
+  ss_info_ << "\t - ||rhs||_2=" << n2b << "   ||sol||_2=" << b->twonorm() << std::endl;
+  return false;
+}
+
 }  // namespace hiop
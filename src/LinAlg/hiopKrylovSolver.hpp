@@ -214,6 +214,60 @@ protected:
   hiopVector* rt_;
 };
 
+/**
+ * a Krylov solver class implementing the restarted flexible GMRES, FGMRES(m), with right preconditioning
+ *
+ * The preconditioner (the left and the right operators, applied one after the other) may change from one
+ * iteration to the next, e.g., when it is itself an inexact or iterative solve. The Arnoldi basis is
+ * orthogonalized with classical Gram-Schmidt and one reorthogonalization (CGS2). The dot products of each
+ * Gram-Schmidt pass are computed in one sweep over the new vector and completed with a single reduction over
+ * the ranks of `comm` (see hiopReductionBatch), so an iteration needs three reductions whatever its number.
+ *
+ * The number of iterations is the number of applications of the preconditioner.
+ *
+ * Convergence flags: 0 converged, 1 maximum number of iterations reached, 2 breakdown of the Arnoldi process
+ * with a residual above the tolerance, 3 no progress over a restart cycle, 4 singular preconditioned operator.
+ */
+class hiopFGMRESSolver : public hiopKrylovSolver
+{
+public:
+  /** initialization constructor */
+  hiopFGMRESSolver(int n,
+                   hiopLinearOperator* A_opr,
+                   hiopLinearOperator* Mleft_opr = nullptr,
+                   hiopLinearOperator* Mright_opr = nullptr,
+                   const hiopVector* x0 = nullptr,
+                   MPI_Comm comm = MPI_COMM_SELF);
+  virtual ~hiopFGMRESSolver();
+
+  /// Set the restart length m, i.e., the maximum dimension of the Krylov subspace
+  inline void set_restart(int restart) { restart_ = restart > 0 ? restart : 1; }
+
+  /** Solves a linear system.
+   * param 'x' is on entry the right hand side(s) of the system to be solved. On
+   * exit is contains the solution(s).
+   */
+  virtual bool solve(hiopIterate* xsol, const hiopResidual* bresid);
+  virtual bool solve(hiopVector* b);
+
+protected:
+  /// Computes `res_` = b - A*x and returns its two-norm
+  double compute_residual(const hiopVector& b, const hiopVector& x);
+
+  int restart_;
+  MPI_Comm comm_;
+  /// Arnoldi basis (up to restart_+1 vectors) and the preconditioned basis (up to restart_ vectors)
+  std::vector<hiopVector*> V_;
+  std::vector<hiopVector*> Z_;
+  hiopVector* res_;
+  hiopVector* w_;
+  /// Hessenberg matrix (column-major, restart_+1 rows), Givens rotations, and right-hand side of the least squares
+  std::vector<double> H_;
+  std::vector<double> cs_;
+  std::vector<double> sn_;
+  std::vector<double> g_;
+};
+
 }  // namespace hiop
 
 #endif
@@ -115,6 +115,30 @@ hiopLinSolverSymSparse::hiopLinSolverSymSparse(hiopMatrixSparse* M, hiopNlpFormu
   perf_report_ = "on" == hiop::tolower(nlp->options->GetString("time_kkt"));
 }
 
+bool hiopLinSolverSymSparse::solve(hiopMatrix& X)
+{
+  hiopMatrixDense* Xd = dynamic_cast<hiopMatrixDense*>(&X);
+  assert(Xd && "only dense right-hand sides are supported");
+  assert(nullptr == Xd || Xd->n() == M_->n());
+  if(nullptr == Xd || Xd->n() != M_->n()) {
+    return false;
+  }
+  const size_type nrhs = Xd->m();
+  if(0 == nrhs) {
+    return true;
+  }
+
+  hiopVector* x = LinearAlgebraFactory::create_vector(nlp_->options->GetString("mem_space"), Xd->n());
+  bool bret = true;
+  for(index_type r = 0; r < nrhs; r++) {
+    Xd->getRow(r, *x);
+    bret = solve(*x) && bret;
+    Xd->replaceRow(r, *x);
+  }
+  delete x;
+  return bret;
+}
+
 hiopLinSolverNonSymSparse::hiopLinSolverNonSymSparse(int n, int nnz, hiopNlpFormulation* nlp)
 {
   M_ = LinearAlgebraFactory::create_matrix_sparse(nlp->options->GetString("mem_space"), n, n, nnz);
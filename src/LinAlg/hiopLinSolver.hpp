@@ -193,6 +193,19 @@ public:
 
   virtual ~hiopLinSolverSymSparse() {}
 
+  /**
+   * Solves with multiple right-hand sides once the factorization has been computed by `matrixChanged()`.
+   *
+   * @param X is a dense matrix whose rows are on entry the right-hand sides and on exit the solutions. The rows
+   * of the row-major `X` are the columns of a column-major `n x nrhs` matrix, the layout used by the sparse solvers.
+   *
+   * This implementation solves for one row at a time with `solve(hiopVector&)`. It is overridden by the solvers
+   * that support multiple right-hand sides natively (MA57, PARDISO and STRUMPACK), which traverse the factors
+   * once for all right-hand sides.
+   */
+  virtual bool solve(hiopMatrix& X);
+  using hiopLinSolver::solve;
+
 protected:
   hiopLinSolverSymSparse() {}
 };
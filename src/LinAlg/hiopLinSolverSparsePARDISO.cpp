@@ -385,6 +385,54 @@ bool hiopLinSolverSymSparsePARDISO::solve(hiopVector& b)
   return 1;
 }
 
+bool hiopLinSolverSymSparsePARDISO::solve(hiopMatrix& X)
+{
+  assert(n_ == M_->n() && M_->n() == M_->m());
+  hiopMatrixDense* Xd = dynamic_cast<hiopMatrixDense*>(&X);
+  assert(Xd && "only dense right-hand sides are supported");
+  assert(nullptr == Xd || Xd->n() == n_);
+  if(nullptr == Xd || Xd->n() != n_) {
+    return false;
+  }
+  int nrhs = Xd->get_local_size_m();
+  if(0 == nrhs || 0 == n_) {
+    return true;
+  }
+
+  nlp_->runStats.linsolv.tmTriuSolves.start();
+
+  // the rows of the (row-major) X are the columns of the column-major n_ x nrhs array expected by PARDISO
+  double* dX = Xd->local_data();
+  rhs_nrhs_.assign(dX, dX + static_cast<size_t>(n_) * nrhs);
+
+  int phase = 33;
+  pardiso_d(pt_,
+            &maxfct_,
+            &mnum_,
+            &mtype_,
+            &phase,
+            &n_,
+            kVal_,
+            kRowPtr_,
+            jCol_,
+            NULL,
+            &nrhs,
+            iparm_,
+            &msglvl_,
+            rhs_nrhs_.data(),
+            dX,
+            &error_,
+            dparm_);
+
+  if(error_ != 0) {
+    printf("PardisoSolver - ERROR during backsolve with %d right-hand sides: %d\n", nrhs, error_);
+    assert(false);
+  }
+
+  nlp_->runStats.linsolv.tmTriuSolves.stop();
+  return error_ == 0;
+}
+
 /*
  *  PARDISO for unsymmetric sparse matrix
  */
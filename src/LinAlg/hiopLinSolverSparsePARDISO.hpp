@@ -57,6 +57,8 @@
 #include "hiopLinSolver.hpp"
 #include "hiopMatrixSparseTriplet.hpp"
 
+#include <vector>
+
 namespace hiop
 {
 
@@ -85,6 +87,9 @@ public:
    * exit is contains the solution(s).  */
   bool solve(hiopVector& x_);
 
+  /** solves with the rows of the dense matrix `X` as right-hand sides with one PARDISO solve phase */
+  bool solve(hiopMatrix& X);
+
 private:
   int m_;    // number of rows of the whole matrix
   int n_;    // number of cols of the whole matrix
@@ -118,6 +123,9 @@ private:
 
   hiopVectorPar* rhs_;
 
+  /// copy of the right-hand sides of the multiple right-hand sides solve
+  std::vector<double> rhs_nrhs_;
+
 public:
   /** called the very first time a matrix is factored. Allocates space
    * for the factorization and performs ordering */
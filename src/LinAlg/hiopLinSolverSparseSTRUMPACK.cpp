@@ -291,6 +291,32 @@ bool hiopLinSolverSymSparseSTRUMPACK::solve(hiopVector& x_)
   return 1;
 }
 
+bool hiopLinSolverSymSparseSTRUMPACK::solve(hiopMatrix& X)
+{
+  assert(n_ == M_->n() && M_->n() == M_->m());
+  hiopMatrixDense* Xd = dynamic_cast<hiopMatrixDense*>(&X);
+  assert(Xd && "only dense right-hand sides are supported");
+  assert(nullptr == Xd || Xd->n() == n_);
+  if(nullptr == Xd || Xd->n() != n_) {
+    return false;
+  }
+  const int nrhs = Xd->get_local_size_m();
+  if(0 == nrhs || 0 == n_) {
+    return true;
+  }
+
+  nlp_->runStats.linsolv.tmTriuSolves.start();
+
+  // the rows of the (row-major) X are the columns of the column-major n_ x nrhs array expected by STRUMPACK
+  double* dX = Xd->local_data();
+  rhs_nrhs_.assign(dX, dX + static_cast<size_t>(n_) * nrhs);
+  strumpack::ReturnCode retval = spss.solve(nrhs, rhs_nrhs_.data(), n_, dX, n_);
+
+  nlp_->runStats.linsolv.tmTriuSolves.stop();
+
+  return strumpack::ReturnCode::SUCCESS == retval;
+}
+
 hiopLinSolverNonSymSparseSTRUMPACK::hiopLinSolverNonSymSparseSTRUMPACK(const int& n, const int& nnz, hiopNlpFormulation* nlp)
     : hiopLinSolverNonSymSparse(n, nnz, nlp),
       kRowPtr_{nullptr},
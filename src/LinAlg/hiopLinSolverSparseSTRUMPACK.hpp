@@ -53,6 +53,7 @@
 #include "hiopMatrixSparseTriplet.hpp"
 #include "StrumpackSparseSolver.hpp"
 #include <unordered_map>
+#include <vector>
 
 /** implements the linear solver class using STRUMPACK
  *
@@ -80,6 +81,9 @@ public:
    * exit is contains the solution(s).  */
   bool solve(hiopVector &x_);
 
+  /** solves with the rows of the dense matrix `X` as right-hand sides with one STRUMPACK solve */
+  bool solve(hiopMatrix &X);
+
   // protected:
   //   int* ipiv;
   //   hiopVector* dwork;
@@ -96,6 +100,9 @@ private:
   int *index_covert_CSR2Triplet_;
   int *index_covert_extra_Diag2CSR_;
 
+  /// copy of the right-hand sides of the multiple right-hand sides solve
+  std::vector<double> rhs_nrhs_;
+
   // strumpack object
   StrumpackSparseSolver<double, int> spss;
 
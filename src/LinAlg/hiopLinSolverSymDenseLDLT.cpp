@@ -0,0 +1,228 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopLinSolverSymDenseLDLT.cpp
+ *
+ * Dense symmetric indefinite LDL^T solver based on LAPACK's blocked bounded Bunch-Kaufman factorization.
+ *
+ */
+
+#include "hiopLinSolverSymDenseLDLT.hpp"
+
+#include <cmath>
+
+namespace hiop
+{
+
+hiopLinSolverSymDenseLDLT::hiopLinSolverSymDenseLDLT(int n, hiopNlpFormulation* nlp)
+    : hiopLinSolverSymDense(n, nlp),
+      ipiv_(n),
+      e_(n),
+      num_pos_(0),
+      num_neg_(0),
+      num_null_(0)
+{}
+
+hiopLinSolverSymDenseLDLT::~hiopLinSolverSymDenseLDLT() {}
+
+int hiopLinSolverSymDenseLDLT::matrixChanged()
+{
+  assert(M_->n() == M_->m());
+  int N = M_->n(), lda = N, info;
+  num_pos_ = num_neg_ = num_null_ = 0;
+  if(N == 0) return 0;
+
+  nlp_->runStats.linsolv.tmFactTime.start();
+
+  char uplo = 'L';  // M is upper in C++ so it's lower in fortran
+
+  // workspace query only once; the optimal size depends on N and the block size of the LAPACK library
+  if(work_.empty()) {
+    double dwork_tmp;
+    int lwork = -1;
+#ifdef HIOP_LAPACK_HAS_SYTRF_RK
+    DSYTRF_RK(&uplo, &N, M_->local_data(), &lda, e_.data(), ipiv_.data(), &dwork_tmp, &lwork, &info);
+#else
+    DSYTRF(&uplo, &N, M_->local_data(), &lda, ipiv_.data(), &dwork_tmp, &lwork, &info);
+#endif
+    assert(info == 0);
+    work_.resize(std::max(1, (int)dwork_tmp));
+  }
+
+  int lwork = (int)work_.size();
+#ifdef HIOP_LAPACK_HAS_SYTRF_RK
+  DSYTRF_RK(&uplo, &N, M_->local_data(), &lda, e_.data(), ipiv_.data(), work_.data(), &lwork, &info);
+#else
+  DSYTRF(&uplo, &N, M_->local_data(), &lda, ipiv_.data(), work_.data(), &lwork, &info);
+#endif
+  nlp_->runStats.linsolv.tmFactTime.stop();
+
+  if(info < 0) {
+    nlp_->log->printf(hovError, "hiopLinSolverSymDenseLDLT error: %d argument to dsytrf has an illegal value.\n", -info);
+    return -1;
+  }
+  // info > 0 means that D(info,info) is exactly zero; the inertia below counts it as a null eigenvalue
+
+  nlp_->runStats.linsolv.tmInertiaComp.start();
+  compute_inertia();
+  nlp_->runStats.linsolv.tmInertiaComp.stop();
+
+  if(num_null_ > 0) {
+    return -1;
+  }
+  return num_neg_;
+}
+
+void hiopLinSolverSymDenseLDLT::compute_inertia()
+{
+  const int N = M_->n();
+  const double* MM = M_->local_data_const();
+  const double tol = 1e-14;
+
+#ifndef HIOP_LAPACK_HAS_SYTRF_RK
+  // DSYTRF keeps the off-diagonal of the 2x2 blocks of D in the strictly lower triangle (in fortran)
+  for(int k = 0; k < N; ++k) {
+    e_[k] = 0.;
+  }
+  for(int k = 0; k + 1 < N; ++k) {
+    if(ipiv_[k] < 0) {
+      e_[k] = MM[k * N + k + 1];
+      ++k;
+    }
+  }
+#endif
+
+  num_pos_ = num_neg_ = num_null_ = 0;
+  for(int k = 0; k < N; ++k) {
+    const double d = MM[k * N + k];
+    if(ipiv_[k] < 0 && k + 1 < N) {
+      // 2x2 block [d s; s c]: det = (d/t * c - t) * t, t = |s|, to avoid underflow/overflow
+      const double c = MM[(k + 1) * N + k + 1];
+      const double t = fabs(e_[k]);
+      const double det_t = (t > 0.) ? (d / t) * c - t : d * c;
+      if(det_t < -tol) {
+        // eigenvalues of opposite signs
+        num_pos_++;
+        num_neg_++;
+      } else if(det_t < tol) {
+        num_null_++;
+        if(d + c > 0.) {
+          num_pos_++;
+        } else {
+          num_neg_++;
+        }
+      } else {
+        // both eigenvalues have the sign of the trace
+        if(d + c > 0.) {
+          num_pos_ += 2;
+        } else {
+          num_neg_ += 2;
+        }
+      }
+      ++k;
+    } else {
+      if(d < -tol) {
+        num_neg_++;
+      } else if(d < tol) {
+        num_null_++;
+      } else {
+        num_pos_++;
+      }
+    }
+  }
+  assert(num_pos_ + num_neg_ + num_null_ == N);
+}
+
+bool hiopLinSolverSymDenseLDLT::solve_nrhs(double* b, int nrhs)
+{
+  int N = M_->n(), LDA = N, LDB = N, NRHS = nrhs, info;
+  char uplo = 'L';  // M is upper in C++ so it's lower in fortran
+#ifdef HIOP_LAPACK_HAS_SYTRF_RK
+  DSYTRS_3(&uplo, &N, &NRHS, M_->local_data(), &LDA, e_.data(), ipiv_.data(), b, &LDB, &info);
+#else
+  DSYTRS(&uplo, &N, &NRHS, M_->local_data(), &LDA, ipiv_.data(), b, &LDB, &info);
+#endif
+  if(info < 0) {
+    nlp_->log->printf(hovError, "hiopLinSolverSymDenseLDLT: DSYTRS returned error %d\n", info);
+  } else if(info > 0) {
+    nlp_->log->printf(hovError, "hiopLinSolverSymDenseLDLT: DSYTRS returned warning %d\n", info);
+  }
+  return info == 0;
+}
+
+bool hiopLinSolverSymDenseLDLT::solve(hiopVector& x)
+{
+  assert(M_->n() == M_->m());
+  assert(x.get_size() == M_->n());
+  if(M_->n() == 0) return true;
+
+  nlp_->runStats.linsolv.tmTriuSolves.start();
+  const bool bret = solve_nrhs(x.local_data(), 1);
+  nlp_->runStats.linsolv.tmTriuSolves.stop();
+  return bret;
+}
+
+bool hiopLinSolverSymDenseLDLT::solve(hiopMatrix& X)
+{
+  hiopMatrixDense* Xd = dynamic_cast<hiopMatrixDense*>(&X);
+  assert(Xd && "only dense right-hand sides are supported");
+  assert(Xd->n() == M_->n());
+  if(nullptr == Xd || Xd->n() != M_->n()) {
+    return false;
+  }
+  if(M_->n() == 0 || Xd->m() == 0) return true;
+
+  nlp_->runStats.linsolv.tmTriuSolves.start();
+  // the rows of the (row-major) X are the columns of a column-major N x nrhs matrix
+  const bool bret = solve_nrhs(Xd->local_data(), Xd->get_local_size_m());
+  nlp_->runStats.linsolv.tmTriuSolves.stop();
+  return bret;
+}
+
+}  // namespace hiop
@@ -0,0 +1,127 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopLinSolverSymDenseLDLT.hpp
+ *
+ * Dense symmetric indefinite LDL^T solver based on LAPACK's blocked bounded Bunch-Kaufman factorization.
+ *
+ */
+
+#ifndef HIOP_LINSOLVER_LDLT
+#define HIOP_LINSOLVER_LDLT
+
+#include "hiopLinSolver.hpp"
+
+#include <vector>
+
+namespace hiop
+{
+
+/**
+ * Dense symmetric indefinite solver computing A = P*L*D*L^T*P^T with LAPACK's DSYTRF_RK (blocked bounded
+ * Bunch-Kaufman, BLAS-3 and thus multithreaded through the BLAS library) and solving with DSYTRS_3. When
+ * the LAPACK library predates 3.7, DSYTRF/DSYTRS are used instead.
+ *
+ * Compared to hiopLinSolverSymDenseLapack:
+ *  - the LAPACK workspace is queried only once and kept across factorizations;
+ *  - the inertia is computed from the 1x1 and 2x2 blocks of D and is available via `get_inertia`;
+ *  - multiple right-hand sides are solved with one call to the triangular solves (`solve(hiopMatrix&)`).
+ */
+class hiopLinSolverSymDenseLDLT : public hiopLinSolverSymDense
+{
+public:
+  hiopLinSolverSymDenseLDLT(int n, hiopNlpFormulation* nlp);
+  virtual ~hiopLinSolverSymDenseLDLT();
+
+  /**
+   * Factorizes the matrix and computes its inertia. Returns the number of negative eigenvalues or -1
+   * if the matrix is singular or has null eigenvalues.
+   */
+  int matrixChanged();
+
+  /// Solves in place for one right-hand side
+  bool solve(hiopVector& x);
+
+  /**
+   * Solves in place for multiple right-hand sides given as the rows of the dense matrix `X`, which
+   * should have as many columns as the system matrix.
+   */
+  bool solve(hiopMatrix& X);
+
+  /// Inertia of the last factorized matrix; eigenvalues smaller than 1e-14 in absolute value are counted as null
+  inline void get_inertia(int& num_pos, int& num_neg, int& num_null) const
+  {
+    num_pos = num_pos_;
+    num_neg = num_neg_;
+    num_null = num_null_;
+  }
+
+protected:
+  /// Computes the inertia from the block-diagonal factor D
+  void compute_inertia();
+
+  /// Calls DSYTRS_3 (or DSYTRS) for `nrhs` right-hand sides stored contiguously in `b`
+  bool solve_nrhs(double* b, int nrhs);
+
+protected:
+  std::vector<int> ipiv_;
+  /// Off-diagonal of D: e_[k] is nonzero only when (k, k+1) is a 2x2 block
+  std::vector<double> e_;
+  /// LAPACK workspace, sized by a query at the first factorization and reused afterwards
+  std::vector<double> work_;
+  int num_pos_;
+  int num_neg_;
+  int num_null_;
+
+private:
+  hiopLinSolverSymDenseLDLT() = delete;
+};
+
+}  // namespace hiop
+#endif
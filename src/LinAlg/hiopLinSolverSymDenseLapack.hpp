@@ -79,45 +79,47 @@ public:
     int N = M_->n(), lda = N, info;
     if(N == 0) return 0;
 
-    nlp_->runStats.linsolv.tmFactTime.start();
-
-    double dwork_tmp;
-    char uplo = 'L';  // M is upper in C++ so it's lower in fortran
-
-    //
-    // query sizes
-    //
-    int lwork = -1;
-    DSYTRF(&uplo, &N, M_->local_data(), &lda, ipiv, &dwork_tmp, &lwork, &info);
-    assert(info == 0);
-
-    lwork = (int)dwork_tmp;
-    if(lwork != dwork->get_size()) {
-      delete dwork;
-      dwork = LinearAlgebraFactory::create_vector("DEFAULT", lwork);
-    }
+    {
+      // the factorization timer is also stopped when returning early on errors
+      hiopTimerScope tm_fact(nlp_->runStats.linsolv.tmFactTime);
+
+      double dwork_tmp;
+      char uplo = 'L';  // M is upper in C++ so it's lower in fortran
+
+      //
+      // query sizes
+      //
+      int lwork = -1;
+      DSYTRF(&uplo, &N, M_->local_data(), &lda, ipiv, &dwork_tmp, &lwork, &info);
+      assert(info == 0);
+
+      lwork = (int)dwork_tmp;
+      if(lwork != dwork->get_size()) {
+        delete dwork;
+        dwork = LinearAlgebraFactory::create_vector("DEFAULT", lwork);
+      }
 
-    //
-    // factorization
-    //
-    DSYTRF(&uplo, &N, M_->local_data(), &lda, ipiv, dwork->local_data(), &lwork, &info);
-    if(info < 0) {
-      nlp_->log->printf(hovError, "hiopLinSolverSymDense error: %d argument to dsytrf has an illegal value.\n", -info);
-      return -1;
-    } else {
-      if(info > 0) {
-        nlp_->log->printf(hovWarning,
-                          "hiopLinSolverSymDense error: %d entry in the factorization's diagonal\n"
-                          "is exactly zero. Division by zero will occur if it a solve is attempted.\n",
-                          info);
-        // matrix is singular
+      //
+      // factorization
+      //
+      DSYTRF(&uplo, &N, M_->local_data(), &lda, ipiv, dwork->local_data(), &lwork, &info);
+      if(info < 0) {
+        nlp_->log->printf(hovError, "hiopLinSolverSymDense error: %d argument to dsytrf has an illegal value.\n", -info);
         return -1;
+      } else {
+        if(info > 0) {
+          nlp_->log->printf(hovWarning,
+                            "hiopLinSolverSymDense error: %d entry in the factorization's diagonal\n"
+                            "is exactly zero. Division by zero will occur if it a solve is attempted.\n",
+                            info);
+          // matrix is singular
+          return -1;
+        }
       }
+      assert(info == 0);
     }
-    assert(info == 0);
-    nlp_->runStats.linsolv.tmFactTime.stop();
 
-    nlp_->runStats.linsolv.tmInertiaComp.start();
+    hiopTimerScope tm_inertia(nlp_->runStats.linsolv.tmInertiaComp);
     //
     // Compute the inertia. Only negative eigenvalues are returned.
     // Code originally written by M. Schanenfor PIPS based on
@@ -160,7 +162,6 @@ public:
       }
     }
     // printf("(pos,null,neg)=(%d,%d,%d)\n", posEigVal, nullEigVal, negEigVal);
-    nlp_->runStats.linsolv.tmInertiaComp.stop();
 
     if(nullEigVal > 0) return -1;
     return negEigVal;
@@ -247,6 +247,79 @@ bool hiopLinSolverSymSparseMA57::solve(hiopVector& x_in)
   return info_[0] == 0;
 }
 
+bool hiopLinSolverSymSparseMA57::solve(hiopMatrix& X)
+{
+  assert(n_ == M_->n() && M_->n() == M_->m());
+  hiopMatrixDense* Xd = dynamic_cast<hiopMatrixDense*>(&X);
+  assert(Xd && "only dense right-hand sides are supported");
+  assert(nullptr == Xd || Xd->n() == n_);
+  if(nullptr == Xd || Xd->n() != n_) {
+    return false;
+  }
+  int nrhs = Xd->get_local_size_m();
+  if(0 == nrhs || 0 == n_) {
+    return true;
+  }
+
+  nlp_->runStats.linsolv.tmTriuSolves.start();
+
+  // the rows of the (row-major) X are the columns of the column-major n_ x nrhs array expected by MA57CD
+  double* dX = Xd->local_data();
+  const size_t len = static_cast<size_t>(n_) * nrhs;
+  resid_nrhs_.assign(dX, dX + len);
+  dwork_nrhs_.resize(len);
+  int lw = static_cast<int>(len);
+  int job = 1;
+
+  MA57CD(&job, &n_, fact_, &lfact_, ifact_, &lifact_, &nrhs, dX, &n_, dwork_nrhs_.data(), &lw, iwork_, icntl_, info_);
+
+  if(info_[0] >= 0) {
+    // one step of iterative refinement: R = B - A*X (A is given by its lower triangle), A*D = R, and X = X + D
+    const double* Mvals = get_triplet_values_array();
+    for(int c = 0; c < nrhs; c++) {
+      const double* x = dX + static_cast<size_t>(c) * n_;
+      double* r = resid_nrhs_.data() + static_cast<size_t>(c) * n_;
+      for(int k = 0; k < nnz_; k++) {
+        const int i = irowM_[k] - 1;
+        const int j = jcolM_[k] - 1;
+        r[i] -= Mvals[k] * x[j];
+        if(i != j) {
+          r[j] -= Mvals[k] * x[i];
+        }
+      }
+    }
+    MA57CD(&job,
+           &n_,
+           fact_,
+           &lfact_,
+           ifact_,
+           &lifact_,
+           &nrhs,
+           resid_nrhs_.data(),
+           &n_,
+           dwork_nrhs_.data(),
+           &lw,
+           iwork_,
+           icntl_,
+           info_);
+    if(info_[0] >= 0) {
+      for(size_t e = 0; e < len; e++) {
+        dX[e] += resid_nrhs_[e];
+      }
+    }
+  }
+
+  if(info_[0] < 0) {
+    nlp_->log->printf(hovError, "hiopLinSolverSymSparseMA57: MA57 returned error %d\n", info_[0]);
+  } else if(info_[0] > 0) {
+    nlp_->log->printf(hovError, "hiopLinSolverSymSparseMA57: MA57 returned warning %d\n", info_[0]);
+  }
+
+  nlp_->runStats.linsolv.tmTriuSolves.stop();
+
+  return info_[0] == 0;
+}
+
 bool hiopLinSolverSymSparseMA57::increase_pivot_tol()
 {
   pivot_changed_ = false;
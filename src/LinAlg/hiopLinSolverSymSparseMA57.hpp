@@ -54,6 +54,8 @@
 #include "hiopMatrixSparseCSRSeq.hpp"
 #include "FortranCInterface.hpp"
 
+#include <vector>
+
 #define MA57ID FC_GLOBAL(ma57id, MA57ID)
 #define MA57AD FC_GLOBAL(ma57ad, MA57AD)
 #define MA57BD FC_GLOBAL(ma57bd, MA57BD)
@@ -180,6 +182,12 @@ public:
    * exit is contains the solution(s).  */
   bool solve(hiopVector& x_);
 
+  /**
+   * Solves with the rows of the dense matrix `X` as right-hand sides with one call to MA57CD, followed by one step
+   * of iterative refinement for all right-hand sides (as done by MA57DD in the single right-hand side solve).
+   */
+  bool solve(hiopMatrix& X);
+
 protected:
   /**
    * Fill `irowM_` and `jcolM_` by copying row and col indexes from the member matrix `M_`. Overridden by
@@ -242,6 +250,12 @@ protected:
   /// Working array used for residual computation
   hiopVector* resid_;
 
+  /// Residuals (and corrections) of the iterative refinement of the multiple right-hand sides solve
+  std::vector<double> resid_nrhs_;
+
+  /// Work array of MA57CD for multiple right-hand sides
+  std::vector<double> dwork_nrhs_;
+
   /// parameters to control pivoting
   double pivot_tol_;
   double pivot_max_;
@@ -1,4 +1,7 @@
 #include "hiopLinSolverUMFPACKZ.hpp"
+#include "hiopOMP.hpp"
+
+#include <algorithm>
 
 namespace hiop
 {
@@ -7,10 +10,10 @@ hiopLinSolverUMFPACKZ::hiopLinSolverUMFPACKZ(hiopMatrixComplexSparseTriplet& sys
       m_numeric(nullptr),
       m_null(nullptr),
       nlp(nlp_),
-      sys_mat(sysmat)
+      sys_mat(&sysmat)
 {
-  n = sys_mat.n();
-  nnz = sys_mat.numberOfNonzeros();
+  n = sys_mat->n();
+  nnz = sys_mat->numberOfNonzeros();
 
   m_colptr = new int[n + 1];
   m_rowidx = new int[nnz];
@@ -37,12 +40,12 @@ hiopLinSolverUMFPACKZ::hiopLinSolverUMFPACKZ(hiopMatrixComplexSparseTriplet& sys
 hiopLinSolverUMFPACKZ::~hiopLinSolverUMFPACKZ()
 {
   if(m_symbolic) {
-    umfpack_di_free_symbolic(&m_symbolic);
+    umfpack_zi_free_symbolic(&m_symbolic);
     m_symbolic = NULL;
   }
 
   if(m_numeric) {
-    umfpack_di_free_numeric(&m_numeric);
+    umfpack_zi_free_numeric(&m_numeric);
     m_numeric = NULL;
   }
 
@@ -52,10 +55,26 @@ hiopLinSolverUMFPACKZ::~hiopLinSolverUMFPACKZ()
   // delete[] m_valsim;
 }
 
+void hiopLinSolverUMFPACKZ::set_sys_mat(const hiopMatrixComplexSparseTriplet& sysmat)
+{
+  sys_mat = &sysmat;
+  if(n != sys_mat->n() || nnz != sys_mat->numberOfNonzeros()) {
+    n = sys_mat->n();
+    nnz = sys_mat->numberOfNonzeros();
+
+    delete[] m_colptr;
+    delete[] m_rowidx;
+    delete[] m_vals;
+    m_colptr = new int[n + 1];
+    m_rowidx = new int[nnz];
+    m_vals = new double[2 * nnz];
+  }
+}
+
 int hiopLinSolverUMFPACKZ::matrixChanged()
 {
-  assert(n == sys_mat.n());
-  assert(nnz == sys_mat.numberOfNonzeros());
+  assert(n == sys_mat->n());
+  assert(nnz == sys_mat->numberOfNonzeros());
   // UMFPACK does not handle zero-dimensioned arrays
   if(n == 0) return 0;
   int status;
@@ -63,9 +82,9 @@ int hiopLinSolverUMFPACKZ::matrixChanged()
   //
   // copy from sys_mat triplets to UMFPACK's column form sparse format
   //
-  const int* irow = sys_mat.storage()->i_row();
-  const int* jcol = sys_mat.storage()->j_col();
-  const std::complex<double>* M = sys_mat.storage()->M();
+  const int* irow = sys_mat->storage()->i_row();
+  const int* jcol = sys_mat->storage()->j_col();
+  const std::complex<double>* M = sys_mat->storage()->M();
 
   // Note: sys_mat is ordered on (i,j) (first on i and then on j)
   // but we'll just use the umfpack's conversion routine
@@ -103,18 +122,38 @@ int hiopLinSolverUMFPACKZ::matrixChanged()
     // umfpack_zi_report_matrix (n, n, m_colptr, m_rowidx, m_vals, (double*) NULL, 1, m_control) ;
   }
 
-  status = umfpack_zi_symbolic(n, n, m_colptr, m_rowidx, m_vals, (double*)NULL, &m_symbolic, m_control, m_info);
-  if(status < 0) {
-    // printf("[start]report info on symbolic factorization\n");
-    umfpack_zi_report_info(m_control, m_info);
-    // printf("[done ]report info on symbolic factorization\n");
+  // the symbolic analysis depends only on the pattern (the column form has the duplicates summed up)
+  const int nnz_col = m_colptr[n];
+  const bool same_pattern = nullptr != m_symbolic && sym_colptr_.size() == static_cast<size_t>(n + 1) &&
+                            sym_rowidx_.size() == static_cast<size_t>(nnz_col) &&
+                            std::equal(sym_colptr_.begin(), sym_colptr_.end(), m_colptr) &&
+                            std::equal(sym_rowidx_.begin(), sym_rowidx_.end(), m_rowidx);
+  if(!same_pattern) {
+    if(m_symbolic) {
+      umfpack_zi_free_symbolic(&m_symbolic);
+      m_symbolic = NULL;
+    }
+    status = umfpack_zi_symbolic(n, n, m_colptr, m_rowidx, m_vals, (double*)NULL, &m_symbolic, m_control, m_info);
+    if(status < 0) {
+      // printf("[start]report info on symbolic factorization\n");
+      umfpack_zi_report_info(m_control, m_info);
+      // printf("[done ]report info on symbolic factorization\n");
 
-    umfpack_zi_report_status(m_control, status);
-    printf("UMFPACK: error in the symbolic factorization: status=%d\n", status);
-    return -1;
+      umfpack_zi_report_status(m_control, status);
+      printf("UMFPACK: error in the symbolic factorization: status=%d\n", status);
+      sym_colptr_.clear();
+      sym_rowidx_.clear();
+      return -1;
+    }
+    // umfpack_zi_report_symbolic (m_symbolic, m_control) ;
+    sym_colptr_.assign(m_colptr, m_colptr + n + 1);
+    sym_rowidx_.assign(m_rowidx, m_rowidx + nnz_col);
   }
-  // umfpack_zi_report_symbolic (m_symbolic, m_control) ;
 
+  if(m_numeric) {
+    umfpack_zi_free_numeric(&m_numeric);
+    m_numeric = NULL;
+  }
   status = umfpack_zi_numeric(m_colptr, m_rowidx, m_vals, (double*)NULL, m_symbolic, &m_numeric, m_control, m_info);
   if(status < 0) {
     umfpack_zi_report_info(m_control, m_info);
@@ -158,6 +197,48 @@ bool hiopLinSolverUMFPACKZ::solve(const std::complex<double>* rhs_in, std::compl
   // printf("solve %d -> abs resid abs nrm: %g\n", col_current, resnrm);
 }
 
+bool hiopLinSolverUMFPACKZ::solve(const std::complex<double>* rhs_in, std::complex<double>* x, int nrhs)
+{
+  if(n == 0 || nrhs == 0) return true;
+
+  // independent solves with the same (read-only) numeric factorization; each thread has its own info array
+  std::vector<int> status(nrhs, 0);
+#ifdef HIOP_USE_OPENMP
+#pragma omp parallel if(omp::use_threads(static_cast<size_type>(n) * nrhs)) num_threads(omp::get_num_threads())
+#endif
+  {
+    double info[UMFPACK_INFO];
+#ifdef HIOP_USE_OPENMP
+#pragma omp for schedule(dynamic, 4)
+#endif
+    for(int col = 0; col < nrhs; col++) {
+      const double* rhs = reinterpret_cast<const double*>(rhs_in + static_cast<size_t>(col) * n);
+      double* sol = reinterpret_cast<double*>(x + static_cast<size_t>(col) * n);
+      status[col] = umfpack_zi_solve(UMFPACK_A,
+                                     m_colptr,
+                                     m_rowidx,
+                                     m_vals,
+                                     (double*)NULL,
+                                     sol,
+                                     (double*)NULL,
+                                     rhs,
+                                     (double*)NULL,
+                                     m_numeric,
+                                     m_control,
+                                     info);
+    }
+  }
+
+  for(int col = 0; col < nrhs; col++) {
+    if(status[col] < 0) {
+      umfpack_zi_report_status(m_control, status[col]);
+      printf("umfpack_zi_solve failed for rhs=%d\n", col);
+      return false;
+    }
+  }
+  return true;
+}
+
 bool hiopLinSolverUMFPACKZ::solve(hiopVector& x)
 {
   assert(false && "not yet implemented");  // not needed; also there is no complex vector at this point
@@ -187,73 +268,81 @@ bool hiopLinSolverUMFPACKZ::solve(const hiopMatrixComplexSparseTriplet& B, hiopM
   const int B_nnz = B.numberOfNonzeros();
   std::complex<double>** X_M = X.get_M();
 
-  double rhs[2 * n];
-  double sol[2 * n];
-
-  // Columns of B need to be copied into the rhs array.
-  // B is triplet format, ordered after rows then after cols.
-  // To avoid scanning B for each rhs / column of B, we keep indexes (array
-  // of size n) of each of (i, col) of the last seen column 'col' in B_irow and B_jcol
-
-  int idxsB_col[n];
-  idxsB_col[0] = 0;
+  // Columns of B need to be copied into the rhs arrays. B is in triplet format, ordered after rows
+  // then after cols, so its entries are first bucketed by column (in row order within a column).
+  std::vector<int> B_colptr(nrhs + 1, 0);
+  for(int k = 0; k < B_nnz; k++) {
+    assert(B_jcol[k] >= 0 && B_jcol[k] < nrhs);
+    B_colptr[B_jcol[k] + 1]++;
+  }
+  for(int col = 0; col < nrhs; col++) {
+    B_colptr[col + 1] += B_colptr[col];
+  }
+  std::vector<int> B_colidx(B_nnz);
+  {
+    std::vector<int> next(B_colptr.begin(), B_colptr.end() - 1);
+    for(int k = 0; k < B_nnz; k++) {
+      B_colidx[next[B_jcol[k]]++] = k;
+    }
+  }
 
-  int status;
-  for(int col_current = 0; col_current < nrhs; col_current++) {
-    // update idxB_col
-    for(int row = 0; row < n; row++) {
-      if(row != 0) idxsB_col[row] = idxsB_col[row - 1];
-
-      assert(idxsB_col[row] <= B_nnz);
-      // skip all elems in previous rows
-      while(idxsB_col[row] < B_nnz && B_irow[idxsB_col[row]] < row) {
-        idxsB_col[row]++;
-      }
-      // skip elems in current row till 'col_current' is found or an higher column
-      // is found, which means elem at (row,col_current) is 0.0
-      while(idxsB_col[row] < B_nnz && B_irow[idxsB_col[row]] == row && B_jcol[idxsB_col[row]] < col_current) {
-        idxsB_col[row]++;
+  // The columns are independent solves with the same (read-only) numeric factorization. Each thread
+  // has its own rhs, solution and info arrays and takes the columns in small blocks.
+  std::vector<int> status(nrhs, 0);
+#ifdef HIOP_USE_OPENMP
+#pragma omp parallel if(omp::use_threads(static_cast<size_type>(n) * nrhs)) num_threads(omp::get_num_threads())
+#endif
+  {
+    std::vector<double> rhs(2 * n, 0.);
+    std::vector<double> sol(2 * n);
+    double info[UMFPACK_INFO];
+
+#ifdef HIOP_USE_OPENMP
+#pragma omp for schedule(dynamic, 4)
+#endif
+    for(int col_current = 0; col_current < nrhs; col_current++) {
+      for(int p = B_colptr[col_current]; p < B_colptr[col_current + 1]; p++) {
+        const int k = B_colidx[p];
+        rhs[2 * B_irow[k]] = B_M[k].real();
+        rhs[2 * B_irow[k] + 1] = B_M[k].imag();
       }
-      assert(idxsB_col[row] <= B_nnz);
 
-      if(idxsB_col[row] < B_nnz && B_irow[idxsB_col[row]] == row && B_jcol[idxsB_col[row]] == col_current) {
-        rhs[2 * row] = B_M[idxsB_col[row]].real();
-        rhs[2 * row + 1] = B_M[idxsB_col[row]].imag();
-      } else {
-        rhs[2 * row] = rhs[2 * row + 1] = 0.;
+      // solve for rhs. NULL pointers mean we work with packed complex arrays (re and imag
+      // are interleaved contiguously)
+      status[col_current] = umfpack_zi_solve(UMFPACK_A,
+                                             m_colptr,
+                                             m_rowidx,
+                                             m_vals,
+                                             (double*)NULL,
+                                             sol.data(),
+                                             (double*)NULL,
+                                             rhs.data(),
+                                             (double*)NULL,
+                                             m_numeric,
+                                             m_control,
+                                             info);
+
+      // norm of residual
+      // double resnrm = resid_abs_norm(n, m_colptr, m_rowidx, m_vals, sol, rhs);
+      // printf("solve %d -> abs resid abs nrm: %g\n", col_current, resnrm);
+
+      // copy to X and reset the rhs for the next column
+      for(int row = 0; row < n; row++) {
+        X_M[row][col_current] = std::complex<double>(sol[2 * row], sol[2 * row + 1]);
       }
-    }
+      for(int p = B_colptr[col_current]; p < B_colptr[col_current + 1]; p++) {
+        rhs[2 * B_irow[B_colidx[p]]] = rhs[2 * B_irow[B_colidx[p]] + 1] = 0.;
+      }
+    }  // end of for loop over columns
+  }
 
-    // solve for rhs. NULL pointers mean we work with packed complex arrays (re and imag
-    // are interleaved contiguously)
-    status = umfpack_zi_solve(UMFPACK_A,
-                              m_colptr,
-                              m_rowidx,
-                              m_vals,
-                              (double*)NULL,
-                              sol,
-                              (double*)NULL,
-                              rhs,
-                              (double*)NULL,
-                              m_numeric,
-                              m_control,
-                              m_info);
-    if(status < 0) {
-      umfpack_zi_report_info(m_control, m_info);
-      umfpack_zi_report_status(m_control, status);
+  for(int col_current = 0; col_current < nrhs; col_current++) {
+    if(status[col_current] < 0) {
+      umfpack_zi_report_status(m_control, status[col_current]);
       printf("eumfpack_zi_solve failed for rhs=%d", col_current);
       return false;
     }
-
-    // norm of residual
-    // double resnrm = resid_abs_norm(n, m_colptr, m_rowidx, m_vals, sol, rhs);
-    // printf("solve %d -> abs resid abs nrm: %g\n", col_current, resnrm);
-
-    // copy to X
-    for(int row = 0; row < n; row++) {
-      X_M[row][col_current] = std::complex<double>(sol[2 * row], sol[2 * row + 1]);
-    }
-  }  // end of for loop over columns
+  }
   return true;
   //   printf ("\nx (solution of Ax=b): ") ;
   //   (void) umfpack_zi_report_vector (n, x, xz, Control) ;
@@ -56,6 +56,8 @@
 #include "hiopMatrixComplexSparseTriplet.hpp"
 #include "hiopMatrixComplexDense.hpp"
 
+#include <vector>
+
 namespace hiop
 {
 /*
@@ -71,19 +73,31 @@ public:
   virtual ~hiopLinSolverUMFPACKZ();
 
   /** Triggers a refactorization of the matrix, if necessary.
-   * Returns -1 if trouble in factorization is encountered. */
+   * Returns -1 if trouble in factorization is encountered.
+   *
+   * The symbolic analysis is redone only when the sparsity pattern changed since the last call, so that
+   * sequences of matrices with the same pattern are only refactorized numerically. */
   virtual int matrixChanged();
 
+  /** Sets the matrix to be factorized by the next `matrixChanged`; the symbolic analysis of the previous
+   * matrix is reused if the two matrices have the same sparsity pattern. */
+  void set_sys_mat(const hiopMatrixComplexSparseTriplet& sysmat);
+
   /** solves a linear system.
    * param 'x' is on entry the right hand side(s) of the system to be solved. On
    * exit is contains the solution(s).  */
   virtual bool solve(hiopVector& x);
   virtual bool solve(hiopMatrix& X);
+  /** solves for the columns of B; the columns are solved in parallel when HiOp is built with OpenMP */
   virtual bool solve(const hiopMatrixComplexSparseTriplet& B, hiopMatrixComplexDense& X);
 
   /** same as above but right-side and solution are separated */
   virtual bool solve(const std::complex<double>* rhs, std::complex<double>* x);
 
+  /** solves for the `nrhs` columns of the column-major n x nrhs array `rhs` and stores the solutions in the same
+   * layout in `x`; the columns are solved in parallel when HiOp is built with OpenMP */
+  virtual bool solve(const std::complex<double>* rhs, std::complex<double>* x, int nrhs);
+
 private:
   void* m_symbolic;
   void* m_numeric;
@@ -93,9 +107,13 @@ private:
 
   int *m_colptr, *m_rowidx;
   double* m_vals;  // size 2*nnz !!!
-  const hiopMatrixComplexSparseTriplet& sys_mat;
+  const hiopMatrixComplexSparseTriplet* sys_mat;
   int n, nnz;
 
+  // column form of the pattern for which m_symbolic was computed
+  std::vector<int> sym_colptr_;
+  std::vector<int> sym_rowidx_;
+
   double m_control[UMFPACK_CONTROL], m_info[UMFPACK_INFO];
 
 private:
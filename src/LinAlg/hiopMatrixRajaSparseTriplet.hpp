@@ -66,6 +66,7 @@
 
 #include <cassert>
 #include <string>
+#include <unordered_map>
 
 namespace hiop
 {
@@ -396,9 +397,59 @@ protected:
 
   mutable RowStartsInfo* row_starts_;
 
+  /**
+   * Value-permutation map recorded by `copyRowsFrom` and `copyRowsBlockFrom` on the first copy into a
+   * range of nonzeros: `src_idx_[k]` is the source nonzero copied into the nonzero `dest_nnz_st`+k. The
+   * following copies of the same rows of the same source into the same range only gather the values; a copy
+   * of other rows, from another source, or to other rows rebuilds the map. The source is identified by its
+   * pattern id, which is renewed when the methods of the source change its indices.
+   */
+  struct CopyRowsMap
+  {
+    uint64_t src_pattern_id_;  // pattern id of the source matrix
+    size_type src_nnz_;        // number of nonzeros of the source when the map was built
+    size_type n_rows_;         // number of rows copied
+    index_type rows_src_st_;   // first source row (`copyRowsBlockFrom`)
+    index_type rows_dest_st_;  // first destination row (`copyRowsBlockFrom`)
+    index_type* rows_idxs_;    // source rows (`copyRowsFrom`), in `mem_space_`; nullptr for `copyRowsBlockFrom`
+    size_type nnz_copy_;       // number of nonzeros copied
+    index_type* src_idx_;      // source nonzero of each copied nonzero, in `mem_space_`
+  };
+  std::unordered_map<size_type, CopyRowsMap> copy_rows_maps_;  // keyed by the first destination nonzero
+
 protected:
   RowStartsInfo* allocAndBuildRowStarts() const;
   RowStartsInfo* allocRowStarts(size_type sz, std::string memspace) const { return new RowStartsInfo(sz, memspace); }
+  /**
+   * @brief Returns the map cached for the nonzeros starting at `dest_nnz_st`, or nullptr if it was built for
+   * another copy. `rows_idxs` (in `mem_space_`) is nullptr for `copyRowsBlockFrom`.
+   */
+  const CopyRowsMap* find_copy_rows_map(size_type dest_nnz_st,
+                                        const hiopMatrix& src,
+                                        size_type n_rows,
+                                        index_type rows_src_st,
+                                        index_type rows_dest_st,
+                                        const index_type* rows_idxs) const;
+  /**
+   * @brief Allocates (in `mem_space_`) and registers the map for the nonzeros starting at `dest_nnz_st`,
+   * replacing the previous one
+   */
+  CopyRowsMap& alloc_copy_rows_map(size_type dest_nnz_st,
+                                   const hiopMatrix& src,
+                                   size_type n_rows,
+                                   index_type rows_src_st,
+                                   index_type rows_dest_st,
+                                   const index_type* rows_idxs,
+                                   size_type nnz_copy);
+  /// @brief Deallocates the arrays of `map`
+  void free_copy_rows_map(CopyRowsMap& map);
+  /// @brief Gathers `values_[dest_nnz_st+k] = values_src[map.src_idx_[k]]`
+  void copy_values_w_map(const CopyRowsMap& map, const double* values_src, size_type dest_nnz_st);
+  /**
+   * @brief Called after the indices of the nonzeros were changed: renews the pattern id and discards the
+   * maps of `copyRowsFrom` and `copyRowsBlockFrom`, unless `keep_copy_rows_maps` (used by these methods).
+   */
+  virtual void pattern_changed(bool keep_copy_rows_maps = false);
 
 private:
   hiopMatrixRajaSparseTriplet()
@@ -481,6 +532,12 @@ public:
   virtual void set_Hess_FR(const hiopMatrixSparse& Hess, int* iHSS, int* jHSS, double* MHSS, const hiopVector& add_diag);
 
 protected:
+  virtual void pattern_changed(bool keep_copy_rows_maps = false)
+  {
+    hiopMatrixRajaSparseTriplet<MEMBACKEND, EXECPOLICYRAJA>::pattern_changed(keep_copy_rows_maps);
+    nnz_offdiag_ = -1;
+  }
+
   mutable int nnz_offdiag_;  ///< number of nonzero entries
 };
 }  // namespace hiop
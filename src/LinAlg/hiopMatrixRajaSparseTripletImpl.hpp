@@ -121,6 +121,9 @@ hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::~hiopMatrixRajaSparseTripl
   umpire::Allocator devAlloc = resmgr.getAllocator(mem_space_);
   umpire::Allocator hostAlloc = resmgr.getAllocator("HOST");
 
+  for(auto& it: copy_rows_maps_) {
+    free_copy_rows_map(it.second);
+  }
   devAlloc.deallocate(iRow_);
   devAlloc.deallocate(jCol_);
   devAlloc.deallocate(values_);
@@ -420,14 +423,21 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copySubDiagonalFrom(c
   index_type* jCol = jCol_;
   double* values = values_;
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(0, num_elems),
       RAJA_LAMBDA(RAJA::Index_type row_src) {
         const index_type row_dest = row_src + start_on_dest_diag;
         const index_type nnz_dest = row_src + start_on_nnz_idx;
+        if(iRow[nnz_dest] != row_dest || jCol[nnz_dest] != row_dest) {
+          n_changed += 1;
+        }
         iRow[nnz_dest] = jCol[nnz_dest] = row_dest;
         values[nnz_dest] = scal * v[row_src];
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 }
 
 /// @brief: set a subdiagonal block, whose diagonal values are set to `c`
@@ -445,15 +455,22 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::setSubDiagonalTo(cons
   index_type* jCol = jCol_;
   double* values = values_;
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(0, num_elems),
       RAJA_LAMBDA(RAJA::Index_type row_src) {
         const index_type row_dest = row_src + start_on_dest_diag;
         const index_type nnz_dest = row_src + start_on_nnz_idx;
+        if(iRow[nnz_dest] != row_dest || jCol[nnz_dest] != row_dest) {
+          n_changed += 1;
+        }
         iRow[nnz_dest] = row_dest;
         jCol[nnz_dest] = row_dest;
         values[nnz_dest] = c;
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 }
 
 template<class MEMBACKEND, class RAJAEXECPOL>
@@ -951,6 +968,13 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsFrom(const hi
   const int* jCol_src = src.j_col();
   const double* values_src = src.M();
 
+  // the pattern was copied in a previous call, only the values need to be gathered
+  const CopyRowsMap* map = find_copy_rows_map(0, src, n_rows, 0, 0, rows_idxs);
+  if(map) {
+    copy_values_w_map(*map, values_src, 0);
+    return;
+  }
+
   if(src.row_starts_ == nullptr) {
     src.row_starts_ = src.allocAndBuildRowStarts();
   }
@@ -960,37 +984,37 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsFrom(const hi
   index_type* iRow = iRow_;
   index_type* jCol = jCol_;
   double* values = values_;
+  index_type* src_idx = alloc_copy_rows_map(0, src, n_rows, 0, 0, rows_idxs, nnz_).src_idx_;
 
-  // this function only set up sparsity in the first run. Sparsity won't change after the first run.
-  if(row_starts_ == nullptr) {
-    row_starts_ = new RowStartsInfo(nrows_, mem_space_);
-    assert(row_starts_);
+  // the destination row starts follow the rows copied, hence are rebuilt with the map
+  delete row_starts_;
+  row_starts_ = new RowStartsInfo(nrows_, mem_space_);
+  assert(row_starts_);
 
-    //
-    // The latest CPU code can be found in 342eb99ec16d45f57a492be1bf1e39cce73995a5
-    // It is replaced by RAJA::inclusive_scan after that commit
-    //
-    index_type* src_row_st = src.row_starts_->idx_start_;
-    index_type* dst_row_st_init = row_starts_->idx_start_;
+  //
+  // The latest CPU code can be found in 342eb99ec16d45f57a492be1bf1e39cce73995a5
+  // It is replaced by RAJA::inclusive_scan after that commit
+  //
+  index_type* src_row_st = src.row_starts_->idx_start_;
+  index_type* dst_row_st_init = row_starts_->idx_start_;
 
-    RAJA::forall<hiop_raja_exec>(
-        RAJA::RangeSegment(0, n_rows + 1),
-        RAJA_LAMBDA(RAJA::Index_type i) { dst_row_st_init[i] = 0; });
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, n_rows + 1),
+      RAJA_LAMBDA(RAJA::Index_type i) { dst_row_st_init[i] = 0; });
 
-    // comput nnz in each row from source
-    RAJA::forall<hiop_raja_exec>(
-        RAJA::RangeSegment(0, n_rows),
-        RAJA_LAMBDA(RAJA::Index_type row_dst) {
-          const index_type row_src = rows_idxs[row_dst];
-          dst_row_st_init[row_dst + 1] = src_row_st[row_src + 1] - src_row_st[row_src];
-        });
-    RAJA::inclusive_scan_inplace<hiop_raja_exec>(RAJA::make_span(dst_row_st_init, n_rows + 1),
-                                                 RAJA::operators::plus<index_type>());
-  }
+  // comput nnz in each row from source
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, n_rows),
+      RAJA_LAMBDA(RAJA::Index_type row_dst) {
+        const index_type row_src = rows_idxs[row_dst];
+        dst_row_st_init[row_dst + 1] = src_row_st[row_src + 1] - src_row_st[row_src];
+      });
+  RAJA::inclusive_scan_inplace<hiop_raja_exec>(RAJA::make_span(dst_row_st_init, n_rows + 1),
+                                               RAJA::operators::plus<index_type>());
 
   index_type* dst_row_st = row_starts_->idx_start_;
-  index_type* src_row_st = src.row_starts_->idx_start_;
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(0, n_rows),
       RAJA_LAMBDA(RAJA::Index_type row_dst) {
@@ -1000,6 +1024,10 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsFrom(const hi
 
         // copy from src
         while(k_src < src_row_st[row_src + 1]) {
+          src_idx[k_dst] = k_src;
+          if(iRow[k_dst] != row_dst || jCol[k_dst] != jCol_src[k_src]) {
+            n_changed += 1;
+          }
           iRow[k_dst] = row_dst;
           jCol[k_dst] = jCol_src[k_src];
           values[k_dst] = values_src[k_src];
@@ -1007,6 +1035,9 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsFrom(const hi
           k_src++;
         }
       });
+  if(n_changed.get() > 0) {
+    pattern_changed(true);
+  }
 }
 
 /**
@@ -1037,6 +1068,13 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsBlockFrom(con
   const index_type* jCol_src = src.j_col();
   const double* values_src = src.M();
 
+  // the pattern was copied in a previous call, only the values need to be gathered
+  const CopyRowsMap* map = find_copy_rows_map(dest_nnz_st, src, n_rows, rows_src_idx_st, rows_dst_idx_st, nullptr);
+  if(map) {
+    copy_values_w_map(*map, values_src, dest_nnz_st);
+    return;
+  }
+
   // local copy of member variable/function, for RAJA access
   index_type* iRow = iRow_;
   index_type* jCol = jCol_;
@@ -1050,6 +1088,13 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsBlockFrom(con
 
   index_type* src_row_st = src.row_starts_->idx_start_;
 
+  // the row starts of 'src' may have been built on the device, hence refresh the host mirror
+  src.row_starts_->copy_from_dev();
+  const index_type* src_row_st_host = src.row_starts_->idx_start_host_;
+  const size_type nnz_copy = src_row_st_host[rows_src_idx_st + n_rows] - src_row_st_host[rows_src_idx_st];
+  index_type* src_idx =
+      alloc_copy_rows_map(dest_nnz_st, src, n_rows, rows_src_idx_st, rows_dst_idx_st, nullptr, nnz_copy).src_idx_;
+
   //
   // The latest CPU code can be found in 342eb99ec16d45f57a492be1bf1e39cce73995a5
   // It is replaced by RAJA::inclusive_scan after that commit
@@ -1090,6 +1135,7 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsBlockFrom(con
 
   index_type* dst_row_st = row_starts_->idx_start_;
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(0, n_rows),
       RAJA_LAMBDA(RAJA::Index_type row_add) {
@@ -1100,6 +1146,10 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsBlockFrom(con
 
         // copy from src
         while(k_src < src_row_st[row_src + 1]) {
+          src_idx[k_dst - dest_nnz_st] = k_src;
+          if(iRow[k_dst] != row_dst || jCol[k_dst] != jCol_src[k_src]) {
+            n_changed += 1;
+          }
           iRow[k_dst] = row_dst;
           jCol[k_dst] = jCol_src[k_src];
           values[k_dst] = values_src[k_src];
@@ -1107,9 +1157,131 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyRowsBlockFrom(con
           k_src++;
         }
       });
+  if(n_changed.get() > 0) {
+    pattern_changed(true);
+  }
   //  delete [] next_row_nnz;
 }
 
+template<class MEMBACKEND, class RAJAEXECPOL>
+const typename hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::CopyRowsMap*
+hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::find_copy_rows_map(size_type dest_nnz_st,
+                                                                         const hiopMatrix& src,
+                                                                         size_type n_rows,
+                                                                         index_type rows_src_st,
+                                                                         index_type rows_dest_st,
+                                                                         const index_type* rows_idxs) const
+{
+  auto it = copy_rows_maps_.find(dest_nnz_st);
+  if(it == copy_rows_maps_.end()) {
+    return nullptr;
+  }
+  const CopyRowsMap& map = it->second;
+  const hiopMatrixSparse& src_sp = dynamic_cast<const hiopMatrixSparse&>(src);
+  if(map.src_pattern_id_ != src_sp.get_pattern_id() || map.src_nnz_ != src_sp.numberOfNonzeros() ||
+     map.n_rows_ != n_rows || map.rows_src_st_ != rows_src_st || map.rows_dest_st_ != rows_dest_st) {
+    return nullptr;
+  }
+  if(nullptr == rows_idxs || nullptr == map.rows_idxs_) {
+    return (nullptr == rows_idxs && nullptr == map.rows_idxs_) ? &map : nullptr;
+  }
+
+  const index_type* rows_idxs_map = map.rows_idxs_;
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_diff(0);
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, n_rows),
+      RAJA_LAMBDA(RAJA::Index_type i) {
+        if(rows_idxs_map[i] != rows_idxs[i]) {
+          n_diff += 1;
+        }
+      });
+  return 0 == n_diff.get() ? &map : nullptr;
+}
+
+template<class MEMBACKEND, class RAJAEXECPOL>
+typename hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::CopyRowsMap&
+hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::alloc_copy_rows_map(size_type dest_nnz_st,
+                                                                          const hiopMatrix& src,
+                                                                          size_type n_rows,
+                                                                          index_type rows_src_st,
+                                                                          index_type rows_dest_st,
+                                                                          const index_type* rows_idxs,
+                                                                          size_type nnz_copy)
+{
+  auto& resmgr = umpire::ResourceManager::getInstance();
+  umpire::Allocator devAlloc = resmgr.getAllocator(mem_space_);
+
+  // a copy of selected rows overwrites all the nonzeros, hence the maps of the other copies
+  for(auto it = copy_rows_maps_.begin(); it != copy_rows_maps_.end();) {
+    if(nullptr != rows_idxs || it->first == dest_nnz_st || (0 == it->first && nullptr != it->second.rows_idxs_)) {
+      free_copy_rows_map(it->second);
+      it = copy_rows_maps_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  CopyRowsMap& map = copy_rows_maps_[dest_nnz_st];
+  const hiopMatrixSparse& src_sp = dynamic_cast<const hiopMatrixSparse&>(src);
+  map.src_pattern_id_ = src_sp.get_pattern_id();
+  map.src_nnz_ = src_sp.numberOfNonzeros();
+  map.n_rows_ = n_rows;
+  map.rows_src_st_ = rows_src_st;
+  map.rows_dest_st_ = rows_dest_st;
+  map.rows_idxs_ = nullptr;
+  if(rows_idxs) {
+    map.rows_idxs_ = static_cast<index_type*>(devAlloc.allocate(n_rows * sizeof(index_type)));
+    index_type* rows_idxs_map = map.rows_idxs_;
+    RAJA::forall<hiop_raja_exec>(
+        RAJA::RangeSegment(0, n_rows),
+        RAJA_LAMBDA(RAJA::Index_type i) { rows_idxs_map[i] = rows_idxs[i]; });
+  }
+  map.nnz_copy_ = nnz_copy;
+  map.src_idx_ = static_cast<index_type*>(devAlloc.allocate(nnz_copy * sizeof(index_type)));
+  return map;
+}
+
+template<class MEMBACKEND, class RAJAEXECPOL>
+void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::free_copy_rows_map(CopyRowsMap& map)
+{
+  auto& resmgr = umpire::ResourceManager::getInstance();
+  umpire::Allocator devAlloc = resmgr.getAllocator(mem_space_);
+  if(map.rows_idxs_ != nullptr) {
+    devAlloc.deallocate(map.rows_idxs_);
+    map.rows_idxs_ = nullptr;
+  }
+  if(map.src_idx_ != nullptr) {
+    devAlloc.deallocate(map.src_idx_);
+    map.src_idx_ = nullptr;
+  }
+}
+
+template<class MEMBACKEND, class RAJAEXECPOL>
+void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::pattern_changed(bool keep_copy_rows_maps)
+{
+  if(!keep_copy_rows_maps) {
+    for(auto& it: copy_rows_maps_) {
+      free_copy_rows_map(it.second);
+    }
+    copy_rows_maps_.clear();
+  }
+  this->renew_pattern_id();
+}
+
+template<class MEMBACKEND, class RAJAEXECPOL>
+void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copy_values_w_map(const CopyRowsMap& map,
+                                                                             const double* values_src,
+                                                                             size_type dest_nnz_st)
+{
+  assert(dest_nnz_st + map.nnz_copy_ <= nnz_);
+  const index_type* src_idx = map.src_idx_;
+  double* values_dest = values_ + dest_nnz_st;
+
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, map.nnz_copy_),
+      RAJA_LAMBDA(RAJA::Index_type k) { values_dest[k] = values_src[src_idx[k]]; });
+}
+
 /// @brief Prints the contents of this function to a file.
 template<class MEMBACKEND, class RAJAEXECPOL>
 void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::print(FILE* file,
@@ -1278,6 +1450,7 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Jac_FR(const hiop
     int* jCol = jCol_;
 
     // Jac for c(x) - p + n
+    RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
     RAJA::forall<hiop_raja_exec>(
         RAJA::RangeSegment(0, m_c),
         RAJA_LAMBDA(RAJA::Index_type i) {
@@ -1286,6 +1459,9 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Jac_FR(const hiop
 
           // copy from base Jac_c
           while(k_base < Jc_row_st[i + 1]) {
+            if(iRow[k] != i || jCol[k] != jcol_c[k_base]) {
+              n_changed += 1;
+            }
             iRow[k] = iJacS[k] = i;
             jCol[k] = jJacS[k] = jcol_c[k_base];
             k++;
@@ -1293,10 +1469,16 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Jac_FR(const hiop
           }
 
           // extra parts for p and n
+          if(iRow[k] != i || jCol[k] != n_c + i) {
+            n_changed += 1;
+          }
           iRow[k] = iJacS[k] = i;
           jCol[k] = jJacS[k] = n_c + i;
           k++;
 
+          if(iRow[k] != i || jCol[k] != n_c + m_c + i) {
+            n_changed += 1;
+          }
           iRow[k] = iJacS[k] = i;
           jCol[k] = jJacS[k] = n_c + m_c + i;
           k++;
@@ -1311,6 +1493,9 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Jac_FR(const hiop
 
           // copy from base Jac_c
           while(k_base < Jd_row_st[i + 1]) {
+            if(iRow[k] != m_c + i || jCol[k] != jcol_d[k_base]) {
+              n_changed += 1;
+            }
             iRow[k] = iJacS[k] = m_c + i;
             jCol[k] = jJacS[k] = jcol_d[k_base];
             k++;
@@ -1318,14 +1503,23 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Jac_FR(const hiop
           }
 
           // extra parts for p and n
+          if(iRow[k] != m_c + i || jCol[k] != n_d + 2 * m_c + i) {
+            n_changed += 1;
+          }
           iRow[k] = iJacS[k] = m_c + i;
           jCol[k] = jJacS[k] = n_d + 2 * m_c + i;
           k++;
 
+          if(iRow[k] != m_c + i || jCol[k] != n_d + 2 * m_c + m_d + i) {
+            n_changed += 1;
+          }
           iRow[k] = iJacS[k] = m_c + i;
           jCol[k] = jJacS[k] = n_d + 2 * m_c + m_d + i;
           k++;
         });
+    if(n_changed.get() > 0) {
+      pattern_changed();
+    }
   }
 
   // extend Jac to the p and n parts --- element
@@ -1411,16 +1605,23 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copySubmatrixFrom(con
   index_type* jCol = jCol_;
   double* values = values_;
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(0, src_nnz),
       RAJA_LAMBDA(RAJA::Index_type src_k) {
         if(!offdiag_only || src_iRow[src_k] != src_jCol[src_k]) {
           index_type dest_k = dest_nnz_st + src_k;
+          if(iRow[dest_k] != dest_row_st + src_iRow[src_k] || jCol[dest_k] != dest_col_st + src_jCol[src_k]) {
+            n_changed += 1;
+          }
           iRow[dest_k] = dest_row_st + src_iRow[src_k];
           jCol[dest_k] = dest_col_st + src_jCol[src_k];
           values[dest_k] = src_val[src_k];
         }
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 }
 
 /// @brief copy a submatrix from a transpose of another matrix.
@@ -1451,16 +1652,23 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copySubmatrixFromTran
   index_type* jCol = jCol_;
   double* values = values_;
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(0, src_nnz),
       RAJA_LAMBDA(RAJA::Index_type src_k) {
         if(!offdiag_only || src_iRow[src_k] != src_jCol[src_k]) {
           index_type dest_k = dest_nnz_st + src_k;
+          if(iRow[dest_k] != dest_row_st + src_iRow[src_k] || jCol[dest_k] != dest_col_st + src_jCol[src_k]) {
+            n_changed += 1;
+          }
           iRow[dest_k] = dest_row_st + src_iRow[src_k];
           jCol[dest_k] = dest_col_st + src_jCol[src_k];
           values[dest_k] = src_val[src_k];
         }
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 }
 
 /**
@@ -1531,6 +1739,7 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::setSubmatrixToConstan
       });
   RAJA::inclusive_scan_inplace<hiop_raja_exec>(RAJA::make_span(row_start_dev, n + 1), RAJA::operators::plus<index_type>());
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(1, n + 1),
       RAJA_LAMBDA(RAJA::Index_type i) {
@@ -1538,11 +1747,17 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::setSubmatrixToConstan
           index_type ele_add = row_start_dev[i] - 1;
           assert(ele_add >= 0 && ele_add < nnz_to_copy);
           index_type itnz_dest = dest_nnz_st + ele_add;
+          if(iRow[itnz_dest] != dest_row_st + i - 1 || jCol[itnz_dest] != dest_col_st + ele_add) {
+            n_changed += 1;
+          }
           iRow[itnz_dest] = dest_row_st + i - 1;
           jCol[itnz_dest] = dest_col_st + ele_add;
           values[itnz_dest] = scalar;
         }
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 
   devalloc.deallocate(row_start_dev);
 }
@@ -1615,6 +1830,7 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::setSubmatrixToConstan
       });
   RAJA::inclusive_scan_inplace<hiop_raja_exec>(RAJA::make_span(row_start_dev, n + 1), RAJA::operators::plus<index_type>());
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(1, n + 1),
       RAJA_LAMBDA(RAJA::Index_type i) {
@@ -1622,11 +1838,17 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::setSubmatrixToConstan
           index_type ele_add = row_start_dev[i] - 1;
           assert(ele_add >= 0 && ele_add < nnz_to_copy);
           index_type itnz_dest = dest_nnz_st + ele_add;
+          if(iRow[itnz_dest] != dest_row_st + ele_add || jCol[itnz_dest] != dest_col_st + i - 1) {
+            n_changed += 1;
+          }
           iRow[itnz_dest] = dest_row_st + ele_add;
           jCol[itnz_dest] = dest_col_st + i - 1;
           values[itnz_dest] = scalar;
         }
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 
   devalloc.deallocate(row_start_dev);
 }
@@ -1656,14 +1878,21 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyDiagMatrixToSubbl
   index_type* jCol = jCol_;
   double* values = values_;
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(0, nnz_to_copy),
       RAJA_LAMBDA(RAJA::Index_type ele_add) {
         index_type itnz_dest = dest_nnz_st + ele_add;
+        if(iRow[itnz_dest] != dest_row_st + ele_add || jCol[itnz_dest] != col_dest_st + ele_add) {
+          n_changed += 1;
+        }
         iRow[itnz_dest] = dest_row_st + ele_add;
         jCol[itnz_dest] = col_dest_st + ele_add;
         values[itnz_dest] = src_val;
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 }
 
 /**
@@ -1737,6 +1966,7 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyDiagMatrixToSubbl
       });
   RAJA::inclusive_scan_inplace<hiop_raja_exec>(RAJA::make_span(row_start_dev, n + 1), RAJA::operators::plus<index_type>());
 
+  RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
   RAJA::forall<hiop_raja_exec>(
       RAJA::RangeSegment(1, n + 1),
       RAJA_LAMBDA(RAJA::Index_type i) {
@@ -1744,11 +1974,17 @@ void hiopMatrixRajaSparseTriplet<MEMBACKEND, RAJAEXECPOL>::copyDiagMatrixToSubbl
           index_type ele_add = row_start_dev[i] - 1;
           assert(ele_add >= 0 && ele_add < nnz_to_copy);
           index_type itnz_dest = dest_nnz_st + ele_add;
+          if(iRow[itnz_dest] != dest_row_st + ele_add || jCol[itnz_dest] != dest_col_st + ele_add) {
+            n_changed += 1;
+          }
           iRow[itnz_dest] = dest_row_st + ele_add;
           jCol[itnz_dest] = dest_col_st + ele_add;
           values[itnz_dest] = x[i - 1];
         }
       });
+  if(n_changed.get() > 0) {
+    pattern_changed();
+  }
 
   devalloc.deallocate(row_start_dev);
 }
@@ -2019,6 +2255,7 @@ void hiopMatrixRajaSymSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Hess_FR(const
   if(iHSS != nullptr && jHSS != nullptr) {
     int* M1iRow = M1.i_row();
     int* M1jCol = M1.j_col();
+    RAJA::ReduceSum<hiop_raja_reduce, int> n_changed(0);
 
     if(m2 > 0) {
       if(M1.row_starts_ == nullptr) {
@@ -2067,6 +2304,9 @@ void hiopMatrixRajaSymSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Hess_FR(const
             size_type nnz_in_row = M2_row_start[i + 1] - k_base;
 
             // insert diagonal entry due to the new obj term
+            if(M1iRow[k] != i || M1jCol[k] != i) {
+              n_changed += 1;
+            }
             M1iRow[k] = iHSS[k] = i;
             M1jCol[k] = jHSS[k] = i;
             k++;
@@ -2079,6 +2319,9 @@ void hiopMatrixRajaSymSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Hess_FR(const
 
             // copy from base Hess
             while(k_base < M2_row_start[i + 1]) {
+              if(M1iRow[k] != i || M1jCol[k] != M2jCol[k_base]) {
+                n_changed += 1;
+              }
               M1iRow[k] = iHSS[k] = i;
               M1jCol[k] = jHSS[k] = M2jCol[k_base];
               k++;
@@ -2091,10 +2334,16 @@ void hiopMatrixRajaSymSparseTriplet<MEMBACKEND, RAJAEXECPOL>::set_Hess_FR(const
       RAJA::forall<hiop_raja_exec>(
           RAJA::RangeSegment(0, m_row),
           RAJA_LAMBDA(RAJA::Index_type i) {
+            if(M1iRow[i] != i || M1jCol[i] != i) {
+              n_changed += 1;
+            }
             M1iRow[i] = iHSS[i] = i;
             M1jCol[i] = jHSS[i] = i;
           });
     }
+    if(n_changed.get() > 0) {
+      pattern_changed();
+    }
   }
 
   // extend Hess to the p and n parts --- element
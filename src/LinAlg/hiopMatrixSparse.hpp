@@ -55,7 +55,9 @@
 #include "hiopVector.hpp"
 #include "hiopMatrixDense.hpp"
 
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 
 namespace hiop
 {
@@ -70,10 +72,37 @@ public:
   hiopMatrixSparse(int rows, int cols, int nnz)
       : nrows_(rows),
         ncols_(cols),
-        nnz_(nnz)
+        nnz_(nnz),
+        pattern_id_(new_pattern_id())
   {}
+  /// The copy gets a new pattern id
+  hiopMatrixSparse(const hiopMatrixSparse& other)
+      : hiopMatrix(other),
+        nrows_(other.nrows_),
+        ncols_(other.ncols_),
+        nnz_(other.nnz_),
+        pattern_id_(new_pattern_id())
+  {}
+  /// The assigned matrix gets a new pattern id
+  hiopMatrixSparse& operator=(const hiopMatrixSparse& other)
+  {
+    nrows_ = other.nrows_;
+    ncols_ = other.ncols_;
+    nnz_ = other.nnz_;
+    renew_pattern_id();
+    return *this;
+  }
   virtual ~hiopMatrixSparse() {}
 
+  /**
+   * Identifier of the sparsity pattern, unique among the sparse matrices of the process: it is assigned on
+   * construction and renewed when the pattern is declared changed or, for the triplet matrices, rewritten
+   * by the methods that set the row and column indices. Data derived from the pattern of another matrix
+   * (e.g., by `copyRowsFrom`) is validated with it rather than with the address of the matrix, which may be
+   * reused by a new matrix.
+   */
+  inline uint64_t get_pattern_id() const { return pattern_id_; }
+
   virtual void setToZero() = 0;
   virtual void setToConstant(double c) = 0;
   virtual void copyFrom(const hiopMatrixSparse& dm) = 0;
@@ -94,6 +123,9 @@ public:
    * the rows_idx[i]_th row in `src`.
    *
    *  @pre This function does NOT preserve the sorted row/col indices. USE WITH CAUTION!
+   *  @pre The nonzero pattern of `src` does not change between calls unless its pattern id is renewed:
+   *  implementations may set up the sparsity of `this` only in the first call for the same rows of the same
+   *  pattern and copy only the values afterwards.
    */
   virtual void copyRowsFrom(const hiopMatrix& src, const index_type* rows_idxs, size_type n_rows) = 0;
 
@@ -361,10 +393,24 @@ public:
   virtual bool assertSymmetry(double tol = 1e-16) const { return false; }
   virtual bool checkIndexesAreOrdered() const = 0;
 #endif
+protected:
+  /// Gives `this` a new pattern id, which invalidates the data derived from the previous pattern
+  inline void renew_pattern_id() { pattern_id_ = new_pattern_id(); }
+
+private:
+  static inline uint64_t new_pattern_id()
+  {
+    static std::atomic<uint64_t> counter(0);
+    return ++counter;
+  }
+
 protected:
   size_type nrows_;  ///< number of rows
   size_type ncols_;  ///< number of columns
   size_type nnz_;    ///< number of nonzero entries
+
+private:
+  uint64_t pattern_id_;
 };
 
 }  // namespace hiop
@@ -2,8 +2,10 @@
 #include "hiopVectorPar.hpp"
 
 #include "hiop_blasdefs.hpp"
+#include "hiopOMP.hpp"
 
 #include <algorithm>  //for std::min
+#include <array>
 #include <cmath>      //for std::isfinite
 #include <cstring>
 #include <vector>
@@ -20,7 +22,11 @@ namespace hiop
 
 hiopMatrixSparseTriplet::hiopMatrixSparseTriplet(int rows, int cols, int nnz)
     : hiopMatrixSparse(rows, cols, nnz),
-      row_starts_(NULL)
+      row_starts_(NULL),
+      compressed_(nullptr),
+      use_compressed_spmv_(false),
+      mdinvmt_pattern_(nullptr),
+      mdinvnt_pattern_(nullptr)
 {
   if(rows == 0 || cols == 0) {
     assert(nnz_ == 0 && "number of nonzeros must be zero when any of the dimensions are 0");
@@ -38,6 +44,9 @@ hiopMatrixSparseTriplet::~hiopMatrixSparseTriplet()
   delete[] jCol_;
   delete[] values_;
   delete row_starts_;
+  delete compressed_;
+  delete mdinvmt_pattern_;
+  delete mdinvnt_pattern_;
 }
 
 void hiopMatrixSparseTriplet::setToZero()
@@ -67,6 +76,24 @@ void hiopMatrixSparseTriplet::timesVec(double beta, hiopVector& y, double alpha,
 /** y = beta * y + alpha * this * x */
 void hiopMatrixSparseTriplet::timesVec(double beta, double* y, double alpha, const double* x) const
 {
+  if(use_compressed_spmv_) {
+    // row-by-row product over the CSR index: no scattered updates, rows are independent
+    const CompressedPatternInfo& cpi = get_compressed_pattern();
+    const index_type* row_ptr = cpi.row_ptr_.data();
+    const index_type* perm = cpi.row_perm_.data();
+    const index_type* col = cpi.col_idx_.data();
+    const double* M = values_;
+    HIOP_OMP_PARFOR(nnz_)
+    for(int i = 0; i < nrows_; i++) {
+      double acc = 0.;
+      for(index_type k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+        acc += M[perm[k]] * x[col[k]];
+      }
+      y[i] = beta * y[i] + alpha * acc;
+    }
+    return;
+  }
+
   // y= beta*y
   for(int i = 0; i < nrows_; i++) {
     y[i] *= beta;
@@ -98,6 +125,24 @@ void hiopMatrixSparseTriplet::transTimesVec(double beta, hiopVector& y, double a
 /** y = beta * y + alpha * this^T * x */
 void hiopMatrixSparseTriplet::transTimesVec(double beta, double* y, double alpha, const double* x) const
 {
+  if(use_compressed_spmv_) {
+    // column-by-column product over the CSC index, i.e., row-by-row over this^T
+    const CompressedPatternInfo& cpi = get_compressed_pattern();
+    const index_type* col_ptr = cpi.col_ptr_.data();
+    const index_type* perm = cpi.col_perm_.data();
+    const index_type* row = cpi.row_idx_.data();
+    const double* M = values_;
+    HIOP_OMP_PARFOR(nnz_)
+    for(int j = 0; j < ncols_; j++) {
+      double acc = 0.;
+      for(index_type k = col_ptr[j]; k < col_ptr[j + 1]; k++) {
+        acc += M[perm[k]] * x[row[k]];
+      }
+      y[j] = beta * y[j] + alpha * acc;
+    }
+    return;
+  }
+
   // y:= beta*y
   for(int i = 0; i < ncols_; i++) {
     y[i] *= beta;
@@ -194,12 +239,16 @@ void hiopMatrixSparseTriplet::copySubDiagonalFrom(const index_type& start_on_des
   assert(start_on_dest_diag >= 0 && start_on_dest_diag + num_elems <= this->nrows_);
   const double* v = vd.local_data_const();
 
+  bool pattern_changed = false;
   for(auto row_src = 0; row_src < num_elems; row_src++) {
     const index_type row_dest = row_src + start_on_dest_diag;
     const index_type nnz_dest = row_src + start_on_nnz_idx;
-    iRow_[nnz_dest] = jCol_[nnz_dest] = row_dest;
+    pattern_changed |= set_nz_indices(nnz_dest, row_dest, row_dest);
     this->values_[nnz_dest] = scal * v[row_src];
   }
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 void hiopMatrixSparseTriplet::setSubDiagonalTo(const index_type& start_on_dest_diag,
@@ -209,13 +258,16 @@ void hiopMatrixSparseTriplet::setSubDiagonalTo(const index_type& start_on_dest_d
 {
   assert(start_on_dest_diag >= 0 && start_on_dest_diag + num_elems <= this->nrows_);
 
+  bool pattern_changed = false;
   for(auto row_src = 0; row_src < num_elems; row_src++) {
     const index_type row_dest = row_src + start_on_dest_diag;
     const index_type nnz_dest = row_src + start_on_nnz_idx;
-    iRow_[nnz_dest] = row_dest;
-    jCol_[nnz_dest] = row_dest;
+    pattern_changed |= set_nz_indices(nnz_dest, row_dest, row_dest);
     this->values_[nnz_dest] = c;
   }
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 void hiopMatrixSparseTriplet::addMatrix(double alpha, const hiopMatrix& X) { assert(false && "not needed"); }
@@ -309,6 +361,7 @@ hiopMatrixSparse* hiopMatrixSparseTriplet::new_copy() const
   memcpy(copy->iRow_, iRow_, nnz_ * sizeof(int));
   memcpy(copy->jCol_, jCol_, nnz_ * sizeof(int));
   memcpy(copy->values_, values_, nnz_ * sizeof(double));
+  copy->use_compressed_spmv_ = use_compressed_spmv_;
   return copy;
 }
 void hiopMatrixSparseTriplet::copyFrom(const hiopMatrixSparse& dm)
@@ -363,48 +416,16 @@ void hiopMatrixSparseTriplet::addMDinvMtransToDiagBlockOfSymDeMatUTri(int rowAnd
   assert(row_dest_start >= 0 && row_dest_start + n <= W.m());
   assert(col_dest_start >= 0 && col_dest_start + nrows_ <= W.n());
   assert(D.get_size() == this->ncols_);
-  double* WM = W.local_data();
-  int m_W = W.m();
   const double* DM = D.local_data_const();
 
-  if(row_starts_ == NULL) row_starts_ = allocAndBuildRowStarts();
-  assert(row_starts_);
-
-  double acc;
-
-  for(int i = 0; i < this->nrows_; i++) {
-    // j==i
-    acc = 0.;
-    for(index_type k = row_starts_->idx_start_[i]; k < row_starts_->idx_start_[i + 1]; k++)
-      acc += this->values_[k] / DM[this->jCol_[k]] * this->values_[k];
-    // WM[i+row_dest_start][i+col_dest_start] += alpha*acc;
-    WM[(i + row_dest_start) * m_W + i + col_dest_start] += alpha * acc;
-
-    // j>i
-    for(int j = i + 1; j < this->nrows_; j++) {
-      // dest[i,j] = weigthed_dotprod(this_row_i,this_row_j)
-      acc = 0.;
-
-      index_type ki = row_starts_->idx_start_[i], kj = row_starts_->idx_start_[j];
-      while(ki < row_starts_->idx_start_[i + 1] && kj < row_starts_->idx_start_[j + 1]) {
-        assert(ki < this->nnz_);
-        assert(kj < this->nnz_);
-        if(this->jCol_[ki] == this->jCol_[kj]) {
-          acc += this->values_[ki] / DM[this->jCol_[ki]] * this->values_[kj];
-          ki++;
-          kj++;
-        } else {
-          if(this->jCol_[ki] < this->jCol_[kj])
-            ki++;
-          else
-            kj++;
-        }
-      }  // end of loop over ki and kj
+  if(nullptr == mdinvmt_pattern_) {
+    mdinvmt_pattern_ = new ProductPatternInfo();
+    build_product_pattern(*this, true, *mdinvmt_pattern_);
+  } else if(mdinvmt_pattern_->pattern_id2_ != get_pattern_id() || mdinvmt_pattern_->nnz1_ != nnz_) {
+    build_product_pattern(*this, true, *mdinvmt_pattern_);
+  }
 
-      // WM[i+row_dest_start][j+col_dest_start] += alpha*acc;
-      WM[(i + row_dest_start) * m_W + j + col_dest_start] += alpha * acc;
-    }  // end j
-  }  // end i
+  add_product_w_pattern(*mdinvmt_pattern_, *this, alpha, DM, row_dest_start, col_dest_start, W);
 }
 
 /*
@@ -430,55 +451,113 @@ void hiopMatrixSparseTriplet::addMDinvNtransToSymDeMatUTri(int row_dest_start,
   assert(row_dest_start >= 0 && row_dest_start + m1 <= W.m());
   assert(col_dest_start >= 0 && col_dest_start + m2 <= W.n());
 
-  double* WM = W.local_data();
-  int m_W = W.m();
-
   const double* DM = D.local_data_const();
 
-  // TODO: allocAndBuildRowStarts -> should create row_starts internally (name='prepareRowStarts' ?)
-  if(M1.row_starts_ == NULL) M1.row_starts_ = M1.allocAndBuildRowStarts();
-  assert(M1.row_starts_);
+  // the pattern of the product is kept for the last M2 only and rebuilt when another M2 or pattern is passed
+  if(nullptr == M1.mdinvnt_pattern_) {
+    M1.mdinvnt_pattern_ = new ProductPatternInfo();
+    M1.build_product_pattern(M2, false, *M1.mdinvnt_pattern_);
+  } else {
+    const ProductPatternInfo& ppi = *M1.mdinvnt_pattern_;
+    if(ppi.pattern_id2_ != M2.get_pattern_id() || ppi.nnz1_ != M1.nnz_ || ppi.nnz2_ != M2.nnz_ ||
+       ppi.nrows2_ != M2.nrows_) {
+      M1.build_product_pattern(M2, false, *M1.mdinvnt_pattern_);
+    }
+  }
 
-  if(M2.row_starts_ == NULL) M2.row_starts_ = M2.allocAndBuildRowStarts();
-  assert(M2.row_starts_);
+  M1.add_product_w_pattern(*M1.mdinvnt_pattern_, M2, alpha, DM, row_dest_start, col_dest_start, W);
+}
 
-  double acc;
+/**
+ * Lists, for each row i of this, the pairs (k1, k2) of nonzeros of this and M2 that share a column by
+ * going over the nonzeros of M2 in the column of each nonzero k1 of row i (CSC index of M2). The cost is
+ * proportional to the number of pairs instead of the number of pairs of rows. The pairs are then grouped
+ * by the row j of k2 with a stable sort, which keeps them in the column order of row i.
+ */
+void hiopMatrixSparseTriplet::build_product_pattern(const hiopMatrixSparseTriplet& M2,
+                                                    bool upper_only,
+                                                    ProductPatternInfo& ppi) const
+{
+  assert(ncols_ == M2.ncols_);
+  const CompressedPatternInfo& cpi1 = get_compressed_pattern();
+  const CompressedPatternInfo& cpi2 = M2.get_compressed_pattern();
+
+  ppi.pattern_id2_ = M2.get_pattern_id();
+  ppi.nnz1_ = nnz_;
+  ppi.nnz2_ = M2.nnz_;
+  ppi.nrows2_ = M2.nrows_;
+  ppi.entry_ptr_.assign(nrows_ + 1, 0);
+  ppi.entry_col_.clear();
+  ppi.pair_ptr_.assign(1, 0);
+  ppi.pair_k1_.clear();
+  ppi.pair_k2_.clear();
+
+  // (j, k1, k2) for the pairs of row i
+  std::vector<std::array<index_type, 3>> row_pairs;
+  for(index_type i = 0; i < nrows_; i++) {
+    row_pairs.clear();
+    for(index_type p = cpi1.row_ptr_[i]; p < cpi1.row_ptr_[i + 1]; p++) {
+      const index_type col = cpi1.col_idx_[p];
+      for(index_type q = cpi2.col_ptr_[col]; q < cpi2.col_ptr_[col + 1]; q++) {
+        const index_type j = cpi2.row_idx_[q];
+        if(upper_only && j < i) {
+          continue;
+        }
+        row_pairs.push_back({j, cpi1.row_perm_[p], cpi2.col_perm_[q]});
+      }
+    }
+    auto less_row = [](const std::array<index_type, 3>& a, const std::array<index_type, 3>& b) { return a[0] < b[0]; };
+    std::stable_sort(row_pairs.begin(), row_pairs.end(), less_row);
+
+    for(size_type p = 0; p < static_cast<size_type>(row_pairs.size()); p++) {
+      if(p == 0 || row_pairs[p][0] != row_pairs[p - 1][0]) {
+        // new entry (i,j)
+        ppi.entry_col_.push_back(row_pairs[p][0]);
+        ppi.pair_ptr_.push_back(ppi.pair_ptr_.back());
+      }
+      ppi.pair_k1_.push_back(row_pairs[p][1]);
+      ppi.pair_k2_.push_back(row_pairs[p][2]);
+      ppi.pair_ptr_.back()++;
+    }
+    ppi.entry_ptr_[i + 1] = ppi.entry_col_.size();
+  }
+}
 
-  // only parallelize these two outter loops
-  //
-  // sort amount of work per thread/exe unit
-  // assign in order of most-> least work to better
-  // distribute workload
-  //
-  // These are multiplied many times, but sparsity pattern
-  // remains the same. We can do some preprocessing to save on
-  // thread execution time
-  //
-  // compressed row/col patterns?
-  for(int i = 0; i < m1; i++) {
-    // j>=i
-    for(int j = 0; j < m2; j++) {
+/**
+ * The rows of the product are independent (each updates its own row of W), so they are computed in
+ * parallel. The rows have different numbers of entries, hence the dynamic schedule.
+ */
+void hiopMatrixSparseTriplet::add_product_w_pattern(const ProductPatternInfo& ppi,
+                                                    const hiopMatrixSparseTriplet& M2,
+                                                    const double& alpha,
+                                                    const double* DM,
+                                                    int row_dest_start,
+                                                    int col_dest_start,
+                                                    hiopMatrixDense& W) const
+{
+  assert(ppi.nnz1_ == nnz_ && ppi.nnz2_ == M2.nnz_);
+  double* WM = W.local_data();
+  const int m_W = W.m();
+
+  const index_type* entry_ptr = ppi.entry_ptr_.data();
+  const index_type* entry_col = ppi.entry_col_.data();
+  const index_type* pair_ptr = ppi.pair_ptr_.data();
+  const index_type* k1 = ppi.pair_k1_.data();
+  const index_type* k2 = ppi.pair_k2_.data();
+  const double* M1values = values_;
+  const double* M2values = M2.values_;
+  const int* M1jCol = jCol_;
+
+  HIOP_OMP_PARFOR_DYNAMIC(ppi.pair_k1_.size())
+  for(int i = 0; i < nrows_; i++) {
+    for(index_type e = entry_ptr[i]; e < entry_ptr[i + 1]; e++) {
       // dest[i,j] = weigthed_dotprod(M1_row_i,M2_row_j)
-      acc = 0.;
-      index_type ki = M1.row_starts_->idx_start_[i];
-      index_type kj = M2.row_starts_->idx_start_[j];
-
-      while(ki < M1.row_starts_->idx_start_[i + 1] && kj < M2.row_starts_->idx_start_[j + 1]) {
-        assert(ki < M1.nnz_);
-        assert(kj < M2.nnz_);
-
-        if(M1.jCol_[ki] == M2.jCol_[kj]) {
-          acc += M1.values_[ki] / DM[this->jCol_[ki]] * M2.values_[kj];
-          ki++;
-          kj++;
-        } else {
-          if(M1.jCol_[ki] < M2.jCol_[kj])
-            ki++;
-          else
-            kj++;
-        }
-      }  // end of loop over ki and kj
+      double acc = 0.;
+      for(index_type p = pair_ptr[e]; p < pair_ptr[e + 1]; p++) {
+        acc += M1values[k1[p]] / DM[M1jCol[k1[p]]] * M2values[k2[p]];
+      }
 
+      const index_type j = entry_col[e];
 #ifdef HIOP_DEEPCHECKS
       if(i + row_dest_start > j + col_dest_start)
         printf("[warning] lower triangular element updated in addMDinvNtransToSymDeMatUTri\n");
@@ -486,9 +565,8 @@ void hiopMatrixSparseTriplet::addMDinvNtransToSymDeMatUTri(int row_dest_start,
       assert(i + row_dest_start <= j + col_dest_start);
       // WM[i+row_dest_start][j+col_dest_start] += alpha*acc;
       WM[(i + row_dest_start) * m_W + j + col_dest_start] += alpha * acc;
-
-    }  // end j
-  }  // end i
+    }
+  }
 }
 
 // //assumes triplets are ordered
@@ -524,6 +602,81 @@ hiopMatrixSparseTriplet::RowStartsInfo* hiopMatrixSparseTriplet::allocAndBuildRo
   return rsi;
 }
 
+void hiopMatrixSparseTriplet::set_compressed_spmv(bool use_compressed)
+{
+  use_compressed_spmv_ = use_compressed;
+  if(!use_compressed_spmv_) {
+    reset_compressed_pattern();
+  }
+}
+
+void hiopMatrixSparseTriplet::reset_compressed_pattern() { drop_pattern_caches(); }
+
+void hiopMatrixSparseTriplet::drop_pattern_caches(bool keep_copy_rows_maps)
+{
+  delete row_starts_;
+  row_starts_ = nullptr;
+  delete compressed_;
+  compressed_ = nullptr;
+  delete mdinvmt_pattern_;
+  mdinvmt_pattern_ = nullptr;
+  delete mdinvnt_pattern_;
+  mdinvnt_pattern_ = nullptr;
+  if(!keep_copy_rows_maps) {
+    copy_rows_maps_.clear();
+  }
+  renew_pattern_id();
+}
+
+const hiopMatrixSparseTriplet::CompressedPatternInfo& hiopMatrixSparseTriplet::get_compressed_pattern() const
+{
+  if(nullptr == compressed_) {
+    compressed_ = alloc_and_build_compressed_pattern();
+  }
+  assert(compressed_);
+  return *compressed_;
+}
+
+/**
+ * Builds the CSR and CSC indexes of the triplets by counting sorts on the row, respectively, column
+ * indexes. The triplets do not need to be ordered; within a row (column) the entries keep the order
+ * of the triplets.
+ */
+hiopMatrixSparseTriplet::CompressedPatternInfo* hiopMatrixSparseTriplet::alloc_and_build_compressed_pattern() const
+{
+  assert(nrows_ >= 0 && ncols_ >= 0);
+
+  CompressedPatternInfo* cpi = new CompressedPatternInfo();
+  cpi->row_ptr_.assign(nrows_ + 1, 0);
+  cpi->col_ptr_.assign(ncols_ + 1, 0);
+  cpi->row_perm_.resize(nnz_);
+  cpi->col_idx_.resize(nnz_);
+  cpi->col_perm_.resize(nnz_);
+  cpi->row_idx_.resize(nnz_);
+
+  for(index_type k = 0; k < nnz_; k++) {
+    assert(iRow_[k] >= 0 && iRow_[k] < nrows_);
+    assert(jCol_[k] >= 0 && jCol_[k] < ncols_);
+    cpi->row_ptr_[iRow_[k] + 1]++;
+    cpi->col_ptr_[jCol_[k] + 1]++;
+  }
+  std::partial_sum(cpi->row_ptr_.begin(), cpi->row_ptr_.end(), cpi->row_ptr_.begin());
+  std::partial_sum(cpi->col_ptr_.begin(), cpi->col_ptr_.end(), cpi->col_ptr_.begin());
+
+  std::vector<index_type> next_in_row(cpi->row_ptr_.begin(), cpi->row_ptr_.end() - 1);
+  std::vector<index_type> next_in_col(cpi->col_ptr_.begin(), cpi->col_ptr_.end() - 1);
+  for(index_type k = 0; k < nnz_; k++) {
+    const index_type pos_row = next_in_row[iRow_[k]]++;
+    cpi->row_perm_[pos_row] = k;
+    cpi->col_idx_[pos_row] = jCol_[k];
+
+    const index_type pos_col = next_in_col[jCol_[k]]++;
+    cpi->col_perm_[pos_col] = k;
+    cpi->row_idx_[pos_col] = iRow_[k];
+  }
+  return cpi;
+}
+
 void hiopMatrixSparseTriplet::copyRowsFrom(const hiopMatrix& src_gen, const index_type* rows_idxs, size_type n_rows)
 {
   const hiopMatrixSparseTriplet& src = dynamic_cast<const hiopMatrixSparseTriplet&>(src_gen);
@@ -536,6 +689,17 @@ void hiopMatrixSparseTriplet::copyRowsFrom(const hiopMatrix& src_gen, const inde
   const int* jCol_src = src.j_col();
   const double* values_src = src.M();
   int nnz_src = src.numberOfNonzeros();
+
+  // the pattern was copied in a previous call, only the values need to be gathered
+  const CopyRowsMap* map = find_copy_rows_map(0, src, n_rows, 0, 0, rows_idxs);
+  if(map) {
+    copy_values_w_map(*map, values_src, 0);
+    return;
+  }
+  CopyRowsMap& new_map = new_copy_rows_map(0, src, n_rows, 0, 0, rows_idxs);
+  new_map.src_idx_.resize(nnz_);
+
+  bool pattern_changed = false;
   int itnz_src = 0;
   int itnz_dest = 0;
   // int iterators should suffice
@@ -562,14 +726,18 @@ void hiopMatrixSparseTriplet::copyRowsFrom(const hiopMatrix& src_gen, const inde
           assert(jCol_src[itnz_src] >= jCol_src[itnz_src - 1] && "col indexes are not sorted");
       }
 #endif
-      iRow_[itnz_dest] = row_dest;  // iRow_src[itnz_src];
-      jCol_[itnz_dest] = jCol_src[itnz_src];
+      new_map.src_idx_[itnz_dest] = itnz_src;
+      pattern_changed |= set_nz_indices(itnz_dest, row_dest, jCol_src[itnz_src]);  // iRow_src[itnz_src];
       values_[itnz_dest++] = values_src[itnz_src++];
 
       assert(itnz_dest <= nnz_);
     }
   }
   assert(itnz_dest == nnz_);
+  // the map just built stays valid, it does not depend on the pattern of `this`
+  if(pattern_changed) {
+    drop_pattern_caches(true);
+  }
 }
 
 /**
@@ -595,6 +763,16 @@ void hiopMatrixSparseTriplet::copyRowsBlockFrom(const hiopMatrix& src_gen,
   const int* jCol_src = src.j_col();
   const double* values_src = src.M();
   int nnz_src = src.numberOfNonzeros();
+
+  // the pattern was copied in a previous call, only the values need to be gathered
+  const CopyRowsMap* map = find_copy_rows_map(dest_nnz_st, src, n_rows, rows_src_idx_st, rows_dest_idx_st, nullptr);
+  if(map) {
+    copy_values_w_map(*map, values_src, dest_nnz_st);
+    return;
+  }
+  CopyRowsMap& new_map = new_copy_rows_map(dest_nnz_st, src, n_rows, rows_src_idx_st, rows_dest_idx_st, nullptr);
+
+  bool pattern_changed = false;
   int itnz_src = 0;
   int itnz_dest = dest_nnz_st;
   // int iterators should suffice
@@ -622,13 +800,88 @@ void hiopMatrixSparseTriplet::copyRowsBlockFrom(const hiopMatrix& src_gen,
           assert(jCol_src[itnz_src] >= jCol_src[itnz_src - 1] && "col indexes are not sorted");
       }
 #endif
-      iRow_[itnz_dest] = row_dest;  // iRow_src[itnz_src];
-      jCol_[itnz_dest] = jCol_src[itnz_src];
+      new_map.src_idx_.push_back(itnz_src);
+      pattern_changed |= set_nz_indices(itnz_dest, row_dest, jCol_src[itnz_src]);  // iRow_src[itnz_src];
       values_[itnz_dest++] = values_src[itnz_src++];
 
       assert(itnz_dest <= nnz_);
     }
   }
+  if(pattern_changed) {
+    drop_pattern_caches(true);
+  }
+}
+
+const hiopMatrixSparseTriplet::CopyRowsMap* hiopMatrixSparseTriplet::find_copy_rows_map(size_type dest_nnz_st,
+                                                                                        const hiopMatrix& src,
+                                                                                        size_type n_rows,
+                                                                                        index_type rows_src_st,
+                                                                                        index_type rows_dest_st,
+                                                                                        const index_type* rows_idxs) const
+{
+  auto it = copy_rows_maps_.find(dest_nnz_st);
+  if(it == copy_rows_maps_.end()) {
+    return nullptr;
+  }
+  const CopyRowsMap& map = it->second;
+  const hiopMatrixSparse& src_sp = dynamic_cast<const hiopMatrixSparse&>(src);
+  if(map.src_pattern_id_ != src_sp.get_pattern_id() || map.src_nnz_ != src_sp.numberOfNonzeros() ||
+     map.n_rows_ != n_rows || map.rows_src_st_ != rows_src_st || map.rows_dest_st_ != rows_dest_st) {
+    return nullptr;
+  }
+  if(nullptr == rows_idxs) {
+    return map.rows_idxs_.empty() ? &map : nullptr;
+  }
+  if(static_cast<size_type>(map.rows_idxs_.size()) != n_rows ||
+     !std::equal(map.rows_idxs_.begin(), map.rows_idxs_.end(), rows_idxs)) {
+    return nullptr;
+  }
+  return &map;
+}
+
+hiopMatrixSparseTriplet::CopyRowsMap& hiopMatrixSparseTriplet::new_copy_rows_map(size_type dest_nnz_st,
+                                                                                 const hiopMatrix& src,
+                                                                                 size_type n_rows,
+                                                                                 index_type rows_src_st,
+                                                                                 index_type rows_dest_st,
+                                                                                 const index_type* rows_idxs)
+{
+  // a copy of selected rows overwrites all the nonzeros, hence the maps of the other copies
+  if(rows_idxs) {
+    copy_rows_maps_.clear();
+  } else {
+    auto it = copy_rows_maps_.find(0);
+    if(it != copy_rows_maps_.end() && !it->second.rows_idxs_.empty()) {
+      copy_rows_maps_.erase(it);
+    }
+  }
+  CopyRowsMap& map = copy_rows_maps_[dest_nnz_st];
+  const hiopMatrixSparse& src_sp = dynamic_cast<const hiopMatrixSparse&>(src);
+  map.src_pattern_id_ = src_sp.get_pattern_id();
+  map.src_nnz_ = src_sp.numberOfNonzeros();
+  map.n_rows_ = n_rows;
+  map.rows_src_st_ = rows_src_st;
+  map.rows_dest_st_ = rows_dest_st;
+  if(rows_idxs) {
+    map.rows_idxs_.assign(rows_idxs, rows_idxs + n_rows);
+  } else {
+    map.rows_idxs_.clear();
+  }
+  map.src_idx_.clear();
+  return map;
+}
+
+void hiopMatrixSparseTriplet::copy_values_w_map(const CopyRowsMap& map, const double* values_src, size_type dest_nnz_st)
+{
+  const size_type nnz_copy = map.src_idx_.size();
+  assert(dest_nnz_st + nnz_copy <= nnz_);
+  const index_type* src_idx = map.src_idx_.data();
+  double* values_dest = values_ + dest_nnz_st;
+
+  HIOP_OMP_PARFOR_SIMD(nnz_copy)
+  for(index_type k = 0; k < nnz_copy; ++k) {
+    values_dest[k] = values_src[src_idx[k]];
+  }
 }
 
 void hiopMatrixSparseTriplet::copyDiagMatrixToSubblock(const double& src_val,
@@ -642,12 +895,15 @@ void hiopMatrixSparseTriplet::copyDiagMatrixToSubblock(const double& src_val,
   assert(nnz_to_copy + dest_row_st <= this->m());
   assert(nnz_to_copy + col_dest_st <= this->n());
 
+  bool pattern_changed = false;
   int itnz_dest = dest_nnz_st;
   for(auto ele_add = 0; ele_add < nnz_to_copy; ++ele_add) {
-    iRow_[itnz_dest] = dest_row_st + ele_add;
-    jCol_[itnz_dest] = col_dest_st + ele_add;
+    pattern_changed |= set_nz_indices(itnz_dest, dest_row_st + ele_add, col_dest_st + ele_add);
     values_[itnz_dest++] = src_val;
   }
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 void hiopMatrixSparseTriplet::copyDiagMatrixToSubblock_w_pattern(const hiopVector& dx,
@@ -669,17 +925,20 @@ void hiopMatrixSparseTriplet::copyDiagMatrixToSubblock_w_pattern(const hiopVecto
   int dest_k = dest_nnz_st;
   int n = ix.get_local_size();
   int nnz_find = 0;
+  bool pattern_changed = false;
 
   for(int i = 0; i < n; i++) {
     if(pattern[i] != 0.0) {
-      iRow_[dest_k] = dest_row_st + nnz_find;
-      jCol_[dest_k] = dest_col_st + nnz_find;
+      pattern_changed |= set_nz_indices(dest_k, dest_row_st + nnz_find, dest_col_st + nnz_find);
       values_[dest_k] = x[i];
       dest_k++;
       nnz_find++;
     }
   }
   assert(nnz_to_copy == nnz_find);
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 void hiopMatrixSparseTriplet::print(FILE* file,
@@ -788,6 +1047,7 @@ void hiopMatrixSparseTriplet::set_Jac_FR(const hiopMatrixSparse& Jac_c,
   // extend Jac to the p and n parts --- sparsity
   if(iJacS != nullptr && jJacS != nullptr) {
     int k = 0;
+    bool pattern_changed = false;
 
     // Jac for c(x) - p + n
     const int* J_c_col = J_c.j_col();
@@ -796,19 +1056,22 @@ void hiopMatrixSparseTriplet::set_Jac_FR(const hiopMatrixSparse& Jac_c,
 
       // copy from base Jac_c
       while(k_base < J_c.row_starts_->idx_start_[i + 1]) {
-        iRow_[k] = iJacS[k] = i;
-        jCol_[k] = jJacS[k] = J_c_col[k_base];
+        pattern_changed |= set_nz_indices(k, i, J_c_col[k_base]);
+        iJacS[k] = iRow_[k];
+        jJacS[k] = jCol_[k];
         k++;
         k_base++;
       }
 
       // extra parts for p and n
-      iRow_[k] = iJacS[k] = i;
-      jCol_[k] = jJacS[k] = n_c + i;
+      pattern_changed |= set_nz_indices(k, i, n_c + i);
+      iJacS[k] = iRow_[k];
+      jJacS[k] = jCol_[k];
       k++;
 
-      iRow_[k] = iJacS[k] = i;
-      jCol_[k] = jJacS[k] = n_c + m_c + i;
+      pattern_changed |= set_nz_indices(k, i, n_c + m_c + i);
+      iJacS[k] = iRow_[k];
+      jJacS[k] = jCol_[k];
       k++;
     }
 
@@ -819,22 +1082,28 @@ void hiopMatrixSparseTriplet::set_Jac_FR(const hiopMatrixSparse& Jac_c,
 
       // copy from base Jac_d
       while(k_base < J_d.row_starts_->idx_start_[i + 1]) {
-        iRow_[k] = iJacS[k] = i + m_c;
-        jCol_[k] = jJacS[k] = J_d_col[k_base];
+        pattern_changed |= set_nz_indices(k, i + m_c, J_d_col[k_base]);
+        iJacS[k] = iRow_[k];
+        jJacS[k] = jCol_[k];
         k++;
         k_base++;
       }
 
       // extra parts for p and n
-      iRow_[k] = iJacS[k] = i + m_c;
-      jCol_[k] = jJacS[k] = n_d + 2 * m_c + i;
+      pattern_changed |= set_nz_indices(k, i + m_c, n_d + 2 * m_c + i);
+      iJacS[k] = iRow_[k];
+      jJacS[k] = jCol_[k];
       k++;
 
-      iRow_[k] = iJacS[k] = i + m_c;
-      jCol_[k] = jJacS[k] = n_d + 2 * m_c + m_d + i;
+      pattern_changed |= set_nz_indices(k, i + m_c, n_d + 2 * m_c + m_d + i);
+      iJacS[k] = iRow_[k];
+      jJacS[k] = jCol_[k];
       k++;
     }
     assert(k == nnz_);
+    if(pattern_changed) {
+      drop_pattern_caches();
+    }
   }
 
   // extend Jac to the p and n parts --- element
@@ -905,6 +1174,33 @@ void hiopMatrixSymSparseTriplet::timesVec(double beta, hiopVector& y, double alp
 void hiopMatrixSymSparseTriplet::timesVec(double beta, double* y, double alpha, const double* x) const
 {
   assert(ncols_ == nrows_);
+  if(use_compressed_spmv_) {
+    // only one triangle is stored: row i of the full matrix is row i of the stored triangle (CSR)
+    // plus column i of the stored triangle (CSC) without the diagonal
+    const CompressedPatternInfo& cpi = get_compressed_pattern();
+    const index_type* row_ptr = cpi.row_ptr_.data();
+    const index_type* row_perm = cpi.row_perm_.data();
+    const index_type* col = cpi.col_idx_.data();
+    const index_type* col_ptr = cpi.col_ptr_.data();
+    const index_type* col_perm = cpi.col_perm_.data();
+    const index_type* row = cpi.row_idx_.data();
+    const double* M = values_;
+    HIOP_OMP_PARFOR(nnz_)
+    for(int i = 0; i < nrows_; i++) {
+      double acc = 0.;
+      for(index_type k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+        acc += M[row_perm[k]] * x[col[k]];
+      }
+      for(index_type k = col_ptr[i]; k < col_ptr[i + 1]; k++) {
+        if(row[k] != i) {
+          acc += M[col_perm[k]] * x[row[k]];
+        }
+      }
+      y[i] = beta * y[i] + alpha * acc;
+    }
+    return;
+  }
+
   // y:= beta*y
   for(int i = 0; i < nrows_; i++) {
     y[i] *= beta;
@@ -931,6 +1227,7 @@ hiopMatrixSparse* hiopMatrixSymSparseTriplet::new_copy() const
   memcpy(copy->iRow_, iRow_, nnz_ * sizeof(int));
   memcpy(copy->jCol_, jCol_, nnz_ * sizeof(int));
   memcpy(copy->values_, values_, nnz_ * sizeof(double));
+  copy->use_compressed_spmv_ = use_compressed_spmv_;
   return copy;
 }
 
@@ -1025,16 +1322,19 @@ void hiopMatrixSparseTriplet::copySubmatrixFrom(const hiopMatrix& src_gen,
   int dest_k = dest_nnz_st;
 
   // FIXME: irow and jcol only need to be assigned once; should we save a map for the indexes?
+  bool pattern_changed = false;
   for(auto src_k = 0; src_k < src_nnz; ++src_k) {
     if(offdiag_only && src_iRow[src_k] == src_jCol[src_k]) {
       continue;
     }
-    iRow_[dest_k] = dest_row_st + src_iRow[src_k];
-    jCol_[dest_k] = dest_col_st + src_jCol[src_k];
+    pattern_changed |= set_nz_indices(dest_k, dest_row_st + src_iRow[src_k], dest_col_st + src_jCol[src_k]);
     values_[dest_k] = src_val[src_k];
     dest_k++;
   }
   assert(dest_k <= this->numberOfNonzeros());
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 void hiopMatrixSparseTriplet::copySubmatrixFromTrans(const hiopMatrix& src_gen,
@@ -1059,16 +1359,19 @@ void hiopMatrixSparseTriplet::copySubmatrixFromTrans(const hiopMatrix& src_gen,
   int dest_k = dest_nnz_st;
 
   // FIXME: irow and jcol only need to be assigned once; should we save a map for the indexes?
+  bool pattern_changed = false;
   for(auto src_k = 0; src_k < src_nnz; ++src_k) {
     if(offdiag_only && src_iRow[src_k] == src_jCol[src_k]) {
       continue;
     }
-    iRow_[dest_k] = dest_row_st + src_iRow[src_k];
-    jCol_[dest_k] = dest_col_st + src_jCol[src_k];
+    pattern_changed |= set_nz_indices(dest_k, dest_row_st + src_iRow[src_k], dest_col_st + src_jCol[src_k]);
     values_[dest_k] = src_val[src_k];
     dest_k++;
   }
   assert(dest_k <= this->numberOfNonzeros());
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 void hiopMatrixSparseTriplet::setSubmatrixToConstantDiag_w_colpattern(const double& scalar,
@@ -1088,17 +1391,20 @@ void hiopMatrixSparseTriplet::setSubmatrixToConstantDiag_w_colpattern(const doub
   int dest_k = dest_nnz_st;
   int n = ix.get_local_size();
   int nnz_find = 0;
+  bool pattern_changed = false;
 
   for(int i = 0; i < n; i++) {
     if(pattern[i] != 0.0) {
-      iRow_[dest_k] = dest_row_st + i;
-      jCol_[dest_k] = dest_col_st + nnz_find;
+      pattern_changed |= set_nz_indices(dest_k, dest_row_st + i, dest_col_st + nnz_find);
       values_[dest_k] = scalar;
       nnz_find++;
       dest_k++;
     }
   }
   assert(nnz_find == nnz_to_copy);
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 void hiopMatrixSparseTriplet::setSubmatrixToConstantDiag_w_rowpattern(const double& scalar,
@@ -1118,17 +1424,20 @@ void hiopMatrixSparseTriplet::setSubmatrixToConstantDiag_w_rowpattern(const doub
   int dest_k = dest_nnz_st;
   int n = ix.get_local_size();
   int nnz_find = 0;
+  bool pattern_changed = false;
 
   for(int i = 0; i < n; i++) {
     if(pattern[i] != 0.0) {
-      iRow_[dest_k] = dest_row_st + nnz_find;
-      jCol_[dest_k] = dest_col_st + i;
+      pattern_changed |= set_nz_indices(dest_k, dest_row_st + nnz_find, dest_col_st + i);
       values_[dest_k] = scalar;
       nnz_find++;
       dest_k++;
     }
   }
   assert(nnz_find == nnz_to_copy);
+  if(pattern_changed) {
+    drop_pattern_caches();
+  }
 }
 
 size_type hiopMatrixSymSparseTriplet::numberOfOffDiagNonzeros() const
@@ -1291,9 +1600,17 @@ void hiopMatrixSparseTriplet::sort()
   std::sort(ind_temp.begin(), ind_temp.end(), [&](index_type i, index_type j) {
     return (iRow_[i] != iRow_[j]) ? iRow_[i] < iRow_[j] : jCol_[i] < jCol_[j];
   });
+  bool pattern_changed = false;
+  for(index_type k = 0; k < nnz && !pattern_changed; ++k) {
+    pattern_changed = ind_temp[k] != k;
+  }
+  if(!pattern_changed) {
+    return;
+  }
   reorder(iRow_, ind_temp, nnz);
   reorder(jCol_, ind_temp, nnz);
   reorder(values_, ind_temp, nnz);
+  drop_pattern_caches();
 }
 
 bool hiopMatrixSparseTriplet::is_diagonal() const
@@ -1365,6 +1682,7 @@ void hiopMatrixSymSparseTriplet::set_Hess_FR(const hiopMatrixSparse& Hess,
   // sparsity may change due to te new obj term zeta*DR^2.*(x-x_ref)
   if(iHSS != nullptr && jHSS != nullptr) {
     int k = 0;
+    bool pattern_changed = false;
 
     const int* Hess_row = Hess_base.i_row();
     const int* Hess_col = Hess_base.j_col();
@@ -1374,8 +1692,9 @@ void hiopMatrixSymSparseTriplet::set_Hess_FR(const hiopMatrixSparse& Hess,
         size_type nnz_in_row = Hess_base.row_starts_->idx_start_[i + 1] - k_base;
 
         // insert diagonal entry due to the new obj term
-        iRow_[k] = iHSS[k] = i;
-        jCol_[k] = jHSS[k] = i;
+        pattern_changed |= set_nz_indices(k, i, i);
+        iHSS[k] = iRow_[k];
+        jHSS[k] = jCol_[k];
         k++;
 
         if(nnz_in_row > 0 && Hess_row[k_base] == Hess_col[k_base]) {
@@ -1386,8 +1705,9 @@ void hiopMatrixSymSparseTriplet::set_Hess_FR(const hiopMatrixSparse& Hess,
 
         // copy from base Hess
         while(k_base < Hess_base.row_starts_->idx_start_[i + 1]) {
-          iRow_[k] = iHSS[k] = i;
-          jCol_[k] = jHSS[k] = Hess_col[k_base];
+          pattern_changed |= set_nz_indices(k, i, Hess_col[k_base]);
+          iHSS[k] = iRow_[k];
+          jHSS[k] = jCol_[k];
           k++;
           k_base++;
         }
@@ -1395,13 +1715,17 @@ void hiopMatrixSymSparseTriplet::set_Hess_FR(const hiopMatrixSparse& Hess,
     } else {
       // hess in the base problem is empty. just insert the new elements
       for(int i = 0; i < add_diag.get_size(); ++i) {
-        iRow_[k] = iHSS[k] = i;
-        jCol_[k] = jHSS[k] = i;
+        pattern_changed |= set_nz_indices(k, i, i);
+        iHSS[k] = iRow_[k];
+        jHSS[k] = jCol_[k];
         k++;
       }
     }
 
     assert(k == nnz_);
+    if(pattern_changed) {
+      drop_pattern_caches();
+    }
   }
 
   // extend Hess to the p and n parts --- element
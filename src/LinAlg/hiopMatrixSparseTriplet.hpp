@@ -9,6 +9,7 @@
 
 #include <cassert>
 #include <unordered_map>
+#include <vector>
 
 namespace hiop
 {
@@ -319,6 +320,26 @@ public:
   inline const int* j_col() const { return jCol_; }
   inline const double* M() const { return values_; }
 
+  /**
+   * @brief Enables or disables the compressed (CSR and CSC) index of the sparsity pattern used by
+   * `timesVec` and `transTimesVec`.
+   *
+   * The index is built on the first product after it is enabled and reused by all subsequent products,
+   * which are then computed row-by-row (threaded when HiOp is built with OpenMP). The sparsity pattern
+   * is assumed to be fixed once the index is built; call `reset_compressed_pattern` after changing it.
+   */
+  void set_compressed_spmv(bool use_compressed);
+
+  /**
+   * @brief Discards the compressed index and the symbolic products of the sparsity pattern; they are
+   * rebuilt on the next product. Also renews the pattern id, so that the rows copied from `this` by
+   * `copyRowsFrom` and `copyRowsBlockFrom` are set up again.
+   *
+   * The methods of this class that write the row and column indices do so when they change the pattern;
+   * only a pattern changed directly through `i_row` and `j_col` needs this call.
+   */
+  void reset_compressed_pattern();
+
 #ifdef HIOP_DEEPCHECKS
   virtual bool assertSymmetry(double tol = 1e-16) const { return false; }
   virtual bool checkIndexesAreOrdered() const;
@@ -347,8 +368,118 @@ protected:
   };
   mutable RowStartsInfo* row_starts_;
 
+  /**
+   * Row- (CSR) and column-compressed (CSC) index of the triplet sparsity pattern. The permutations map
+   * compressed positions to triplet positions, so that the products read the values from `values_`
+   * and the index remains valid when only the values are updated.
+   */
+  struct CompressedPatternInfo
+  {
+    std::vector<index_type> row_ptr_;   // size num_rows+1
+    std::vector<index_type> row_perm_;  // triplet position of each CSR entry
+    std::vector<index_type> col_idx_;   // column index of each CSR entry
+    std::vector<index_type> col_ptr_;   // size num_cols+1
+    std::vector<index_type> col_perm_;  // triplet position of each CSC entry
+    std::vector<index_type> row_idx_;   // row index of each CSC entry
+  };
+  mutable CompressedPatternInfo* compressed_;
+  bool use_compressed_spmv_;
+
+  /**
+   * Value-permutation map recorded by `copyRowsFrom` and `copyRowsBlockFrom` on the first copy into a
+   * range of nonzeros: `src_idx_[k]` is the source nonzero copied into the nonzero `dest_nnz_st`+k. The
+   * following copies of the same rows of the same source into the same range only gather the values; a copy
+   * of other rows, from another source, or to other rows rebuilds the map. The source is identified by its
+   * pattern id, which is renewed when its indices are rewritten (see `reset_compressed_pattern`).
+   */
+  struct CopyRowsMap
+  {
+    uint64_t src_pattern_id_;            // pattern id of the source matrix
+    size_type src_nnz_;                  // number of nonzeros of the source when the map was built
+    size_type n_rows_;                   // number of rows copied
+    index_type rows_src_st_;             // first source row (`copyRowsBlockFrom`)
+    index_type rows_dest_st_;            // first destination row (`copyRowsBlockFrom`)
+    std::vector<index_type> rows_idxs_;  // source rows (`copyRowsFrom`); empty for `copyRowsBlockFrom`
+    std::vector<index_type> src_idx_;    // source nonzero of each copied nonzero
+  };
+  std::unordered_map<size_type, CopyRowsMap> copy_rows_maps_;  // keyed by the first destination nonzero
+
+  /**
+   * Symbolic phase of the product this*D^{-1}*M2^T computed by `addMDinvMtransToDiagBlockOfSymDeMatUTri`
+   * (M2 is this, upper triangle only) and `addMDinvNtransToSymDeMatUTri`. For each row i, lists the
+   * structurally nonzero entries (i,j) of the product and, for each entry, the pairs of nonzeros of row i
+   * of this and row j of M2 that share a column. The pairs of an entry are in increasing column order, so
+   * the numeric phase adds the terms in the same order as a merge of the two rows.
+   *
+   * Built on the first product and reused afterwards; dropped when the pattern of this changes and rebuilt
+   * when the pattern id or the size of M2 differs from the ones recorded.
+   */
+  struct ProductPatternInfo
+  {
+    uint64_t pattern_id2_;               // pattern id of M2 when the pattern was built
+    size_type nnz1_;                     // number of nonzeros of this when the pattern was built
+    size_type nnz2_;                     // number of nonzeros of M2 when the pattern was built
+    size_type nrows2_;                   // number of rows of M2 when the pattern was built
+    std::vector<index_type> entry_ptr_;  // size num_rows+1; entries of each row of the product
+    std::vector<index_type> entry_col_;  // column j of each entry
+    std::vector<index_type> pair_ptr_;   // size num_entries+1; pairs of nonzeros of each entry
+    std::vector<index_type> pair_k1_;    // nonzero of this of each pair
+    std::vector<index_type> pair_k2_;    // nonzero of M2 of each pair
+  };
+  mutable ProductPatternInfo* mdinvmt_pattern_;  // used by addMDinvMtransToDiagBlockOfSymDeMatUTri
+  mutable ProductPatternInfo* mdinvnt_pattern_;  // used by addMDinvNtransToSymDeMatUTri, for the last M2 only
+
 protected:
+  /// @brief Sets the indices of the nonzero `k`; returns true if they changed
+  inline bool set_nz_indices(index_type k, index_type i, index_type j)
+  {
+    const bool changed = iRow_[k] != i || jCol_[k] != j;
+    iRow_[k] = i;
+    jCol_[k] = j;
+    return changed;
+  }
+  /**
+   * @brief Discards the caches built from the sparsity pattern and renews the pattern id. The maps of
+   * `copyRowsFrom` and `copyRowsBlockFrom` are kept if `keep_copy_rows_maps`, which these methods use
+   * after rewriting the indices of their range of nonzeros.
+   */
+  virtual void drop_pattern_caches(bool keep_copy_rows_maps = false);
+
   RowStartsInfo* allocAndBuildRowStarts() const;
+  CompressedPatternInfo* alloc_and_build_compressed_pattern() const;
+  /// @brief Returns the compressed index of the pattern, building it if needed
+  const CompressedPatternInfo& get_compressed_pattern() const;
+
+  /// @brief Symbolic phase of this*D^{-1}*M2^T; only the entries (i,j) with j>=i are kept if `upper_only`
+  void build_product_pattern(const hiopMatrixSparseTriplet& M2, bool upper_only, ProductPatternInfo& ppi) const;
+  /// @brief Numeric phase: block of W += alpha * this * D^{-1} * M2^T over the entries of `ppi`
+  void add_product_w_pattern(const ProductPatternInfo& ppi,
+                             const hiopMatrixSparseTriplet& M2,
+                             const double& alpha,
+                             const double* DM,
+                             int row_dest_start,
+                             int col_dest_start,
+                             hiopMatrixDense& W) const;
+
+  /**
+   * @brief Returns the map cached for the nonzeros starting at `dest_nnz_st`, or nullptr if it was built for
+   * another copy. `rows_idxs` is nullptr for `copyRowsBlockFrom`.
+   */
+  const CopyRowsMap* find_copy_rows_map(size_type dest_nnz_st,
+                                        const hiopMatrix& src,
+                                        size_type n_rows,
+                                        index_type rows_src_st,
+                                        index_type rows_dest_st,
+                                        const index_type* rows_idxs) const;
+  /// @brief Registers an empty map for the nonzeros starting at `dest_nnz_st`, replacing the previous one
+  CopyRowsMap& new_copy_rows_map(size_type dest_nnz_st,
+                                 const hiopMatrix& src,
+                                 size_type n_rows,
+                                 index_type rows_src_st,
+                                 index_type rows_dest_st,
+                                 const index_type* rows_idxs);
+  /// @brief Gathers `values_[dest_nnz_st+k] = values_src[map.src_idx_[k]]`
+  void copy_values_w_map(const CopyRowsMap& map, const double* values_src, size_type dest_nnz_st);
 
 private:
   hiopMatrixSparseTriplet()
@@ -430,6 +561,12 @@ public:
   virtual void set_Hess_FR(const hiopMatrixSparse& Hess, int* iHSS, int* jHSS, double* MHSS, const hiopVector& add_diag);
 
 protected:
+  virtual void drop_pattern_caches(bool keep_copy_rows_maps = false)
+  {
+    hiopMatrixSparseTriplet::drop_pattern_caches(keep_copy_rows_maps);
+    nnz_offdiag_ = -1;
+  }
+
   mutable int nnz_offdiag_;  ///< number of nonzero entries
 };
 
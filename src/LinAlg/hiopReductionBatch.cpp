@@ -0,0 +1,366 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopReductionBatch.cpp
+ *
+ */
+
+#include "hiopReductionBatch.hpp"
+#include "hiopVectorPar.hpp"
+#include "hiopVectorCompoundPD.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace hiop
+{
+
+#ifdef HIOP_USE_MPI
+/**
+ * Reduction operation of the packed buffers of hiopReductionBatch: buf[0] is the number of sums, which are
+ * followed by the maxima. Each element of `datatype` is a full packed buffer.
+ */
+static void reduction_batch_op(void* in, void* inout, int* len, MPI_Datatype* datatype)
+{
+  int type_size;
+  MPI_Type_size(*datatype, &type_size);
+  const int n = type_size / static_cast<int>(sizeof(double));
+  const double* a = static_cast<const double*>(in);
+  double* b = static_cast<double*>(inout);
+  for(int e = 0; e < *len; e++, a += n, b += n) {
+    const int n_sum = static_cast<int>(a[0]);
+    for(int i = 1; i <= n_sum; i++) {
+      b[i] += a[i];
+    }
+    for(int i = n_sum + 1; i < n; i++) {
+      b[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+  }
+}
+
+/// The MPI operation of `reduction_batch_op`, created once, the first time a batch is reduced
+static MPI_Op reduction_batch_mpi_op()
+{
+  static MPI_Op op = []() {
+    MPI_Op new_op;
+    int ierr = MPI_Op_create(&reduction_batch_op, 1, &new_op);
+    assert(MPI_SUCCESS == ierr);
+    return new_op;
+  }();
+  return op;
+}
+#endif
+
+hiopReductionBatch::hiopReductionBatch(MPI_Comm comm)
+    : comm_(comm),
+      comm_size_(1),
+      comm_rank_(0),
+      in_progress_(false),
+      completed_(false)
+{
+#ifdef HIOP_USE_MPI
+  int ierr = MPI_Comm_size(comm_, &comm_size_);
+  assert(MPI_SUCCESS == ierr);
+  ierr = MPI_Comm_rank(comm_, &comm_rank_);
+  assert(MPI_SUCCESS == ierr);
+  request_ = MPI_REQUEST_NULL;
+  buf_type_ = MPI_DATATYPE_NULL;
+  buf_type_len_ = 0;
+#endif
+}
+
+hiopReductionBatch::~hiopReductionBatch()
+{
+#ifdef HIOP_USE_MPI
+  int finalized;
+  MPI_Finalized(&finalized);
+  if(!finalized) {
+    if(in_progress_) {
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+    }
+    if(buf_type_ != MPI_DATATYPE_NULL) {
+      MPI_Type_free(&buf_type_);
+    }
+  }
+#endif
+}
+
+void hiopReductionBatch::clear()
+{
+  assert(!in_progress_);
+  entries_.clear();
+  sums_.clear();
+  maxs_.clear();
+  done_.clear();
+  completed_ = false;
+}
+
+int hiopReductionBatch::add(ReductionType type, double local_value)
+{
+  assert(!in_progress_);
+  completed_ = false;
+  Entry e;
+  e.type = type;
+  switch(type) {
+    case Sum:
+      e.pos = static_cast<int>(sums_.size());
+      sums_.push_back(local_value);
+      break;
+    case TwoNorm:
+      e.pos = static_cast<int>(sums_.size());
+      sums_.push_back(local_value * local_value);
+      break;
+    case Max:
+      e.pos = static_cast<int>(maxs_.size());
+      maxs_.push_back(local_value);
+      break;
+    case Min:
+      e.pos = static_cast<int>(maxs_.size());
+      maxs_.push_back(-local_value);
+      break;
+    default:
+      e.pos = static_cast<int>(done_.size());
+      done_.push_back(local_value);
+  }
+  entries_.push_back(e);
+  return static_cast<int>(entries_.size()) - 1;
+}
+
+int hiopReductionBatch::add_sum(double local_value) { return add(Sum, local_value); }
+
+int hiopReductionBatch::add_max(double local_value) { return add(Max, local_value); }
+
+int hiopReductionBatch::add_min(double local_value) { return add(Min, local_value); }
+
+bool hiopReductionBatch::reduce_in_batch(const hiopVector& v) const
+{
+  const hiopVectorPar* vp = dynamic_cast<const hiopVectorPar*>(&v);
+  if(nullptr == vp) {
+    return false;
+  }
+#ifdef HIOP_USE_MPI
+  int result;
+  int ierr = MPI_Comm_compare(vp->get_mpi_comm(), comm_, &result);
+  assert(MPI_SUCCESS == ierr);
+  return result == MPI_IDENT || result == MPI_CONGRUENT;
+#else
+  return true;
+#endif
+}
+
+int hiopReductionBatch::add_onenorm(const hiopVector& v)
+{
+  return reduce_in_batch(v) ? add(Sum, v.onenorm_local()) : add(Done, v.onenorm());
+}
+
+int hiopReductionBatch::add_infnorm(const hiopVector& v)
+{
+  return reduce_in_batch(v) ? add(Max, v.infnorm_local()) : add(Done, v.infnorm());
+}
+
+int hiopReductionBatch::add_twonorm(const hiopVector& v)
+{
+  if(reduce_in_batch(v)) {
+    return add(TwoNorm, static_cast<const hiopVectorPar&>(v).twonorm_local());
+  }
+  return add(Done, v.twonorm());
+}
+
+int hiopReductionBatch::add_dot(const hiopVector& u, const hiopVector& v)
+{
+  if(reduce_in_batch(u)) {
+    return add(Sum, static_cast<const hiopVectorPar&>(u).dotProductWith_local(v));
+  }
+  return add(Done, u.dotProductWith(v));
+}
+
+/**
+ * Adds the dot products of `u` with `vecs` to `local_sums` when they are reduced in the batch, otherwise adds
+ * their global values to `global_vals`.
+ */
+void hiopReductionBatch::accumulate_dots(const hiopVector& u,
+                                         int nvecs,
+                                         const hiopVector* const* vecs,
+                                         double* local_sums,
+                                         double* global_vals) const
+{
+  std::vector<double> dots(nvecs);
+  const hiopVectorCompoundPD* uc = dynamic_cast<const hiopVectorCompoundPD*>(&u);
+  if(nullptr != uc) {
+    std::vector<const hiopVector*> parts(nvecs);
+    for(index_type p = 0; p < uc->get_num_parts(); p++) {
+      for(int k = 0; k < nvecs; k++) {
+        parts[k] = &static_cast<const hiopVectorCompoundPD*>(vecs[k])->getVector(p);
+      }
+      accumulate_dots(uc->getVector(p), nvecs, parts.data(), local_sums, global_vals);
+    }
+  } else if(reduce_in_batch(u)) {
+    static_cast<const hiopVectorPar&>(u).dot_products_with_local(nvecs, vecs, dots.data());
+    for(int k = 0; k < nvecs; k++) {
+      local_sums[k] += dots[k];
+    }
+  } else {
+    for(int k = 0; k < nvecs; k++) {
+      global_vals[k] += u.dotProductWith(*vecs[k]);
+    }
+  }
+}
+
+int hiopReductionBatch::add_dots(const hiopVector& u, int nvecs, const hiopVector* const* vecs)
+{
+  std::vector<double> local_sums(nvecs, 0.), global_vals(nvecs, 0.);
+  accumulate_dots(u, nvecs, vecs, local_sums.data(), global_vals.data());
+  // the values that are already global are added on one rank only
+  const int first = static_cast<int>(entries_.size());
+  for(int k = 0; k < nvecs; k++) {
+    add(Sum, 0 == comm_rank_ ? local_sums[k] + global_vals[k] : local_sums[k]);
+  }
+  return first;
+}
+
+int hiopReductionBatch::add_min(const hiopVector& v)
+{
+  if(reduce_in_batch(v)) {
+    return add(Min, static_cast<const hiopVectorPar&>(v).min_local());
+  }
+  return add(Done, v.min());
+}
+
+int hiopReductionBatch::add_min_w_pattern(const hiopVector& v, const hiopVector& select)
+{
+  if(reduce_in_batch(v)) {
+    return add(Min, static_cast<const hiopVectorPar&>(v).min_w_pattern_local(select));
+  }
+  return add(Done, v.min_w_pattern(select));
+}
+
+int hiopReductionBatch::add_all_positive(const hiopVector& v)
+{
+  if(reduce_in_batch(v)) {
+    return add(Min, static_cast<const hiopVectorPar&>(v).allPositive_local());
+  }
+  // allPositive does not modify the vector, but is not declared const by hiopVector
+  return add(Done, const_cast<hiopVector&>(v).allPositive());
+}
+
+void hiopReductionBatch::start([[maybe_unused]] bool nonblocking /*=false*/)
+{
+  assert(!in_progress_);
+  const int n_sum = static_cast<int>(sums_.size());
+  const int len = 1 + n_sum + static_cast<int>(maxs_.size());
+  buf_send_.resize(len);
+  buf_recv_.resize(len);
+  buf_send_[0] = n_sum;
+  std::copy(sums_.begin(), sums_.end(), buf_send_.begin() + 1);
+  std::copy(maxs_.begin(), maxs_.end(), buf_send_.begin() + 1 + n_sum);
+
+  if(comm_size_ == 1 || len == 1) {
+    buf_recv_ = buf_send_;
+    completed_ = true;
+    return;
+  }
+#ifdef HIOP_USE_MPI
+  if(buf_type_len_ != len) {
+    if(buf_type_ != MPI_DATATYPE_NULL) {
+      MPI_Type_free(&buf_type_);
+    }
+    int ierr = MPI_Type_contiguous(len, MPI_DOUBLE, &buf_type_);
+    assert(MPI_SUCCESS == ierr);
+    ierr = MPI_Type_commit(&buf_type_);
+    assert(MPI_SUCCESS == ierr);
+    buf_type_len_ = len;
+  }
+  MPI_Op op = reduction_batch_mpi_op();
+  if(nonblocking) {
+    int ierr = MPI_Iallreduce(buf_send_.data(), buf_recv_.data(), 1, buf_type_, op, comm_, &request_);
+    assert(MPI_SUCCESS == ierr);
+    in_progress_ = true;
+  } else {
+    int ierr = MPI_Allreduce(buf_send_.data(), buf_recv_.data(), 1, buf_type_, op, comm_);
+    assert(MPI_SUCCESS == ierr);
+    completed_ = true;
+  }
+#endif
+}
+
+void hiopReductionBatch::wait()
+{
+#ifdef HIOP_USE_MPI
+  if(in_progress_) {
+    int ierr = MPI_Wait(&request_, MPI_STATUS_IGNORE);
+    assert(MPI_SUCCESS == ierr);
+    in_progress_ = false;
+    completed_ = true;
+  }
+#endif
+  assert(completed_ && "start should be called before wait");
+}
+
+double hiopReductionBatch::value(int k) const
+{
+  assert(completed_);
+  assert(k >= 0 && k < size());
+  const Entry& e = entries_[k];
+  const int n_sum = static_cast<int>(sums_.size());
+  switch(e.type) {
+    case Sum:
+      return buf_recv_[1 + e.pos];
+    case TwoNorm:
+      return std::sqrt(buf_recv_[1 + e.pos]);
+    case Max:
+      return buf_recv_[1 + n_sum + e.pos];
+    case Min:
+      return -buf_recv_[1 + n_sum + e.pos];
+    default:
+      return done_[e.pos];
+  }
+}
+
+}  // namespace hiop
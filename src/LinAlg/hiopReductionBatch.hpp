@@ -0,0 +1,174 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopReductionBatch.hpp
+ *
+ * Batched global reductions of (distributed) vectors.
+ *
+ */
+
+#pragma once
+
+#include "hiopVector.hpp"
+
+#include <hiopMPI.hpp>
+#include <vector>
+
+namespace hiop
+{
+/**
+ * Batch of global reductions (sums, maxima and minima) over the ranks of an MPI communicator, which are
+ * completed together with a single MPI_Allreduce (or MPI_Iallreduce) of a packed buffer instead of one
+ * MPI_Allreduce per reduction, as done by the reductions of hiopVectorPar.
+ *
+ * The local values are queued with the `add_*` methods, which return the index of the reduction in the
+ * batch. `start` initiates the reduction of all the queued values, `wait` completes it and `value(k)` returns
+ * the global result of the k-th reduction. When `start` is nonblocking, computations that do not depend on
+ * the results can be overlapped with the communication before calling `wait`. `clear` empties the batch so
+ * that it can be reused, which avoids allocations in the loops of the solver.
+ *
+ * The vector methods use the local reductions of hiopVectorPar for the vectors distributed over the
+ * communicator of the batch. Other vectors (for example the ones replicated on all ranks, which use
+ * MPI_COMM_SELF) are reduced with the vector's own global method when queued.
+ *
+ * All the ranks of the communicator must queue the same reductions in the same order.
+ */
+class hiopReductionBatch
+{
+public:
+  hiopReductionBatch(MPI_Comm comm);
+  virtual ~hiopReductionBatch();
+
+  /// Removes all the reductions from the batch
+  void clear();
+
+  /// Queue the reduction of a local value; returns the index of the reduction in the batch
+  int add_sum(double local_value);
+  int add_max(double local_value);
+  int add_min(double local_value);
+
+  /// Queue the global reductions of vectors; return the index of the reduction in the batch
+  int add_onenorm(const hiopVector& v);
+  int add_infnorm(const hiopVector& v);
+  int add_twonorm(const hiopVector& v);
+  int add_dot(const hiopVector& u, const hiopVector& v);
+  /**
+   * Queue the dot products of `u` with `vecs[0]`, ..., `vecs[nvecs-1]`, which have the same type and partitioning
+   * as `u`; returns the index of the first one, the others follow. The local dot products are computed in one pass
+   * over `u`. For hiopVectorCompoundPD's, the dot products of the parts are added up before the reduction.
+   */
+  int add_dots(const hiopVector& u, int nvecs, const hiopVector* const* vecs);
+  int add_min(const hiopVector& v);
+  int add_min_w_pattern(const hiopVector& v, const hiopVector& select);
+  int add_all_positive(const hiopVector& v);
+
+  /// Initiates the reduction of the queued values; with `nonblocking` it returns before it is completed
+  void start(bool nonblocking = false);
+
+  /// Completes the reduction initiated by `start`
+  void wait();
+
+  /// Blocking reduction of the queued values
+  void reduce()
+  {
+    start();
+    wait();
+  }
+
+  /// Global result of the k-th reduction; available after `wait`
+  double value(int k) const;
+
+  /// Number of reductions in the batch
+  int size() const { return static_cast<int>(entries_.size()); }
+
+private:
+  enum ReductionType
+  {
+    Sum = 0,
+    Max,
+    Min,
+    TwoNorm,  // sum of the squares, followed by a square root
+    Done      // reduced when queued
+  };
+  struct Entry
+  {
+    ReductionType type;
+    int pos;  // position in `sums_`, `maxs_` or `done_`
+  };
+  int add(ReductionType type, double local_value);
+  /// true if `v` is a hiopVectorPar distributed over the communicator of the batch
+  bool reduce_in_batch(const hiopVector& v) const;
+  void accumulate_dots(const hiopVector& u,
+                       int nvecs,
+                       const hiopVector* const* vecs,
+                       double* local_sums,
+                       double* global_vals) const;
+
+  MPI_Comm comm_;
+  int comm_size_;
+  int comm_rank_;
+  std::vector<Entry> entries_;
+  /// local values of the sums and of the maxima (minima are stored negated)
+  std::vector<double> sums_;
+  std::vector<double> maxs_;
+  std::vector<double> done_;
+  /// packed buffers: the number of sums, the sums and then the maxima
+  std::vector<double> buf_send_;
+  std::vector<double> buf_recv_;
+  bool in_progress_;
+  bool completed_;
+#ifdef HIOP_USE_MPI
+  MPI_Request request_;
+  /// the packed buffer is reduced as one element of this type so that the reduction operation sees all of it
+  MPI_Datatype buf_type_;
+  int buf_type_len_;
+#endif
+};
+
+}  // namespace hiop
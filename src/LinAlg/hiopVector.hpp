@@ -840,6 +840,88 @@ public:
    */
   virtual void adjustDuals_plh(const hiopVector& xvec, const hiopVector& ixvec, const double& mu, const double& kappa) = 0;
 
+  /**
+   * @brief Fused copy and axpy: this[i] = base[i] + alpha * dir[i].
+   *
+   * Equivalent to `copyFrom(base)` followed by `axpy(alpha, dir)`, but performed in a single pass.
+   *
+   * @pre `this`, `base` and `dir` have same partitioning.
+   * @post `base` and `dir` are not modified
+   */
+  virtual void copy_from_axpy(const hiopVector& base, const double& alpha, const hiopVector& dir) = 0;
+
+  /**
+   * @brief Bound residual with pattern select: this[i] = a[i] - b[i] - c[i] if select[i] == 1, and 0 otherwise.
+   *
+   * Performs in a single pass the sequence `copyFrom(a)`, `axpy(-1,b)`, `axpy(-1,c)`, `selectPattern(select)`
+   * and `infnorm_local()` used for the residuals of the bound constraints.
+   *
+   * @return Local infinity norm of `this`.
+   *
+   * @pre `this`, `a`, `b`, `c` and `select` have same partitioning.
+   * @pre Elements of `select` are either 0 or 1.
+   * @post `a`, `b`, `c` and `select` are not modified
+   *
+   * @warning This is local method only!
+   */
+  virtual double bound_residual_w_pattern_local(const hiopVector& a,
+                                                const hiopVector& b,
+                                                const hiopVector& c,
+                                                const hiopVector& select) = 0;
+
+  /**
+   * @brief Complementarity residual: this[i] = mu - s[i]*z[i] if select[i] == 1, and 0 otherwise.
+   *
+   * Computes in a single pass the residual of the perturbed complementarity and the local infinity
+   * norms of both the perturbed (barrier) and unperturbed (NLP) complementarity residuals.
+   *
+   * @param[in] mu - log-barrier parameter
+   * @param[in] s - slacks
+   * @param[in] z - duals of the slacks
+   * @param[in] select - pattern selection
+   * @param[out] nrm_inf_nlp - local infinity norm of s.*z over the entries selected by `select`
+   * @return Local infinity norm of `this`, i.e., of the barrier complementarity residual.
+   *
+   * @pre `this`, `s`, `z` and `select` have same partitioning.
+   * @pre Elements of `select` are either 0 or 1.
+   * @post `s`, `z` and `select` are not modified
+   *
+   * @warning This is local method only!
+   */
+  virtual double complementarity_residual_local(const double& mu,
+                                                const hiopVector& s,
+                                                const hiopVector& z,
+                                                const hiopVector& select,
+                                                double& nrm_inf_nlp) = 0;
+
+  /**
+   * @brief Fraction-to-the-boundary for a slack-dual pair sharing the pattern `select`.
+   *
+   * Computes in a single pass the result of `fractionToTheBdry_w_pattern_local` for the slack `this` and its
+   * direction `ds`, and for the dual `z` and its direction `dz`.
+   *
+   * @param[in] ds - direction of the slack (`this`)
+   * @param[in] z - dual of the slack
+   * @param[in] dz - direction of the dual
+   * @param[in] tau - fraction-to-the-boundary parameter
+   * @param[in] select - pattern selection
+   * @param[out] alpha_primal - max{a\in(0,1]| this+a*ds >=(1-tau)this} over selected entries
+   * @param[out] alpha_dual - max{a\in(0,1]| z+a*dz >=(1-tau)z} over selected entries
+   *
+   * @pre `this`, `ds`, `z`, `dz` and `select` have same partitioning.
+   * @pre Elements of `select` are either 0 or 1.
+   * @post `this`, `ds`, `z`, `dz` and `select` are not modified
+   *
+   * @warning This is local method only!
+   */
+  virtual void fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& ds,
+                                                         const hiopVector& z,
+                                                         const hiopVector& dz,
+                                                         const double& tau,
+                                                         const hiopVector& select,
+                                                         double& alpha_primal,
+                                                         double& alpha_dual) const = 0;
+
   /**
    * @brief Check if all elements of the vector are zero
    *
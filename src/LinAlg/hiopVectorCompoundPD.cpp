@@ -889,6 +889,93 @@ void hiopVectorCompoundPD::adjustDuals_plh(const hiopVector& x_,
   }
 }
 
+void hiopVectorCompoundPD::copy_from_axpy(const hiopVector& base_, const double& alpha, const hiopVector& dir_)
+{
+  const hiopVectorCompoundPD& base = dynamic_cast<const hiopVectorCompoundPD&>(base_);
+  const hiopVectorCompoundPD& dir = dynamic_cast<const hiopVectorCompoundPD&>(dir_);
+  assert(this->get_num_parts() == base.get_num_parts());
+  assert(this->get_num_parts() == dir.get_num_parts());
+
+  for(index_type i = 0; i < n_parts_; i++) {
+    vectors_[i]->copy_from_axpy(base.getVector(i), alpha, dir.getVector(i));
+  }
+}
+
+double hiopVectorCompoundPD::bound_residual_w_pattern_local(const hiopVector& a_,
+                                                            const hiopVector& b_,
+                                                            const hiopVector& c_,
+                                                            const hiopVector& select)
+{
+  const hiopVectorCompoundPD& a = dynamic_cast<const hiopVectorCompoundPD&>(a_);
+  const hiopVectorCompoundPD& b = dynamic_cast<const hiopVectorCompoundPD&>(b_);
+  const hiopVectorCompoundPD& c = dynamic_cast<const hiopVectorCompoundPD&>(c_);
+  const hiopVectorCompoundPD& ix = dynamic_cast<const hiopVectorCompoundPD&>(select);
+  assert(this->get_num_parts() == a.get_num_parts());
+  assert(this->get_num_parts() == ix.get_num_parts());
+
+  double nrm = 0.0;
+  for(index_type i = 0; i < n_parts_; i++) {
+    const double aux =
+        vectors_[i]->bound_residual_w_pattern_local(a.getVector(i), b.getVector(i), c.getVector(i), ix.getVector(i));
+    nrm = std::max(nrm, aux);
+  }
+  return nrm;
+}
+
+double hiopVectorCompoundPD::complementarity_residual_local(const double& mu,
+                                                            const hiopVector& s_,
+                                                            const hiopVector& z_,
+                                                            const hiopVector& select,
+                                                            double& nrm_inf_nlp)
+{
+  const hiopVectorCompoundPD& s = dynamic_cast<const hiopVectorCompoundPD&>(s_);
+  const hiopVectorCompoundPD& z = dynamic_cast<const hiopVectorCompoundPD&>(z_);
+  const hiopVectorCompoundPD& ix = dynamic_cast<const hiopVectorCompoundPD&>(select);
+  assert(this->get_num_parts() == s.get_num_parts());
+  assert(this->get_num_parts() == ix.get_num_parts());
+
+  double nrm_bar = 0.0;
+  nrm_inf_nlp = 0.0;
+  for(index_type i = 0; i < n_parts_; i++) {
+    double nrm_nlp_i;
+    const double nrm_bar_i =
+        vectors_[i]->complementarity_residual_local(mu, s.getVector(i), z.getVector(i), ix.getVector(i), nrm_nlp_i);
+    nrm_bar = std::max(nrm_bar, nrm_bar_i);
+    nrm_inf_nlp = std::max(nrm_inf_nlp, nrm_nlp_i);
+  }
+  return nrm_bar;
+}
+
+void hiopVectorCompoundPD::fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& ds_,
+                                                                     const hiopVector& z_,
+                                                                     const hiopVector& dz_,
+                                                                     const double& tau,
+                                                                     const hiopVector& select,
+                                                                     double& alpha_primal,
+                                                                     double& alpha_dual) const
+{
+  const hiopVectorCompoundPD& ds = dynamic_cast<const hiopVectorCompoundPD&>(ds_);
+  const hiopVectorCompoundPD& z = dynamic_cast<const hiopVectorCompoundPD&>(z_);
+  const hiopVectorCompoundPD& dz = dynamic_cast<const hiopVectorCompoundPD&>(dz_);
+  const hiopVectorCompoundPD& ix = dynamic_cast<const hiopVectorCompoundPD&>(select);
+  assert(this->get_num_parts() == ds.get_num_parts());
+  assert(this->get_num_parts() == ix.get_num_parts());
+
+  alpha_primal = alpha_dual = 1.0;
+  for(index_type i = 0; i < n_parts_; i++) {
+    double alpha_p, alpha_d;
+    vectors_[i]->fraction_to_the_bdry_pair_w_pattern_local(ds.getVector(i),
+                                                           z.getVector(i),
+                                                           dz.getVector(i),
+                                                           tau,
+                                                           ix.getVector(i),
+                                                           alpha_p,
+                                                           alpha_d);
+    alpha_primal = std::min(alpha_primal, alpha_p);
+    alpha_dual = std::min(alpha_dual, alpha_d);
+  }
+}
+
 bool hiopVectorCompoundPD::is_zero() const
 {
   int all_zero = true;
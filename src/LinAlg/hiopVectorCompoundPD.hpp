@@ -283,6 +283,24 @@ public:
 
   virtual void adjustDuals_plh(const hiopVector& x, const hiopVector& ix, const double& mu, const double& kappa);
 
+  virtual void copy_from_axpy(const hiopVector& base, const double& alpha, const hiopVector& dir);
+  virtual double bound_residual_w_pattern_local(const hiopVector& a,
+                                                const hiopVector& b,
+                                                const hiopVector& c,
+                                                const hiopVector& select);
+  virtual double complementarity_residual_local(const double& mu,
+                                                const hiopVector& s,
+                                                const hiopVector& z,
+                                                const hiopVector& select,
+                                                double& nrm_inf_nlp);
+  virtual void fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& ds,
+                                                         const hiopVector& z,
+                                                         const hiopVector& dz,
+                                                         const double& tau,
+                                                         const hiopVector& select,
+                                                         double& alpha_primal,
+                                                         double& alpha_dual) const;
+
   virtual bool is_zero() const;
   virtual bool isnan_local() const;
   virtual bool isinf_local() const;
@@ -891,6 +891,83 @@ void hiopVectorCuda::adjustDuals_plh(const hiopVector& xvec, const hiopVector& i
   hiop::cuda::adjustDuals_plh_kernel(n_local_, zd, xd, id, mu, kappa);
 }
 
+/** @brief this = base + alpha * dir */
+void hiopVectorCuda::copy_from_axpy(const hiopVector& base, const double& alpha, const hiopVector& dir)
+{
+  assert(base.get_local_size() == n_local_);
+  assert(dir.get_local_size() == n_local_);
+  hiop::cuda::copy_from_axpy_kernel(n_local_, data_, base.local_data_const(), alpha, dir.local_data_const());
+}
+
+/** @brief this = select ? (a - b - c) : 0; returns the local inf-norm of `this` */
+double hiopVectorCuda::bound_residual_w_pattern_local(const hiopVector& a,
+                                                      const hiopVector& b,
+                                                      const hiopVector& c,
+                                                      const hiopVector& select)
+{
+#ifdef HIOP_DEEPCHECKS
+  assert(a.get_local_size() == n_local_);
+  assert(b.get_local_size() == n_local_);
+  assert(c.get_local_size() == n_local_);
+  assert(select.get_local_size() == n_local_);
+#endif
+  return hiop::cuda::bound_residual_w_pattern_kernel(n_local_,
+                                                     data_,
+                                                     a.local_data_const(),
+                                                     b.local_data_const(),
+                                                     c.local_data_const(),
+                                                     select.local_data_const());
+}
+
+/** @brief this = select ? (mu - s*z) : 0; returns the local inf-norm of `this` */
+double hiopVectorCuda::complementarity_residual_local(const double& mu,
+                                                      const hiopVector& s,
+                                                      const hiopVector& z,
+                                                      const hiopVector& select,
+                                                      double& nrm_inf_nlp)
+{
+#ifdef HIOP_DEEPCHECKS
+  assert(s.get_local_size() == n_local_);
+  assert(z.get_local_size() == n_local_);
+  assert(select.get_local_size() == n_local_);
+#endif
+  return hiop::cuda::complementarity_residual_kernel(n_local_,
+                                                     data_,
+                                                     mu,
+                                                     s.local_data_const(),
+                                                     z.local_data_const(),
+                                                     select.local_data_const(),
+                                                     nrm_inf_nlp);
+}
+
+/** @brief fraction-to-the-boundary step lengths of the slack `this` and its dual `z` with pattern `select` */
+void hiopVectorCuda::fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& ds,
+                                                               const hiopVector& z,
+                                                               const hiopVector& dz,
+                                                               const double& tau,
+                                                               const hiopVector& select,
+                                                               double& alpha_primal,
+                                                               double& alpha_dual) const
+{
+#ifdef HIOP_DEEPCHECKS
+  assert(ds.get_local_size() == n_local_);
+  assert(z.get_local_size() == n_local_);
+  assert(dz.get_local_size() == n_local_);
+  assert(select.get_local_size() == n_local_);
+  assert(tau > 0);
+  assert(tau < 1);
+#endif
+  hiop::cuda::min_frac_to_bds_pair_w_pattern_kernel(n_local_,
+                                                    data_,
+                                                    ds.local_data_const(),
+                                                    z.local_data_const(),
+                                                    dz.local_data_const(),
+                                                    select.local_data_const(),
+                                                    tau,
+                                                    alpha_primal,
+                                                    alpha_dual);
+}
+
 /** @brief Check if all elements of the vector are zero */
 bool hiopVectorCuda::is_zero() const { return hiop::cuda::is_zero_kernel(n_local_, data_); }
 
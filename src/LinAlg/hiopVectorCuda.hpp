@@ -292,6 +292,25 @@ public:
   /// @brief dual adjustment -> see hiopIterate::adjustDuals_primalLogHessian
   virtual void adjustDuals_plh(const hiopVector& xvec, const hiopVector& ixvec, const double& mu, const double& kappa);
 
+  /// @brief fused kernels used by hiopResidual and hiopIterate
+  virtual void copy_from_axpy(const hiopVector& base, const double& alpha, const hiopVector& dir);
+  virtual double bound_residual_w_pattern_local(const hiopVector& a,
+                                                const hiopVector& b,
+                                                const hiopVector& c,
+                                                const hiopVector& select);
+  virtual double complementarity_residual_local(const double& mu,
+                                                const hiopVector& s,
+                                                const hiopVector& z,
+                                                const hiopVector& select,
+                                                double& nrm_inf_nlp);
+  virtual void fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& ds,
+                                                         const hiopVector& z,
+                                                         const hiopVector& dz,
+                                                         const double& tau,
+                                                         const hiopVector& select,
+                                                         double& alpha_primal,
+                                                         double& alpha_dual) const;
+
   /// @brief True if all elements of this are zero. TODO: add unit test
   virtual bool is_zero() const;
   /// @brief check for nans in the local vector
@@ -58,6 +58,7 @@
 
 #include "hiop_blasdefs.hpp"
 #include "MathKernelsHost.hpp"
+#include "hiopOMP.hpp"
 
 #include <limits>
 #include <cstddef>
@@ -125,12 +126,14 @@ hiopVector* hiopVectorPar::new_copy() const
 
 void hiopVectorPar::setToZero()
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     data_[i] = 0.0;
   }
 }
 void hiopVectorPar::setToConstant(double c)
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     data_[i] = c;
   }
@@ -145,6 +148,7 @@ void hiopVectorPar::setToConstant_w_patternSelect(double c, const hiopVector& se
 {
   const hiopVectorPar& s = dynamic_cast<const hiopVectorPar&>(select);
   const double* svec = s.data_;
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     if(svec[i] == 1.) {
       data_[i] = c;
@@ -186,6 +190,7 @@ void hiopVectorPar::copy_from_w_pattern(const hiopVector& vv, const hiopVector&
   const double* ix_vec = ix.data_;
   const double* v_vec = v.data_;
 
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(index_type i = 0; i < n_local_; i++) {
     if(ix_vec[i] == 1.) {
       data_[i] = v_vec[i];
@@ -203,6 +208,7 @@ void hiopVectorPar::copy_from_indexes(const hiopVector& vv, const hiopVectorInt&
 
   const index_type* index_arr = indexes.local_data_const();
   size_type nv = v.get_local_size();
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(index_type i = 0; i < n_local_; i++) {
     assert(index_arr[i] < nv);
     this->data_[i] = v.data_[index_arr[i]];
@@ -216,6 +222,7 @@ void hiopVectorPar::copy_from_indexes(const double* vv, const hiopVectorInt& ind
     const hiopVectorIntSeq& indexes = dynamic_cast<const hiopVectorIntSeq&>(index_in_src);
     const index_type* index_arr = indexes.local_data_const();
     assert(indexes.get_local_size() == n_local_);
+    HIOP_OMP_PARFOR_SIMD(n_local_)
     for(int i = 0; i < n_local_; i++) {
       this->data_[i] = vv[index_arr[i]];
     }
@@ -457,13 +464,7 @@ void hiopVectorPar::copyTo(double* dest) const
 
 double hiopVectorPar::twonorm() const
 {
-  int one = 1;
-  int n = n_local_;
-  double nrm = 0.;
-  if(n > 0) {
-    nrm = DNRM2(&n, data_, &one);
-  }
-
+  double nrm = twonorm_local();
 #ifdef HIOP_USE_MPI
   nrm *= nrm;
   double nrmG;
@@ -474,19 +475,30 @@ double hiopVectorPar::twonorm() const
   return nrm;
 }
 
-double hiopVectorPar::dotProductWith(const hiopVector& v_) const
+double hiopVectorPar::twonorm_local() const
 {
-  const hiopVectorPar& v = dynamic_cast<const hiopVectorPar&>(v_);
+  double nrm = 0.;
+#ifdef HIOP_USE_OPENMP
+  // norms of the blocks combined with scaling by the deterministic blocked reduction
+  nrm = omp::reduce_norm2(n_local_, [&](size_type begin, size_type end) {
+    int one = 1;
+    int n = end - begin;
+    return DNRM2(&n, data_ + begin, &one);
+  });
+#else
   int one = 1;
   int n = n_local_;
-  assert(this->n_local_ == v.n_local_);
-
-  double dotprod;
   if(n > 0) {
-    dotprod = DDOT(&n, this->data_, &one, v.data_, &one);
-  } else {
-    dotprod = 0.;
+    nrm = DNRM2(&n, data_, &one);
   }
+#endif
+
+  return nrm;
+}
+
+double hiopVectorPar::dotProductWith(const hiopVector& v_) const
+{
+  double dotprod = dotProductWith_local(v_);
 #ifdef HIOP_USE_MPI
   double dotprodG;
   int ierr = MPI_Allreduce(&dotprod, &dotprodG, 1, MPI_DOUBLE, MPI_SUM, comm_);
@@ -497,19 +509,52 @@ double hiopVectorPar::dotProductWith(const hiopVector& v_) const
   return dotprod;
 }
 
-double hiopVectorPar::infnorm() const
+double hiopVectorPar::dotProductWith_local(const hiopVector& v_) const
 {
-  assert(n_local_ >= 0);
-  double nrm = 0.;
-  if(n_local_ != 0) {
-    nrm = fabs(data_[0]);
-    double aux;
+  const hiopVectorPar& v = dynamic_cast<const hiopVectorPar&>(v_);
+  assert(this->n_local_ == v.n_local_);
+
+  return omp::reduce_sum(n_local_, [&](size_type begin, size_type end) {
+    int one = 1;
+    int n = end - begin;
+    return n > 0 ? DDOT(&n, this->data_ + begin, &one, v.data_ + begin, &one) : 0.;
+  });
+}
 
-    for(int i = 1; i < n_local_; i++) {
-      aux = fabs(data_[i]);
-      if(aux > nrm) nrm = aux;
+void hiopVectorPar::dot_products_with_local(int nvecs, const hiopVector* const* vecs, double* dots) const
+{
+  std::vector<double*> vdata(nvecs);
+  for(int k = 0; k < nvecs; k++) {
+    const hiopVectorPar& v = dynamic_cast<const hiopVectorPar&>(*vecs[k]);
+    assert(this->n_local_ == v.n_local_);
+    vdata[k] = v.data_;
+    dots[k] = 0.;
+  }
+  if(0 == n_local_ || 0 == nvecs) {
+    return;
+  }
+  // same blocks as omp::reduce_sum; the partial sums are added in block order
+  const size_type nblocks = (n_local_ + omp::reduce_block_len - 1) / omp::reduce_block_len;
+  std::vector<double> partial(nblocks * nvecs);
+  HIOP_OMP_PARFOR(n_local_)
+  for(size_type b = 0; b < nblocks; ++b) {
+    const size_type begin = b * omp::reduce_block_len;
+    int n = static_cast<int>(std::min(n_local_, begin + omp::reduce_block_len) - begin);
+    int one = 1;
+    for(int k = 0; k < nvecs; k++) {
+      partial[b * nvecs + k] = DDOT(&n, data_ + begin, &one, vdata[k] + begin, &one);
     }
   }
+  for(size_type b = 0; b < nblocks; ++b) {
+    for(int k = 0; k < nvecs; k++) {
+      dots[k] += partial[b * nvecs + k];
+    }
+  }
+}
+
+double hiopVectorPar::infnorm() const
+{
+  double nrm = infnorm_local();
 #ifdef HIOP_USE_MPI
   double nrm_glob;
   int ierr = MPI_Allreduce(&nrm, &nrm_glob, 1, MPI_DOUBLE, MPI_MAX, comm_);
@@ -524,24 +569,17 @@ double hiopVectorPar::infnorm_local() const
 {
   assert(n_local_ >= 0);
   double nrm = 0.;
-  if(n_local_ > 0) {
-    nrm = fabs(data_[0]);
-    double aux;
-
-    for(int i = 1; i < n_local_; i++) {
-      aux = fabs(data_[i]);
-      if(aux > nrm) nrm = aux;
-    }
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, max, nrm)
+  for(int i = 0; i < n_local_; i++) {
+    const double aux = fabs(data_[i]);
+    nrm = aux > nrm ? aux : nrm;
   }
   return nrm;
 }
 
 double hiopVectorPar::onenorm() const
 {
-  double nrm1 = 0.;
-  for(int i = 0; i < n_local_; i++) {
-    nrm1 += fabs(data_[i]);
-  }
+  double nrm1 = onenorm_local();
 #ifdef HIOP_USE_MPI
   double nrm1_global;
   int ierr = MPI_Allreduce(&nrm1, &nrm1_global, 1, MPI_DOUBLE, MPI_SUM, comm_);
@@ -553,17 +591,21 @@ double hiopVectorPar::onenorm() const
 
 double hiopVectorPar::onenorm_local() const
 {
-  double nrm1 = 0.;
-  for(int i = 0; i < n_local_; i++) {
-    nrm1 += fabs(data_[i]);
-  }
-  return nrm1;
+  return omp::reduce_sum(n_local_, [&](size_type begin, size_type end) {
+    double nrm1 = 0.;
+    HIOP_OMP_SIMD_REDUCE(+, nrm1)
+    for(int i = begin; i < end; i++) {
+      nrm1 += fabs(data_[i]);
+    }
+    return nrm1;
+  });
 }
 
 void hiopVectorPar::componentMult(const hiopVector& v_)
 {
   const hiopVectorPar& v = dynamic_cast<const hiopVectorPar&>(v_);
   assert(n_local_ == v.n_local_);
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; ++i) {
     data_[i] *= v.data_[i];
   }
@@ -573,6 +615,7 @@ void hiopVectorPar::componentDiv(const hiopVector& v_)
 {
   const hiopVectorPar& v = dynamic_cast<const hiopVectorPar&>(v_);
   assert(n_local_ == v.n_local_);
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) data_[i] /= v.data_[i];
 }
 
@@ -585,6 +628,7 @@ void hiopVectorPar::componentDiv_w_selectPattern(const hiopVector& v_, const hio
   assert(n_local_ == ix.n_local_);
 #endif
   double *s = this->data_, *x = v.data_, *pattern = ix.data_;
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++)
     if(pattern[i] == 0.0)
       s[i] = 0.0;
@@ -594,6 +638,7 @@ void hiopVectorPar::componentDiv_w_selectPattern(const hiopVector& v_, const hio
 
 void hiopVectorPar::component_min(const double constant)
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     if(data_[i] > constant) {
       data_[i] = constant;
@@ -605,6 +650,7 @@ void hiopVectorPar::component_min(const hiopVector& v_)
 {
   const hiopVectorPar& v = dynamic_cast<const hiopVectorPar&>(v_);
   assert(n_local_ == v.n_local_);
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     if(data_[i] > v.data_[i]) {
       data_[i] = v.data_[i];
@@ -614,6 +660,7 @@ void hiopVectorPar::component_min(const hiopVector& v_)
 
 void hiopVectorPar::component_max(const double constant)
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     if(data_[i] < constant) {
       data_[i] = constant;
@@ -625,6 +672,7 @@ void hiopVectorPar::component_max(const hiopVector& v_)
 {
   const hiopVectorPar& v = dynamic_cast<const hiopVectorPar&>(v_);
   assert(n_local_ == v.n_local_);
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     if(data_[i] < v.data_[i]) {
       data_[i] = v.data_[i];
@@ -634,6 +682,7 @@ void hiopVectorPar::component_max(const hiopVector& v_)
 
 void hiopVectorPar::component_abs()
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     data_[i] = fabs(data_[i]);
   }
@@ -641,6 +690,7 @@ void hiopVectorPar::component_abs()
 
 void hiopVectorPar::component_sgn()
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     int sign = (0.0 < data_[i]) - (data_[i] < 0.0);
     data_[i] = static_cast<double>(sign);
@@ -649,6 +699,7 @@ void hiopVectorPar::component_sgn()
 
 void hiopVectorPar::component_sqrt()
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
     assert(data_[i] >= 0);
     data_[i] = std::sqrt(data_[i]);
@@ -701,6 +752,7 @@ void hiopVectorPar::axpy_w_pattern(double alpha, const hiopVector& x, const hiop
   const double* xd = xx.local_data_const();
   const double* z = idxs.local_data_const();
 
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(index_type j = 0; j < n_local_; ++j) {
     if(z[j] == 1.0) {
       data_[j] += alpha * xd[j];
@@ -720,14 +772,17 @@ void hiopVectorPar::axzpy(double alpha, const hiopVector& x_, const hiopVector&
   const double *x = vx.local_data_const(), *z = vz.local_data_const();
 
   if(alpha == 1.0) {
+    HIOP_OMP_PARFOR_SIMD(n_local_)
     for(int i = 0; i < n_local_; ++i) {
       data_[i] += x[i] * z[i];
     }
   } else if(alpha == -1.0) {
+    HIOP_OMP_PARFOR_SIMD(n_local_)
     for(int i = 0; i < n_local_; ++i) {
       data_[i] -= x[i] * z[i];
     }
   } else if(alpha != 0.) {  // alpha is not 1.0 nor -1.0 nor 0.0
+    HIOP_OMP_PARFOR_SIMD(n_local_)
     for(int i = 0; i < n_local_; ++i) {
       data_[i] += alpha * x[i] * z[i];
     }
@@ -747,16 +802,19 @@ void hiopVectorPar::axdzpy(double alpha, const hiopVector& x_, const hiopVector&
   const double *x = vx.local_data_const(), *z = vz.local_data_const();
 
   if(alpha == 1.0) {
+    HIOP_OMP_PARFOR_SIMD(n_local_)
     for(int i = 0; i < n_local_; ++i) {
       data_[i] += x[i] / z[i];
     }
 
   } else if(alpha == -1.0) {
+    HIOP_OMP_PARFOR_SIMD(n_local_)
     for(int i = 0; i < n_local_; ++i) {
       data_[i] -= x[i] / z[i];
     }
 
   } else {  // alpha is neither 1.0 nor -1.0
+    HIOP_OMP_PARFOR_SIMD(n_local_)
     for(int i = 0; i < n_local_; ++i) {
       data_[i] += x[i] / z[i] * alpha;
     }
@@ -775,20 +833,24 @@ void hiopVectorPar::axdzpy_w_pattern(double alpha, const hiopVector& x_, const h
   // this += alpha * x / z   (y+=alpha*x/z)
   double* y = data_;
   const double *x = vx.local_data_const(), *z = vz.local_data_const(), *s = sel.local_data_const();
-  int it;
   if(alpha == 1.0) {
-    for(it = 0; it < n_local_; it++)
+    HIOP_OMP_PARFOR_SIMD(n_local_)
+    for(int it = 0; it < n_local_; it++)
       if(s[it] == 1.0) y[it] += x[it] / z[it];
   } else if(alpha == -1.0) {
-    for(it = 0; it < n_local_; it++)
+    HIOP_OMP_PARFOR_SIMD(n_local_)
+    for(int it = 0; it < n_local_; it++)
       if(s[it] == 1.0) y[it] -= x[it] / z[it];
-  } else
-    for(it = 0; it < n_local_; it++)
+  } else {
+    HIOP_OMP_PARFOR_SIMD(n_local_)
+    for(int it = 0; it < n_local_; it++)
       if(s[it] == 1.0) y[it] += alpha * x[it] / z[it];
+  }
 }
 
 void hiopVectorPar::addConstant(double c)
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(size_type i = 0; i < n_local_; i++) data_[i] += c;
 }
 
@@ -797,16 +859,36 @@ void hiopVectorPar::addConstant_w_patternSelect(double c, const hiopVector& ix_)
   const hiopVectorPar& ix = dynamic_cast<const hiopVectorPar&>(ix_);
   assert(this->n_local_ == ix.n_local_);
   const double* ix_vec = ix.data_;
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++)
     if(ix_vec[i] == 1.) data_[i] += c;
 }
 
 double hiopVectorPar::min() const
+{
+  double ret_val = min_local();
+#ifdef HIOP_USE_MPI
+  double ret_val_g;
+  int ierr = MPI_Allreduce(&ret_val, &ret_val_g, 1, MPI_DOUBLE, MPI_MIN, comm_);
+  assert(MPI_SUCCESS == ierr);
+  ret_val = ret_val_g;
+#endif
+  return ret_val;
+}
+
+double hiopVectorPar::min_local() const
 {
   double ret_val = std::numeric_limits<double>::max();
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, min, ret_val)
   for(int i = 0; i < n_local_; i++) {
     ret_val = (ret_val < data_[i]) ? ret_val : data_[i];
   }
+  return ret_val;
+}
+
+double hiopVectorPar::min_w_pattern(const hiopVector& select) const
+{
+  double ret_val = min_w_pattern_local(select);
 #ifdef HIOP_USE_MPI
   double ret_val_g;
   int ierr = MPI_Allreduce(&ret_val, &ret_val_g, 1, MPI_DOUBLE, MPI_MIN, comm_);
@@ -816,24 +898,19 @@ double hiopVectorPar::min() const
   return ret_val;
 }
 
-double hiopVectorPar::min_w_pattern(const hiopVector& select) const
+double hiopVectorPar::min_w_pattern_local(const hiopVector& select) const
 {
   const hiopVectorPar& ix = dynamic_cast<const hiopVectorPar&>(select);
   assert(this->n_local_ == ix.n_local_);
 
   double ret_val = std::numeric_limits<double>::max();
   const double* ix_vec = ix.data_;
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, min, ret_val)
   for(int i = 0; i < n_local_; i++) {
     if(ix_vec[i] == 1.) {
       ret_val = (ret_val < data_[i]) ? ret_val : data_[i];
     }
   }
-#ifdef HIOP_USE_MPI
-  double ret_val_g;
-  int ierr = MPI_Allreduce(&ret_val, &ret_val_g, 1, MPI_DOUBLE, MPI_MIN, comm_);
-  assert(MPI_SUCCESS == ierr);
-  ret_val = ret_val_g;
-#endif
   return ret_val;
 }
 
@@ -848,6 +925,7 @@ void hiopVectorPar::negate()
 
 void hiopVectorPar::invert()
 {
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++) {
 #ifdef HIOP_DEEPCHECKS
     if(fabs(data_[i]) < 1e-35) assert(false);
@@ -856,32 +934,37 @@ void hiopVectorPar::invert()
   }
 }
 
-// uses Kahan's summation algorithm to reduce numerical error
+// uses Kahan's summation algorithm (within each reduction block) to reduce numerical error
 double hiopVectorPar::logBarrier_local(const hiopVector& select) const
 {
-  double sum = 0.0;
-  double comp = 0.0;
   const hiopVectorPar& ix = dynamic_cast<const hiopVectorPar&>(select);
   assert(this->n_local_ == ix.n_local_);
   const double* ix_vec = ix.data_;
-  for(int i = 0; i < n_local_; i++) {
-    if(ix_vec[i] == 1.) {
-      double y = log(data_[i]) - comp;
-      double t = sum + y;
-      comp = (t - sum) - y;
-      sum = t;
+  return omp::reduce_sum(n_local_, [&](size_type begin, size_type end) {
+    double sum = 0.0;
+    double comp = 0.0;
+    for(int i = begin; i < end; i++) {
+      if(ix_vec[i] == 1.) {
+        double y = log(data_[i]) - comp;
+        double t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
+      }
     }
-  }
-  return sum;
+    return sum;
+  });
 }
 
 double hiopVectorPar::sum_local() const
 {
-  double sum = 0.0;
-  for(int i = 0; i < n_local_; i++) {
-    sum += data_[i];
-  }
-  return sum;
+  return omp::reduce_sum(n_local_, [&](size_type begin, size_type end) {
+    double sum = 0.0;
+    HIOP_OMP_SIMD_REDUCE(+, sum)
+    for(int i = begin; i < end; i++) {
+      sum += data_[i];
+    }
+    return sum;
+  });
 }
 
 /* adds the gradient of the log barrier, namely this=this+alpha*1/select(x) */
@@ -894,6 +977,7 @@ void hiopVectorPar::addLogBarrierGrad(double alpha, const hiopVector& x, const h
   const double* ix_vec = dynamic_cast<const hiopVectorPar&>(ix).data_;
   const double* x_vec = dynamic_cast<const hiopVectorPar&>(x).data_;
 
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++)
     if(ix_vec[i] == 1.) data_[i] += alpha / x_vec[i];
 }
@@ -909,10 +993,14 @@ double hiopVectorPar::linearDampingTerm_local(const hiopVector& ixleft,
   assert(n_local_ == (dynamic_cast<const hiopVectorPar&>(ixleft)).n_local_);
   assert(n_local_ == (dynamic_cast<const hiopVectorPar&>(ixright)).n_local_);
 #endif
-  double term = 0.0;
-  for(size_type i = 0; i < n_local_; i++) {
-    if(ixl[i] == 1. && ixr[i] == 0.) term += data_[i];
-  }
+  double term = omp::reduce_sum(n_local_, [&](size_type begin, size_type end) {
+    double term_blk = 0.0;
+    HIOP_OMP_SIMD_REDUCE(+, term_blk)
+    for(size_type i = begin; i < end; i++) {
+      if(ixl[i] == 1. && ixr[i] == 0.) term_blk += data_[i];
+    }
+    return term_blk;
+  });
   term *= mu;
   term *= kappa_d;
   return term;
@@ -932,27 +1020,42 @@ void hiopVectorPar::addLinearDampingTerm(const hiopVector& ixleft,
   assert(n_local_ == (dynamic_cast<const hiopVectorPar&>(ixright)).n_local_);
 #endif
 
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(index_type i = 0; i < n_local_; i++) {
     v[i] = alpha * v[i] + (ixl[i] - ixr[i]) * ct;
   }
 }
 
 int hiopVectorPar::allPositive()
+{
+  int allPos = allPositive_local();
+#ifdef HIOP_USE_MPI
+  int allPosG;
+  int ierr = MPI_Allreduce(&allPos, &allPosG, 1, MPI_INT, MPI_MIN, comm_);
+  assert(MPI_SUCCESS == ierr);
+  return allPosG;
+#endif
+  return allPos;
+}
+
+int hiopVectorPar::allPositive_local() const
 {
   int allPos = true;
+#ifdef HIOP_USE_OPENMP
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, &&, allPos)
+  for(int i = 0; i < n_local_; i++) {
+    allPos = allPos && (data_[i] > 0);
+  }
+#else
+  // same predicate as above, so that NaN entries are not positive
   int i = 0;
   while(i < n_local_ && allPos) {
-    if(data_[i++] <= 0) {
+    if(!(data_[i++] > 0)) {
       allPos = false;
     }
   }
-
-#ifdef HIOP_USE_MPI
-  int allPosG;
-  int ierr = MPI_Allreduce(&allPos, &allPosG, 1, MPI_INT, MPI_MIN, comm_);
-  assert(MPI_SUCCESS == ierr);
-  return allPosG;
 #endif
+
   return allPos;
 }
 
@@ -1019,15 +1122,16 @@ double hiopVectorPar::fractionToTheBdry_local(const hiopVector& dx, const double
   assert(tau > 0);
   assert(tau < 1);
 #endif
-  double alpha = 1.0, aux;
+  double alpha = 1.0;
   const double* d = (dynamic_cast<const hiopVectorPar&>(dx)).local_data_const();
   const double* x = data_;
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, min, alpha)
   for(int i = 0; i < n_local_; i++) {
 #ifdef HIOP_DEEPCHECKS
     assert(x[i] > 0);
 #endif
     if(d[i] >= 0) continue;
-    aux = -tau * x[i] / d[i];
+    const double aux = -tau * x[i] / d[i];
     if(aux < alpha) alpha = aux;
   }
   return alpha;
@@ -1041,17 +1145,18 @@ double hiopVectorPar::fractionToTheBdry_w_pattern_local(const hiopVector& dx, co
   assert(tau > 0);
   assert(tau < 1);
 #endif
-  double alpha = 1.0, aux;
+  double alpha = 1.0;
   const double* d = (dynamic_cast<const hiopVectorPar&>(dx)).local_data_const();
   const double* x = data_;
   const double* pat = (dynamic_cast<const hiopVectorPar&>(ix)).local_data_const();
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, min, alpha)
   for(int i = 0; i < n_local_; i++) {
     if(d[i] >= 0) continue;
     if(pat[i] == 0) continue;
 #ifdef HIOP_DEEPCHECKS
     assert(x[i] > 0);
 #endif
-    aux = -tau * x[i] / d[i];
+    const double aux = -tau * x[i] / d[i];
     if(aux < alpha) alpha = aux;
   }
   return alpha;
@@ -1064,6 +1169,7 @@ void hiopVectorPar::selectPattern(const hiopVector& ix_)
 #endif
   const double* ix = (dynamic_cast<const hiopVectorPar&>(ix_)).local_data_const();
   double* x = data_;
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(int i = 0; i < n_local_; i++)
     if(ix[i] == 0.0) x[i] = 0.0;
 }
@@ -1098,11 +1204,18 @@ int hiopVectorPar::allPositive_w_patternSelect(const hiopVector& w_)
   const double* w = (dynamic_cast<const hiopVectorPar&>(w_)).local_data_const();
   const double* x = data_;
   int allPos = 1;
+#ifdef HIOP_USE_OPENMP
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, &&, allPos)
+  for(int i = 0; i < n_local_; i++) {
+    allPos = allPos && (w[i] == 0.0 || x[i] > 0.);
+  }
+#else
   for(int i = 0; i < n_local_ && allPos; i++) {
-    if(w[i] != 0.0 && x[i] <= 0.) {
+    if(w[i] != 0.0 && !(x[i] > 0.)) {
       allPos = 0;
     }
   }
+#endif
 #ifdef HIOP_USE_MPI
   int allPosG = allPos;
   int ierr = MPI_Allreduce(&allPos, &allPosG, 1, MPI_INT, MPI_MIN, comm_);
@@ -1121,29 +1234,140 @@ void hiopVectorPar::adjustDuals_plh(const hiopVector& x_, const hiopVector& ix_,
   const double* x = (dynamic_cast<const hiopVectorPar&>(x_)).local_data_const();
   const double* ix = (dynamic_cast<const hiopVectorPar&>(ix_)).local_data_const();
   double* z = data_;  // the dual
-  double a, b;
+  HIOP_OMP_PARFOR_SIMD(n_local_)
   for(size_type i = 0; i < n_local_; i++) {
     if(ix[i] == 1.) {
-      a = mu / x[i];
-      b = a / kappa;
+      double a = mu / x[i];
+      const double b = a / kappa;
       a = a * kappa;
-      if(*z < b) {
-        *z = b;
+      if(z[i] < b) {
+        z[i] = b;
       } else {  // z[i]>=b
         if(a <= b) {
-          *z = b;
+          z[i] = b;
         } else {  // a>b
-          if(a < *z) {
-            *z = a;
+          if(a < z[i]) {
+            z[i] = a;
           }
-          // else a>=z[i] then *z=*z (z[i] does not need adjustment)
+          // else a>=z[i] then z[i]=z[i] (z[i] does not need adjustment)
         }
       }
     }
-    z++;
   }
 }
 
+void hiopVectorPar::copy_from_axpy(const hiopVector& base_, const double& alpha, const hiopVector& dir_)
+{
+  const hiopVectorPar& base = dynamic_cast<const hiopVectorPar&>(base_);
+  const hiopVectorPar& dir = dynamic_cast<const hiopVectorPar&>(dir_);
+  assert(n_local_ == base.n_local_);
+  assert(n_local_ == dir.n_local_);
+  const double* b = base.data_;
+  const double* d = dir.data_;
+  double* y = data_;
+  HIOP_OMP_PARFOR_SIMD(n_local_)
+  for(int i = 0; i < n_local_; i++) {
+    y[i] = b[i] + alpha * d[i];
+  }
+}
+
+double hiopVectorPar::bound_residual_w_pattern_local(const hiopVector& a_,
+                                                     const hiopVector& b_,
+                                                     const hiopVector& c_,
+                                                     const hiopVector& select)
+{
+#ifdef HIOP_DEEPCHECKS
+  assert((dynamic_cast<const hiopVectorPar&>(a_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(b_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(c_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(select)).n_local_ == n_local_);
+#endif
+  const double* a = (dynamic_cast<const hiopVectorPar&>(a_)).local_data_const();
+  const double* b = (dynamic_cast<const hiopVectorPar&>(b_)).local_data_const();
+  const double* c = (dynamic_cast<const hiopVectorPar&>(c_)).local_data_const();
+  const double* ix = (dynamic_cast<const hiopVectorPar&>(select)).local_data_const();
+  double* r = data_;
+  double nrm = 0.;
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, max, nrm)
+  for(int i = 0; i < n_local_; i++) {
+    r[i] = (ix[i] == 0.0) ? 0.0 : a[i] - b[i] - c[i];
+    const double aux = fabs(r[i]);
+    nrm = aux > nrm ? aux : nrm;
+  }
+  return nrm;
+}
+
+double hiopVectorPar::complementarity_residual_local(const double& mu,
+                                                     const hiopVector& s_,
+                                                     const hiopVector& z_,
+                                                     const hiopVector& select,
+                                                     double& nrm_inf_nlp)
+{
+#ifdef HIOP_DEEPCHECKS
+  assert((dynamic_cast<const hiopVectorPar&>(s_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(z_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(select)).n_local_ == n_local_);
+#endif
+  const double* s = (dynamic_cast<const hiopVectorPar&>(s_)).local_data_const();
+  const double* z = (dynamic_cast<const hiopVectorPar&>(z_)).local_data_const();
+  const double* ix = (dynamic_cast<const hiopVectorPar&>(select)).local_data_const();
+  double* r = data_;
+  double nrm_nlp = 0.;
+  double nrm_bar = 0.;
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, max, nrm_nlp, nrm_bar)
+  for(int i = 0; i < n_local_; i++) {
+    if(ix[i] == 1.) {
+      const double sz = s[i] * z[i];
+      r[i] = mu - sz;
+      nrm_nlp = fabs(sz) > nrm_nlp ? fabs(sz) : nrm_nlp;
+      nrm_bar = fabs(r[i]) > nrm_bar ? fabs(r[i]) : nrm_bar;
+    } else {
+      r[i] = 0.0;
+    }
+  }
+  nrm_inf_nlp = nrm_nlp;
+  return nrm_bar;
+}
+
+void hiopVectorPar::fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& ds_,
+                                                              const hiopVector& z_,
+                                                              const hiopVector& dz_,
+                                                              const double& tau,
+                                                              const hiopVector& select,
+                                                              double& alpha_primal,
+                                                              double& alpha_dual) const
+{
+#ifdef HIOP_DEEPCHECKS
+  assert((dynamic_cast<const hiopVectorPar&>(ds_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(z_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(dz_)).n_local_ == n_local_);
+  assert((dynamic_cast<const hiopVectorPar&>(select)).n_local_ == n_local_);
+  assert(tau > 0);
+  assert(tau < 1);
+#endif
+  const double* s = data_;
+  const double* ds = (dynamic_cast<const hiopVectorPar&>(ds_)).local_data_const();
+  const double* z = (dynamic_cast<const hiopVectorPar&>(z_)).local_data_const();
+  const double* dz = (dynamic_cast<const hiopVectorPar&>(dz_)).local_data_const();
+  const double* pat = (dynamic_cast<const hiopVectorPar&>(select)).local_data_const();
+  double alpha_s = 1.0;
+  double alpha_z = 1.0;
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, min, alpha_s, alpha_z)
+  for(int i = 0; i < n_local_; i++) {
+    if(pat[i] == 0) continue;
+    if(ds[i] < 0) {
+      const double aux = -tau * s[i] / ds[i];
+      alpha_s = aux < alpha_s ? aux : alpha_s;
+    }
+    if(dz[i] < 0) {
+      const double aux = -tau * z[i] / dz[i];
+      alpha_z = aux < alpha_z ? aux : alpha_z;
+    }
+  }
+  alpha_primal = alpha_s;
+  alpha_dual = alpha_z;
+}
+
 bool hiopVectorPar::is_zero() const
 {
   int all_zero = true;
@@ -1226,6 +1450,7 @@ void hiopVectorPar::print(FILE* file /*=nullptr*/,
 size_type hiopVectorPar::numOfElemsLessThan(const double& val) const
 {
   size_type ret_num = 0;
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, +, ret_num)
   for(size_type i = 0; i < n_local_; i++) {
     if(data_[i] < val) {
       ret_num++;
@@ -1245,6 +1470,7 @@ size_type hiopVectorPar::numOfElemsLessThan(const double& val) const
 size_type hiopVectorPar::numOfElemsAbsLessThan(const double& val) const
 {
   size_type ret_num = 0;
+  HIOP_OMP_PARFOR_SIMD_REDUCE(n_local_, +, ret_num)
   for(size_type i = 0; i < n_local_; i++) {
     if(fabs(data_[i]) < val) {
       ret_num++;
@@ -179,6 +179,22 @@ public:
 
   virtual double twonorm() const;
   virtual double dotProductWith(const hiopVector& vec) const;
+
+  /**
+   * Local (on this rank) counterparts of the reductions above and below, which do not communicate. They
+   * are used by hiopReductionBatch to complete several reductions with a single MPI_Allreduce.
+   */
+  double twonorm_local() const;
+  double dotProductWith_local(const hiopVector& vec) const;
+  /**
+   * Local dot products of `this` with the hiopVectorPar's `vecs[0]`, ..., `vecs[nvecs-1]`, computed in one pass
+   * over `this`: each block of `this` is reused from the cache for all the dot products.
+   */
+  void dot_products_with_local(int nvecs, const hiopVector* const* vecs, double* dots) const;
+  double min_local() const;
+  double min_w_pattern_local(const hiopVector& select) const;
+  int allPositive_local() const;
+
   virtual double infnorm() const;
   virtual double infnorm_local() const;
   virtual double onenorm() const;
@@ -269,6 +285,24 @@ public:
 
   virtual void adjustDuals_plh(const hiopVector& x, const hiopVector& ix, const double& mu, const double& kappa);
 
+  virtual void copy_from_axpy(const hiopVector& base, const double& alpha, const hiopVector& dir);
+  virtual double bound_residual_w_pattern_local(const hiopVector& a,
+                                                const hiopVector& b,
+                                                const hiopVector& c,
+                                                const hiopVector& select);
+  virtual double complementarity_residual_local(const double& mu,
+                                                const hiopVector& s,
+                                                const hiopVector& z,
+                                                const hiopVector& select,
+                                                double& nrm_inf_nlp);
+  virtual void fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& ds,
+                                                         const hiopVector& z,
+                                                         const hiopVector& dz,
+                                                         const double& tau,
+                                                         const hiopVector& select,
+                                                         double& alpha_primal,
+                                                         double& alpha_dual) const;
+
   virtual bool is_zero() const;
   virtual bool isnan_local() const;
   virtual bool isinf_local() const;
@@ -1798,6 +1798,158 @@ void hiopVectorRaja<MEM, POL>::adjustDuals_plh(const hiopVector& xvec,
       });
 }
 
+/**
+ * @brief this = base + alpha * dir, computed in a single pass.
+ *
+ * @pre `this`, `base` and `dir` have same partitioning.
+ */
+template<class MEM, class POL>
+void hiopVectorRaja<MEM, POL>::copy_from_axpy(const hiopVector& base_vec, const double& alpha, const hiopVector& dir_vec)
+{
+  const hiopVectorRaja& base = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(base_vec);
+  const hiopVectorRaja& dir = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(dir_vec);
+  assert(base.n_local_ == n_local_);
+  assert(dir.n_local_ == n_local_);
+
+  const double* bd = base.local_data_const();
+  const double* dd = dir.local_data_const();
+  double* yd = data_dev_;
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, n_local_),
+      RAJA_LAMBDA(RAJA::Index_type i) { yd[i] = bd[i] + alpha * dd[i]; });
+}
+
+/**
+ * @brief this = select ? (a - b - c) : 0; returns the local inf-norm of `this`.
+ *
+ * @pre `this`, `a`, `b`, `c` and `select` have same partitioning.
+ * @pre Elements of `select` are either 0 or 1.
+ */
+template<class MEM, class POL>
+double hiopVectorRaja<MEM, POL>::bound_residual_w_pattern_local(const hiopVector& avec,
+                                                                const hiopVector& bvec,
+                                                                const hiopVector& cvec,
+                                                                const hiopVector& select)
+{
+  const hiopVectorRaja& a = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(avec);
+  const hiopVectorRaja& b = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(bvec);
+  const hiopVectorRaja& c = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(cvec);
+  const hiopVectorRaja& ix = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(select);
+#ifdef HIOP_DEEPCHECKS
+  assert(a.n_local_ == n_local_);
+  assert(b.n_local_ == n_local_);
+  assert(c.n_local_ == n_local_);
+  assert(ix.n_local_ == n_local_);
+#endif
+  const double* ad = a.local_data_const();
+  const double* bd = b.local_data_const();
+  const double* cd = c.local_data_const();
+  const double* id = ix.local_data_const();
+  double* rd = data_dev_;
+
+  RAJA::ReduceMax<hiop_raja_reduce, double> nrm(zero);
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, n_local_),
+      RAJA_LAMBDA(RAJA::Index_type i) {
+        rd[i] = (id[i] == zero) ? zero : ad[i] - bd[i] - cd[i];
+        nrm.max(fabs(rd[i]));
+      });
+  return nrm.get();
+}
+
+/**
+ * @brief this = select ? (mu - s*z) : 0; returns the local inf-norm of `this`
+ * and sets `nrm_inf_nlp` to the local inf-norm of s*z over `select`.
+ *
+ * @pre `this`, `s`, `z` and `select` have same partitioning.
+ * @pre Elements of `select` are either 0 or 1.
+ */
+template<class MEM, class POL>
+double hiopVectorRaja<MEM, POL>::complementarity_residual_local(const double& mu,
+                                                                const hiopVector& svec,
+                                                                const hiopVector& zvec,
+                                                                const hiopVector& select,
+                                                                double& nrm_inf_nlp)
+{
+  const hiopVectorRaja& s = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(svec);
+  const hiopVectorRaja& z = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(zvec);
+  const hiopVectorRaja& ix = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(select);
+#ifdef HIOP_DEEPCHECKS
+  assert(s.n_local_ == n_local_);
+  assert(z.n_local_ == n_local_);
+  assert(ix.n_local_ == n_local_);
+#endif
+  const double* sd = s.local_data_const();
+  const double* zd = z.local_data_const();
+  const double* id = ix.local_data_const();
+  double* rd = data_dev_;
+
+  RAJA::ReduceMax<hiop_raja_reduce, double> nrm_nlp(zero);
+  RAJA::ReduceMax<hiop_raja_reduce, double> nrm_bar(zero);
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, n_local_),
+      RAJA_LAMBDA(RAJA::Index_type i) {
+        if(id[i] == one) {
+          const double sz = sd[i] * zd[i];
+          rd[i] = mu - sz;
+          nrm_nlp.max(fabs(sz));
+          nrm_bar.max(fabs(rd[i]));
+        } else {
+          rd[i] = zero;
+        }
+      });
+  nrm_inf_nlp = nrm_nlp.get();
+  return nrm_bar.get();
+}
+
+/**
+ * @brief Fraction-to-the-boundary step lengths for a slack `this` and its dual `z`
+ * computed in a single pass over `select`.
+ *
+ * @pre `this`, `ds`, `z`, `dz` and `select` have same partitioning.
+ * @pre Elements of `select` are either 0 or 1.
+ */
+template<class MEM, class POL>
+void hiopVectorRaja<MEM, POL>::fraction_to_the_bdry_pair_w_pattern_local(const hiopVector& dsvec,
+                                                                         const hiopVector& zvec,
+                                                                         const hiopVector& dzvec,
+                                                                         const double& tau,
+                                                                         const hiopVector& select,
+                                                                         double& alpha_primal,
+                                                                         double& alpha_dual) const
+{
+  const hiopVectorRaja& ds = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(dsvec);
+  const hiopVectorRaja& z = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(zvec);
+  const hiopVectorRaja& dz = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(dzvec);
+  const hiopVectorRaja& ix = dynamic_cast<const hiopVectorRaja<MEM, POL>&>(select);
+#ifdef HIOP_DEEPCHECKS
+  assert(ds.n_local_ == n_local_);
+  assert(z.n_local_ == n_local_);
+  assert(dz.n_local_ == n_local_);
+  assert(ix.n_local_ == n_local_);
+  assert(tau > 0);
+  assert(tau < 1);
+#endif
+  const double* sd = data_dev_;
+  const double* dsd = ds.local_data_const();
+  const double* zd = z.local_data_const();
+  const double* dzd = dz.local_data_const();
+  const double* id = ix.local_data_const();
+
+  RAJA::ReduceMin<hiop_raja_reduce, double> alpha_s(one);
+  RAJA::ReduceMin<hiop_raja_reduce, double> alpha_z(one);
+  RAJA::forall<hiop_raja_exec>(
+      RAJA::RangeSegment(0, n_local_),
+      RAJA_LAMBDA(RAJA::Index_type i) {
+        if(id[i] == one) {
+          if(dsd[i] < 0) alpha_s.min(-tau * sd[i] / dsd[i]);
+          if(dzd[i] < 0) alpha_z.min(-tau * zd[i] / dzd[i]);
+        }
+      });
+  alpha_primal = alpha_s.get();
+  alpha_dual = alpha_z.get();
+}
+
 /**
  * @brief Check if all elements of the vector are zero
  *
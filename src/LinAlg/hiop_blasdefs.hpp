@@ -18,6 +18,8 @@
 #define DPOTRS FC_GLOBAL(dpotrs, DPOTRS)
 #define DSYTRF FC_GLOBAL(dsytrf, DSYTRF)
 #define DSYTRS FC_GLOBAL(dsytrs, DSYTRS)
+#define DSYTRF_RK FC_GLOBAL_(dsytrf_rk, DSYTRF_RK)
+#define DSYTRS_3 FC_GLOBAL_(dsytrs_3, DSYTRS_3)
 #define DLANGE FC_GLOBAL(dlange, DLANGE)
 #define ZLANGE FC_GLOBAL(zlange, ZLANGE)
 #define DPOSVX FC_GLOBAL(dposvx, DPOSVC)
@@ -137,6 +139,21 @@ extern "C" void DSYTRF(char* UPLO, int* N, double* A, int* LDA, int* IPIV, doubl
  */
 extern "C" void DSYTRS(char* UPLO, int* N, int* NRHS, double* A, int* LDA, int* IPIV, double* B, int* LDB, int* INFO);
 
+/* DSYTRF_RK computes the factorization of a real symmetric matrix A using the bounded
+ *  Bunch-Kaufman (rook) diagonal pivoting method:
+ *     A = P*U*D*(U**T)*(P**T)  or  A = P*L*D*(L**T)*(P**T)
+ *  D is symmetric and block diagonal with 1-by-1 and 2-by-2 diagonal blocks; its diagonal is
+ *  stored on the diagonal of A and its off-diagonal (nonzero only for 2-by-2 blocks) in E.
+ *
+ *  This is the blocked version of the algorithm, calling Level 3 BLAS. Available in LAPACK 3.7+.
+ */
+extern "C" void
+DSYTRF_RK(char* UPLO, int* N, double* A, int* LDA, double* E, int* IPIV, double* WORK, int* LWORK, int* INFO);
+
+/* DSYTRS_3 solves A*X = B using the factorization computed by DSYTRF_RK. Available in LAPACK 3.7+. */
+extern "C" void
+DSYTRS_3(char* UPLO, int* N, int* NRHS, double* A, int* LDA, double* E, int* IPIV, double* B, int* LDB, int* INFO);
+
 /* returns the value of the one norm,  or the Frobenius norm, or
  *  the  infinity norm,  or the  element of  largest absolute value  of a
  *  real matrix A.
@@ -57,6 +57,7 @@
 #include "hiopVectorPar.hpp"
 
 #include "hiop_blasdefs.hpp"
+#include "hiopOMP.hpp"
 
 #ifdef HIOP_USE_MPI
 #include "mpi.h"
@@ -82,6 +83,7 @@ namespace hiop
 HessianDiagPlusRowRank::HessianDiagPlusRowRank(hiopNlpDenseConstraints* nlp_in, int max_mem_len)
     : l_max_(max_mem_len),
       l_curr_(-1),
+      head_(0),
       sigma_(1.),
       sigma0_(1.),
       nlp_(nlp_in),
@@ -219,7 +221,8 @@ HessianDiagPlusRowRank::~HessianDiagPlusRowRank()
 
 void HessianDiagPlusRowRank::alloc_for_limited_mem(const size_type& mem_length)
 {
-  // note: St_ and Yt_ always have l_curr_ rows
+  // note: St_ and Yt_ always have l_curr_ rows, which are (re)filled from the oldest to the newest pair
+  head_ = 0;
   if(l_curr_ == mem_length) {
     assert(D_->get_size() == l_curr_);
     return;
@@ -332,7 +335,7 @@ bool HessianDiagPlusRowRank::update(const hiopIterate& it_curr,
       if(sTy > s_nrm2 * y_nrm2 * sqrt(std::numeric_limits<double>::epsilon())) {  // sTy far away from zero
 
         if(l_max_ > 0) {
-          // compute the new row in L, update S and Y (either augment them or shift cols and add s_new and y_new)
+          // compute the new row in L, update S and Y (either augment them or overwrite the oldest pair)
           hiopVector& YTs = new_l_vec1(l_curr_);
           Yt_->timesVec(0.0, YTs, 1.0, s_new);
           // update representation
@@ -344,13 +347,13 @@ bool HessianDiagPlusRowRank::update(const hiopIterate& it_curr,
             growD(l_curr_, l_max_, sTy);
             l_curr_++;
           } else {
-            // shift
-            St_->shiftRows(-1);
-            Yt_->shiftRows(-1);
-            St_->replaceRow(l_max_ - 1, s_new);
-            Yt_->replaceRow(l_max_ - 1, y_new);
-            updateL(YTs, sTy);
-            updateD(sTy);
+            // the new pair takes the row of the oldest one, which becomes the newest
+            const int slot = head_;
+            St_->replaceRow(slot, s_new);
+            Yt_->replaceRow(slot, y_new);
+            updateL(YTs, slot);
+            updateD(sTy, slot);
+            head_ = (head_ + 1) % l_max_;
             l_curr_ = l_max_;
           }
         }  // end of l_max_>0
@@ -883,10 +886,11 @@ void HessianDiagPlusRowRank::growD(const int& lmem_curr, const int& lmem_max, co
   D_ = Dnew;
 }
 
-/* L_{ij} = s_{i-1}^T y_{j-1}, if i>j, otherwise zero. Here i,j = 0,1,...,l_curr-1
- * L_new = lift and shift L to the left; replace last row with [Yts;0]
+/* L_{ij} = s_i^T y_j if the pair i is newer than the pair j, otherwise zero, where i,j = 0,1,...,l_curr-1 are
+ * the rows of St and Yt. The new pair (stored in row 'slot') is the newest, so row 'slot' of L becomes Y^T*s_new
+ * (without the diagonal entry) and column 'slot' becomes zero.
  */
-void HessianDiagPlusRowRank::updateL(const hiopVector& YTs, const double& sTy)
+void HessianDiagPlusRowRank::updateL(const hiopVector& YTs, int slot)
 {
   int l = YTs.get_size();
   assert(l == L_->m());
@@ -895,37 +899,52 @@ void HessianDiagPlusRowRank::updateL(const hiopVector& YTs, const double& sTy)
   assert(l_curr_ == l);
   assert(l_curr_ == l_max_);
 #endif
-  const int lm1 = l - 1;
   double* L_mat = L_->local_data();
   const double* yts_vec = YTs.local_data_const();
-  for(int i = 1; i < lm1; i++) {
-    for(int j = 0; j < i; j++) {
-      // L_mat[i][j] = L_mat[i+1][j+1];
-      L_mat[i * l + j] = L_mat[(i + 1) * l + j + 1];
-    }
+  for(int i = 0; i < l; i++) {
+    // L_mat[i][slot]=0.0;
+    L_mat[i * l + slot] = 0.0;
   }
-
-  // is this really needed?
-  // for(int i=0; i<lm1; i++)
-  //   L_mat[i][lm1]=0.0;
-
-  // first entry in YTs corresponds to y_to_be_discarded_since_it_is_the_oldest'* s_new and is discarded
-  for(int j = 0; j < lm1; j++) {
-    // L_mat[lm1][j]=yts_vec[j+1];
-    L_mat[lm1 * l + j] = yts_vec[j + 1];
+  // the entry 'slot' of YTs is y_discarded^T*s_new and is not used
+  for(int j = 0; j < l; j++) {
+    // L_mat[slot][j]=yts_vec[j];
+    L_mat[slot * l + j] = j == slot ? 0.0 : yts_vec[j];
   }
+}
 
-  // L_mat[lm1][lm1]=0.0;
-  L_mat[lm1 * l + lm1] = 0.0;
+void HessianDiagPlusRowRank::updateD(const double& sTy, int slot)
+{
+  D_->local_data()[slot] = sTy;
 }
-void HessianDiagPlusRowRank::updateD(const double& sTy)
+
+void HessianDiagPlusRowRank::make_memory_chronological()
 {
-  int l = D_->get_size();
+  if(0 == head_ || l_curr_ <= 0) {
+    head_ = 0;
+    return;
+  }
+  const int l = l_curr_;
+  std::vector<index_type> rows(l);
+  for(int k = 0; k < l; k++) {
+    rows[k] = slot_of_pair(k);
+  }
+  hiopMatrixDense* tmp = St_->new_copy();
+  St_->copyRowsFrom(*tmp, rows.data(), l);
+  tmp->copyFrom(*Yt_);
+  Yt_->copyRowsFrom(*tmp, rows.data(), l);
+  delete tmp;
+
+  std::vector<double> L_old(L_->local_data_const(), L_->local_data_const() + l * l);
+  std::vector<double> D_old(D_->local_data_const(), D_->local_data_const() + l);
+  double* L_mat = L_->local_data();
   double* D_vec = D_->local_data();
-  for(int i = 0; i < l - 1; i++) {
-    D_vec[i] = D_vec[i + 1];
+  for(int i = 0; i < l; i++) {
+    D_vec[i] = D_old[rows[i]];
+    for(int j = 0; j < l; j++) {
+      L_mat[i * l + j] = L_old[rows[i] * l + rows[j]];
+    }
   }
-  D_vec[l - 1] = sTy;
+  head_ = 0;
 }
 
 hiopVector& HessianDiagPlusRowRank::new_l_vec1(int l)
@@ -1081,10 +1100,12 @@ void HessianDiagPlusRowRank::times_vec_common(double beta,
   a.resize(l_curr_, nullptr);
   b.resize(l_curr_, nullptr);
   int n_local = Yt_->get_local_size_n();
+  // the pairs are taken from the oldest to the newest
   for(int k = 0; k < l_curr_; k++) {
     // bk=yk/sqrt(yk'*sk)
-    yk->copyFrom(Yt_->local_data() + k * n_local);
-    sk->copyFrom(St_->local_data() + k * n_local);
+    const int slot = slot_of_pair(k);
+    yk->copyFrom(Yt_->local_data() + slot * n_local);
+    sk->copyFrom(St_->local_data() + slot * n_local);
     double skTyk = yk->dotProductWith(*sk);
 
     if(skTyk < std::numeric_limits<double>::epsilon()) {
@@ -1154,6 +1175,93 @@ void HessianDiagPlusRowRank::timesVec(double beta, hiopVector& y, double alpha,
  * Internal helpers
  *************************************************************************/
 
+namespace
+{
+/// Length of the column blocks whose partial products are computed in parallel by `mat_times_diag_times_mattrans_blocked`
+constexpr size_type col_block_len = 8 * omp::reduce_block_len;
+
+/**
+ * R = A*Diag(d)*B^T, where A is lxn and B is kxn, both row-major with row strides `lda` and `ldb`, and R is lxk
+ * row-major with row stride k.
+ *
+ * The columns are processed in chunks small enough for the chunk of A scaled by d and the chunk of B to stay in
+ * cache, with one DGEMM per chunk, so that A and B are read from memory once instead of once per entry of R.
+ * With OpenMP, blocks of `col_block_len` columns are processed in parallel and their partial products are added
+ * in block order, so that the result does not depend on the number of threads.
+ */
+void mat_times_diag_times_mattrans_blocked(int l,
+                                           int k,
+                                           size_type n,
+                                           const double* A,
+                                           size_type lda,
+                                           const double* d,
+                                           const double* B,
+                                           size_type ldb,
+                                           double* R)
+{
+  const size_t lk = static_cast<size_t>(l) * k;
+  std::fill(R, R + lk, 0.);
+  if(0 == l || 0 == k || 0 == n) {
+    return;
+  }
+  // about 128KB for the scaled chunk of A and the chunk of B
+  const size_type chunk = std::max<size_type>(64, (1 << 14) / (l + k));
+
+  auto block_product = [&](size_type begin, size_type end, double* Rb) {
+    std::vector<double> As(static_cast<size_t>(l) * chunk);
+    char transA = 'T';
+    char transB = 'N';
+    double one = 1.;
+    int m_gemm = k;
+    int n_gemm = l;
+    int ldb_gemm = static_cast<int>(ldb);
+    for(size_type p0 = begin; p0 < end; p0 += chunk) {
+      int nb = static_cast<int>(std::min(chunk, end - p0));
+      for(int i = 0; i < l; i++) {
+        const double* ai = A + i * lda + p0;
+        double* asi = As.data() + static_cast<size_t>(i) * nb;
+        for(int p = 0; p < nb; p++) {
+          asi[p] = ai[p] * d[p0 + p];
+        }
+      }
+      // in column-major terms, R^T (kxl) += B(:,chunk) * As^T, with B(:,chunk) seen as nb x k and As as nb x l
+      DGEMM(&transA,
+            &transB,
+            &m_gemm,
+            &n_gemm,
+            &nb,
+            &one,
+            const_cast<double*>(B + p0),
+            &ldb_gemm,
+            As.data(),
+            &nb,
+            &one,
+            Rb,
+            &m_gemm);
+    }
+  };
+
+#ifdef HIOP_USE_OPENMP
+  const size_type nblocks = (n + col_block_len - 1) / col_block_len;
+  if(nblocks > 1) {
+    std::vector<double> partial(nblocks * lk);
+#pragma omp parallel for schedule(static) if(omp::use_threads(n)) num_threads(omp::get_num_threads())
+    for(size_type b = 0; b < nblocks; ++b) {
+      const size_type begin = b * col_block_len;
+      block_product(begin, std::min(n, begin + col_block_len), partial.data() + b * lk);
+    }
+    for(size_type b = 0; b < nblocks; ++b) {
+      for(size_t e = 0; e < lk; ++e) {
+        R[e] += partial[b * lk + e];
+      }
+    }
+    return;
+  }
+#endif
+  block_product(0, n, R);
+}
+}  // namespace
+
 /* symmetric multiplication W = beta*W + alpha*X*Diag*X^T
  * W is kxk local, X is kxn distributed and Diag is n, distributed
  * The ops are perform locally. The reduce is done separately/externally to decrease comm
@@ -1175,26 +1283,16 @@ void HessianDiagPlusRowRank::sym_mat_times_diag_times_mattrans_local(double beta
   assert(d.get_local_size() == n_local);
 #endif
 
-  // #define chunk 512; //!opt
-  const double *xi, *xj;
-  double acc;
-  double* Wdata = W.local_data();
+  std::vector<double> XDXt(k * k);
   const double* Xdata = X.local_data_const();
-  const double* dd = d.local_data_const();
+  mat_times_diag_times_mattrans_blocked(k, k, n_local, Xdata, n_local, d.local_data_const(), Xdata, n_local, XDXt.data());
+
+  // the upper triangle is used for both triangles so that W stays exactly symmetric
+  double* Wdata = W.local_data();
   for(int i = 0; i < k; i++) {
-    // xi=Xdata[i];
-    xi = Xdata + i * n_local;
     for(int j = i; j < k; j++) {
-      // xj=Xdata[j];
-      xj = Xdata + j * n_local;
-      // compute W[i,j] = sum {X[i,p]*d[p]*X[j,p] : p=1,...,n_local}
-      acc = 0.0;
-      for(size_type p = 0; p < n_local; p++) {
-        acc += xi[p] * dd[p] * xj[p];
-      }
-
-      // Wdata[i][j]=Wdata[j][i]=beta*Wdata[i][j]+alpha*acc;
-      Wdata[i * k + j] = Wdata[j * k + i] = beta * Wdata[i * k + j] + alpha * acc;
+      // Wdata[i][j]=Wdata[j][i]=beta*Wdata[i][j]+alpha*XDXt[i][j];
+      Wdata[i * k + j] = Wdata[j * k + i] = beta * Wdata[i * k + j] + alpha * XDXt[i * k + j];
     }
   }
 }
@@ -1212,31 +1310,20 @@ void HessianDiagPlusRowRank::mat_times_diag_times_mattrans_local(hiopMatrixDense
   int l = S.m(), n = d.get_local_size(), k = X.m();
   assert(X.get_local_size_n() == d.get_local_size());
 
-  const double* Sdi;
-  double* Wdi;
-  const double* Xdj;
-  double acc;
+  std::vector<double> SDXt(static_cast<size_t>(l) * k);
+  mat_times_diag_times_mattrans_blocked(l,
+                                        k,
+                                        n,
+                                        S.local_data_const(),
+                                        n,
+                                        d.local_data_const(),
+                                        X.local_data_const(),
+                                        n,
+                                        SDXt.data());
+
   double* Wd = W.local_data();
-  const double* Sd = S.local_data_const();
-  const double* Xd = X.local_data_const();
-  const double* diag = d.local_data_const();
-  //! opt
   for(int i = 0; i < l; i++) {
-    // Sdi=Sd[i]; Wdi=Wd[i];
-    Sdi = Sd + i * n;
-    Wdi = Wd + i * W.get_local_size_n();
-
-    for(int j = 0; j < k; j++) {
-      // Xdj=Xd[j];
-      Xdj = Xd + j * n;
-      acc = 0.;
-      for(int p = 0; p < n; p++) {
-        // acc += Sdi[p]*diag[p]*Xdj[p];
-        acc += Sdi[p] * diag[p] * Xdj[p];
-      }
-
-      Wdi[j] = acc;
-    }
+    std::copy(SDXt.begin() + i * k, SDXt.begin() + (i + 1) * k, Wd + i * W.get_local_size_n());
   }
 }
 };  // namespace hiop
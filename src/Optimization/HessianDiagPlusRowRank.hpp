@@ -141,6 +141,7 @@ protected:
   friend class hiopAlgFilterIPMQuasiNewton;
   int l_max_;      // max memory size
   int l_curr_;     // number of pairs currently stored
+  int head_;       // row of St_ and Yt_ holding the oldest pair (the rows are used as a ring buffer)
   double sigma_;   // initial scaling factor of identity
   double sigma0_;  // default scaling factor of identity
 
@@ -171,6 +172,9 @@ private:
   // More exactly Bk=B0-[B0*St' Yt']*[St*B0*St'  L]*[St*B0]
   //                                 [  L'      -D] [Yt   ]
   // Transpose of S and T are store to easily access columns
+  // Once the memory is full, the rows are used as a ring buffer: the k-th oldest pair is in row slot_of_pair(k)
+  // and a new pair overwrites the oldest one, so L and D are kept in the order of the rows and not in the
+  // chronological order. V and the products with the inverse do not depend on the order of the pairs.
   hiopMatrixDense* St_;
   hiopMatrixDense* Yt_;
 
@@ -186,8 +190,12 @@ private:
 #endif
   void growL(const int& lmem_curr, const int& lmem_max, const hiopVector& YTs);
   void growD(const int& l_curr, const int& l_max, const double& sTy);
-  void updateL(const hiopVector& STy, const double& sTy);
-  void updateD(const double& sTy);
+  void updateL(const hiopVector& YTs, int slot);
+  void updateD(const double& sTy, int slot);
+  /// Row of St_ and Yt_ holding the k-th oldest pair
+  inline int slot_of_pair(int k) const { return (head_ + k) % l_curr_; }
+  /// Reorders the rows of St_ and Yt_, L_, and D_ from the oldest to the newest pair (used for checkpointing)
+  void make_memory_chronological();
   // also stored are the iterate, gradient obj, and Jacobians at the previous optimization iteration
   hiopIterate* it_prev_;
   hiopVector* grad_f_prev_;
@@ -269,23 +277,29 @@ private:
     return *twol_vec1_;
   }
 
-private:
-  // utilities
-
-  /// @brief Ensures the internal containers are ready to work with "limited memory" mem_length
-  void alloc_for_limited_mem(const size_type& mem_length);
-
-  /* symmetric multiplication W = beta*W + alpha*X*Diag*X^T */
+public:
+  /**
+   * Symmetric multiplication W = beta*W + alpha*X*Diag*X^T of the local parts (W is kxk, X is kxn, and Diag is n);
+   * the sum over the ranks is done by the caller. The kernel is cache-blocked over the columns of X, uses DGEMM,
+   * and is threaded with OpenMP.
+   */
   static void sym_mat_times_diag_times_mattrans_local(double beta,
                                                       hiopMatrixDense& W_,
                                                       double alpha,
                                                       const hiopMatrixDense& X_,
                                                       const hiopVector& d);
-  /* W=S*Diag*X^T */
+  /// W=S*Diag*X^T of the local parts (S is lxn and X is kxn); blocked and threaded as the above
   static void mat_times_diag_times_mattrans_local(hiopMatrixDense& W,
                                                   const hiopMatrixDense& S,
                                                   const hiopVector& d,
                                                   const hiopMatrixDense& X);
+
+private:
+  // utilities
+
+  /// @brief Ensures the internal containers are ready to work with "limited memory" mem_length
+  void alloc_for_limited_mem(const size_type& mem_length);
+
   /* members and utilities related to V matrix: factorization and solve */
   hiopVector* V_work_vec_;
   int V_ipiv_size_;
@@ -74,6 +74,7 @@ using namespace axom;
 
 #include <cmath>
 #include <cstring>
+#include <sstream>
 #include <cassert>
 #include <stdio.h>
 #include <ctype.h>
@@ -96,6 +97,9 @@ hiopAlgFilterIPMBase::hiopAlgFilterIPMBase(hiopNlpFormulation* nlp_in, const boo
       c_soc(nullptr),
       d_soc(nullptr),
       within_FR_(within_FR),
+      fr_prob_(nullptr),
+      nlp_fr_(nullptr),
+      solver_fr_(nullptr),
       pd_perturb_(nullptr),
       fact_acceptor_(nullptr)
 {
@@ -135,8 +139,36 @@ void hiopAlgFilterIPMBase::dealloc_alg_objects()
   delete d_soc;
   delete soc_dir;
 }
+
+void hiopAlgFilterIPMBase::start_trace()
+{
+  if(!within_FR_ && nlp->options->GetString("profile_trace") == "yes") {
+    nlp->runStats.trace.start(nlp->get_comm());
+  }
+}
+
+void hiopAlgFilterIPMBase::write_trace()
+{
+  hiopTrace& trace = nlp->runStats.trace;
+  if(!trace.is_enabled()) {
+    return;
+  }
+  trace.stop();
+  std::string errors;
+  if(trace.write(nlp->options->GetString("profile_trace_file"), errors)) {
+    nlp->log->printf(hovSummary,
+                     "Trace of %lu solver phases written to '%s.json' and '%s.csv'\n",
+                     trace.num_events(),
+                     nlp->options->GetString("profile_trace_file").c_str(),
+                     nlp->options->GetString("profile_trace_file").c_str());
+  } else {
+    nlp->log->printf(hovWarning, "Could not write the trace: %s", errors.c_str());
+  }
+}
+
 hiopAlgFilterIPMBase::~hiopAlgFilterIPMBase()
 {
+  dealloc_fr_objects();
   dealloc_alg_objects();
   delete fact_acceptor_;
   delete pd_perturb_;
@@ -288,6 +320,18 @@ void hiopAlgFilterIPMBase::resetSolverStatus()
   n_accep_iters_ = 0;
   solver_status_ = NlpSolve_IncompleteInit;
   filter.clear();
+  // the FR objects are kept only for the duration of a solve: the NLP may change between solves
+  dealloc_fr_objects();
+}
+
+void hiopAlgFilterIPMBase::dealloc_fr_objects()
+{
+  delete solver_fr_;
+  solver_fr_ = nullptr;
+  delete nlp_fr_;
+  nlp_fr_ = nullptr;
+  delete fr_prob_;
+  fr_prob_ = nullptr;
 }
 
 int hiopAlgFilterIPMBase::startingProcedure(hiopIterate& it_ini,
@@ -955,6 +999,7 @@ hiopSolveStatus hiopAlgFilterIPMQuasiNewton::run()
 
   nlp->runStats.initialize();
   nlp->runStats.kkt.initialize();
+  start_trace();
   ////////////////////////////////////////////////////////////////////////////////////
   // run baby run
   ////////////////////////////////////////////////////////////////////////////////////
@@ -973,6 +1018,14 @@ hiopSolveStatus hiopAlgFilterIPMQuasiNewton::run()
 
   iter_num_ = 0;
 
+#ifndef HIOP_USE_AXOM
+  if(nlp->options->GetString("checkpoint_save") == "yes" ||
+     nlp->options->GetString("checkpoint_load_on_start") == "yes") {
+    nlp->log->printf(hovWarning,
+                     "Checkpointing of the quasi-Newton solver is not available since HiOp was not built with "
+                     "AXOM. All checkpointing options are ignored.\n");
+  }
+#endif
   //
   // starting point:
   // - user provided (with slack adjustments and lsq eq. duals initialization)
@@ -1032,6 +1085,7 @@ hiopSolveStatus hiopAlgFilterIPMQuasiNewton::run()
   assert(kkt != nullptr);
 
   // assign an Null pd_perturb, i.e., all the deltas = 0.0
+  delete pd_perturb_;
   pd_perturb_ = new hiopPDPerturbationNull();
   if(!pd_perturb_->initialize(nlp)) {
     delete kkt;
@@ -1068,9 +1122,13 @@ hiopSolveStatus hiopAlgFilterIPMQuasiNewton::run()
   bool linsol_safe_mode_on = true;  // always use safe mode in the quasi-newton solver
   bool linsol_forcequick = false;   // always use safe mode in the quasi-newton solver
   bool elastic_mode_on = nlp->options->GetString("elastic_mode") != "none";
+  const bool full_iterate_callback_on = nlp->options->GetString("iterate_full_callback") == "yes";
   solver_status_ = NlpSolve_Pending;
 
   while(true) {
+    nlp->runStats.trace.set_iteration(iter_num_);
+    hiopTraceSpan trace_iter(nlp->runStats.trace, "iteration");
+
     bret = evalNlpAndLogErrors(*it_curr,
                                *resid,
                                _mu,
@@ -1134,6 +1192,17 @@ hiopSolveStatus hiopAlgFilterIPMQuasiNewton::run()
       solver_status_ = User_Stopped;
       break;
     }
+    if(full_iterate_callback_on && !nlp->user_callback_full_iterate(*it_curr->get_x(),
+                                                                    *it_curr->get_zl(),
+                                                                    *it_curr->get_zu(),
+                                                                    *it_curr->get_yc(),
+                                                                    *it_curr->get_yd(),
+                                                                    *it_curr->get_d(),
+                                                                    *it_curr->get_vl(),
+                                                                    *it_curr->get_vu())) {
+      solver_status_ = User_Stopped;
+      break;
+    }
 
 #ifdef HIOP_USE_AXOM
     // checkpointing - based on options provided by the user
@@ -1284,6 +1353,7 @@ hiopSolveStatus hiopAlgFilterIPMQuasiNewton::run()
     //
     double min_ls_step_size = nlp->options->GetNumeric("min_step_size");
     while(true) {
+      hiopTraceSpan trace_trial(nlp->runStats.trace, "line search trial");
       nlp->runStats.tmSolverInternal.start();  //---
 
       // check the step against the minimum step size, but accept small
@@ -1521,6 +1591,7 @@ hiopSolveStatus hiopAlgFilterIPMQuasiNewton::run()
   }
 
   nlp->runStats.tmOptimizTotal.stop();
+  write_trace();
 
   // solver_status_ contains the termination information
   displayTerminationMsg();
@@ -1664,7 +1735,8 @@ void hiopAlgFilterIPMQuasiNewton::save_state_to_sidre_group(::axom::sidre::Group
                                   Jac_d->get_local_size_n() * Jac_d->get_local_size_m());
 
   // quasi-Newton Hessian internal states
-  // memory matrices and internal representation
+  // memory matrices and internal representation, saved from the oldest to the newest pair
+  hqn.make_memory_chronological();
   SidreHelper::copy_array_to_view(group,
                                   "Hess_quasiNewton_St",
                                   hqn.St_->local_data_const(),
@@ -1826,7 +1898,11 @@ void hiopAlgFilterIPMQuasiNewton::checkpointing_stuff()
  * FULL NEWTON IPM
  *****************************************************************************************************/
 hiopAlgFilterIPMNewton::hiopAlgFilterIPMNewton(hiopNlpFormulation* nlp_in, const bool within_FR)
-    : hiopAlgFilterIPMBase(nlp_in, within_FR)
+    : hiopAlgFilterIPMBase(nlp_in, within_FR),
+      kkt_kept_(nullptr),
+      resolving_(false),
+      chk_writer_(nullptr),
+      chk_loaded_(nullptr)
 {
   reload_options();
 
@@ -1844,7 +1920,59 @@ hiopAlgFilterIPMNewton::hiopAlgFilterIPMNewton(hiopNlpFormulation* nlp_in, const
   resetSolverStatus();
 }
 
-hiopAlgFilterIPMNewton::~hiopAlgFilterIPMNewton() {}
+hiopAlgFilterIPMNewton::~hiopAlgFilterIPMNewton()
+{
+  delete kkt_kept_;
+  // waits for the checkpoint being written, if any
+  delete chk_writer_;
+  delete chk_loaded_;
+}
+
+void hiopAlgFilterIPMNewton::release_kkt(hiopKKTLinSys* kkt)
+{
+  assert(nullptr == kkt_kept_);
+  // the KKT linear system holds the factorization and the workspace of the linear solver, hence it is kept only
+  // when it is going to be reused
+  if(within_FR_ || nlp->options->GetString("keep_kkt") == "yes") {
+    kkt_kept_ = kkt;
+  } else {
+    delete kkt;
+  }
+}
+
+std::string hiopAlgFilterIPMNewton::kkt_options_signature() const
+{
+  std::string sig;
+  for(const char* name: {"KKTLinsys",
+                         "linear_solver_sparse",
+                         "linear_solver_dense",
+                         "compute_mode",
+                         "mem_space",
+                         "fact_acceptor",
+                         "regularization_method",
+                         "normaleqn_regularization_priority"}) {
+    sig += nlp->options->GetString(name) + "|";
+  }
+  return sig;
+}
+
+hiopKKTLinSys* hiopAlgFilterIPMNewton::acquire_kkt()
+{
+  const std::string kkt_options = kkt_options_signature();
+  if(kkt_kept_) {
+    // the restoration problem does not change between the restoration phases; the user guarantees
+    // that the structure did not change when calling `resolve`
+    if((within_FR_ || resolving_) && kkt_options == kkt_kept_options_) {
+      hiopKKTLinSys* kkt = kkt_kept_;
+      kkt_kept_ = nullptr;
+      return kkt;
+    }
+    delete kkt_kept_;
+    kkt_kept_ = nullptr;
+  }
+  kkt_kept_options_ = kkt_options;
+  return decideAndCreateLinearSystem(nlp);
+}
 
 void hiopAlgFilterIPMNewton::reload_options()
 {
@@ -2120,8 +2248,37 @@ hiopFactAcceptor* hiopAlgFilterIPMBase::decideAndCreateFactAcceptor(hiopPDPertur
   }
 }
 
+hiopSolveStatus hiopAlgFilterIPMNewton::resolve()
+{
+  // the bounds and constraints info are re-queried by `finalizeInitialization` at the beginning of `run`
+  nlp->set_problem_data_changed();
+  resolving_ = true;
+  hiopSolveStatus status;
+  try {
+    status = run();
+  } catch(...) {
+    resolving_ = false;
+    throw;
+  }
+  resolving_ = false;
+  return status;
+}
+
 hiopSolveStatus hiopAlgFilterIPMNewton::run()
 {
+  // the checkpoints submitted during this run are written when it returns, whatever the exit
+  struct CheckpointsWaitGuard
+  {
+    hiopAlgFilterIPMNewton& alg;
+    ~CheckpointsWaitGuard()
+    {
+      std::string chk_errors;
+      if(alg.chk_writer_ && !alg.chk_writer_->wait(chk_errors)) {
+        alg.nlp->log->printf(hovError, "Error when saving checkpoint: %s", chk_errors.c_str());
+      }
+    }
+  } chk_wait_guard{*this};
+
   // hiopNlpFormulation nlp may need an update since user may have changed options and
   // reruning with the same hiopAlgFilterIPMNewton instance
   nlp->finalizeInitialization();
@@ -2132,14 +2289,17 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
   // if nlp changed internally, we need to reinitialize `this`
   if(it_curr->get_x()->get_size() != nlp->n() ||
      // Jac_c->get_local_size_n()!=nlpdc->n_local()) { <- this is prone to racing conditions
-     _Jac_c->n() != nlp->n()) {
+     _Jac_c->n() != nlp->n() || _Jac_c->m() != nlp->m_eq() || _Jac_d->m() != nlp->m_ineq()) {
     // size of the nlp changed internally ->  reInitializeNlpObjects();
     reInitializeNlpObjects();
+    delete kkt_kept_;
+    kkt_kept_ = nullptr;
   }
   resetSolverStatus();
 
   nlp->runStats.initialize();
   nlp->runStats.kkt.initialize();
+  start_trace();
 
   // todo: have this as option maybe
   // number of safe mode iteration to run once linsol mode is switched to on
@@ -2161,8 +2321,43 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
 
   nlp->runStats.tmOptimizTotal.start();
 
-  startingProcedure(*it_curr, _f_nlp, *_c, *_d, *_grad_f, *_Jac_c, *_Jac_d);  // this also evaluates the nlp
-  _mu = mu0;
+  //
+  // starting point:
+  // - user provided (with slack adjustments and lsq eq. duals initialization)
+  // - checkpoint loaded by `load_state_from_file` before calling this method
+  // - checkpoint from file (option "checkpoint_load_on_start")
+  //
+  if(!chk_loaded_ && nlp->options->GetString("checkpoint_load_on_start") == "yes" && !within_FR_) {
+    load_state_from_file(nlp->options->GetString("checkpoint_file"));
+  }
+  bool from_checkpoint = false;
+  if(chk_loaded_) {
+    try {
+      load_state_from_snapshot(*chk_loaded_);
+      from_checkpoint = true;
+    } catch(const std::exception& exp) {
+      nlp->log->printf(hovError, "Error in loading checkpoint: %s\n", exp.what());
+      delete chk_loaded_;
+      chk_loaded_ = nullptr;
+    }
+  }
+  if(from_checkpoint) {
+    // need to evaluate the nlp (including the Hessian) at the loaded iterate
+    if(!this->evalNlp_noHess(*it_curr, _f_nlp, *_c, *_d, *_grad_f, *_Jac_c, *_Jac_d) ||
+       !this->evalNlp_HessOnly(*it_curr, *_Hess_Lagr)) {
+      nlp->log->printf(hovError, "Failure in evaluating user NLP functions at loaded checkpoint.");
+      delete chk_loaded_;
+      chk_loaded_ = nullptr;
+      return Error_In_User_Function;
+    }
+  } else {
+    if(nlp->options->GetString("checkpoint_load_on_start") == "yes" && !within_FR_) {
+      nlp->log->printf(hovWarning, "Using default starting procedure (no checkpoint load!).\n");
+    }
+    startingProcedure(*it_curr, _f_nlp, *_c, *_d, *_grad_f, *_Jac_c, *_Jac_d);  // this also evaluates the nlp
+    _mu = mu0;
+    iter_num_total_ = 0;
+  }
 
   // update log bar
   logbar->updateWithNlpInfo(*it_curr, _mu, _f_nlp, *_c, *_d, *_grad_f, *_Jac_c, *_Jac_d);
@@ -2173,16 +2368,19 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
   nlp->log->write("First residual-------------", *resid, hovIteration);
 
   iter_num_ = 0;
-  iter_num_total_ = 0;
   nlp->runStats.nIter = iter_num_;
   bool disableLS = nlp->options->GetString("accept_every_trial_step") == "yes";
 
-  theta_max = theta_max_fact_ * fmax(1.0, resid->get_theta());
-  theta_min = theta_min_fact_ * fmax(1.0, resid->get_theta());
+  if(!from_checkpoint) {
+    theta_max = theta_max_fact_ * fmax(1.0, resid->get_theta());
+    theta_min = theta_min_fact_ * fmax(1.0, resid->get_theta());
+  }
 
-  hiopKKTLinSys* kkt = decideAndCreateLinearSystem(nlp);
+  // a FR solver and `resolve` reuse the KKT linear system of the previous run, if any
+  hiopKKTLinSys* kkt = acquire_kkt();
   assert(kkt != NULL);
 
+  delete pd_perturb_;
   if(nlp->options->GetString("normaleqn_regularization_priority") == "dual_first" &&
      nlp->options->GetString("KKTLinsys") == "normaleqn") {
     if(nlp->options->GetString("regularization_method") == "randomized") {
@@ -2199,9 +2397,18 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
   }
 
   if(!pd_perturb_->initialize(nlp)) {
-    delete kkt;
+    release_kkt(kkt);
     return SolveInitializationError;
   }
+  if(chk_loaded_) {
+    try {
+      pd_perturb_->load_state(*chk_loaded_);
+    } catch(const std::exception& exp) {
+      nlp->log->printf(hovWarning, "Primal-dual perturbation state not loaded from checkpoint: %s\n", exp.what());
+    }
+    delete chk_loaded_;
+    chk_loaded_ = nullptr;
+  }
 
   kkt->set_PD_perturb_calc(pd_perturb_);
   kkt->set_logbar_mu(_mu);
@@ -2215,9 +2422,11 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
 
   _alpha_primal = _alpha_dual = 0;
 
-  _err_nlp_optim0 = -1.;
-  _err_nlp_feas0 = -1.;
-  _err_nlp_complem0 = -1;
+  if(!from_checkpoint) {
+    _err_nlp_optim0 = -1.;
+    _err_nlp_feas0 = -1.;
+    _err_nlp_complem0 = -1;
+  }
 
   // --- Algorithm status `algStatus` ----
   //-1 couldn't solve the problem (most likely because small search step. Restauration phase likely needed)
@@ -2235,8 +2444,12 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
   bool linsol_safe_mode_on = "stable" == hiop::tolower(nlp->options->GetString("linsol_mode"));
   bool linsol_forcequick = "forcequick" == hiop::tolower(nlp->options->GetString("linsol_mode"));
   bool elastic_mode_on = nlp->options->GetString("elastic_mode") != "none";
+  const bool full_iterate_callback_on = nlp->options->GetString("iterate_full_callback") == "yes";
   solver_status_ = NlpSolve_Pending;
   while(true) {
+    nlp->runStats.trace.set_iteration(iter_num_);
+    hiopTraceSpan trace_iter(nlp->runStats.trace, "iteration");
+
     bret = evalNlpAndLogErrors(*it_curr,
                                *resid,
                                _mu,
@@ -2252,7 +2465,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
     if(!bret) {
       solver_status_ = Error_In_User_Function;
       nlp->runStats.tmOptimizTotal.stop();
-      delete kkt;
+      release_kkt(kkt);
       return Error_In_User_Function;
     }
 
@@ -2300,6 +2513,20 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
       solver_status_ = User_Stopped;
       break;
     }
+    if(full_iterate_callback_on && !nlp->user_callback_full_iterate(*it_curr->get_x(),
+                                                                    *it_curr->get_zl(),
+                                                                    *it_curr->get_zu(),
+                                                                    *it_curr->get_yc(),
+                                                                    *it_curr->get_yd(),
+                                                                    *it_curr->get_d(),
+                                                                    *it_curr->get_vl(),
+                                                                    *it_curr->get_vu())) {
+      solver_status_ = User_Stopped;
+      break;
+    }
+
+    // checkpointing - based on options provided by the user
+    checkpointing_stuff();
 
     /*************************************************
      * Termination check
@@ -2340,7 +2567,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
                                  _err_cons_violation);
       if(!bret) {
         solver_status_ = Error_In_User_Function;
-        delete kkt;
+        release_kkt(kkt);
         return Error_In_User_Function;
       }
       nlp->log->printf(
@@ -2438,13 +2665,13 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
       if(!kkt->update(it_curr, _grad_f, _Jac_c, _Jac_d, _Hess_Lagr)) {
         if(linsol_safe_mode_on) {
           nlp->log->write("Unrecoverable error in step computation (factorization) [1]. Will exit here.", hovError);
-          delete kkt;
+          release_kkt(kkt);
           return solver_status_ = Err_Step_Computation;
         } else {
           // failed with 'linsol_mode'='forcequick' means unrecoverable
           if(linsol_forcequick) {
             nlp->log->write("Unrecoverable error in step computation (factorization) [2]. Will exit here.", hovError);
-            delete kkt;
+            release_kkt(kkt);
             return solver_status_ = Err_Step_Computation;
           }
 
@@ -2468,7 +2695,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
         if(!compute_search_direction(kkt, linsol_safe_mode_on, linsol_forcequick, iter_num_)) {
           if(linsol_safe_mode_on_before || linsol_forcequick) {
             // it fails under safe mode, this is fatal
-            delete kkt;
+            release_kkt(kkt);
             return solver_status_ = Err_Step_Computation;
           }
           // safe mode was turned on in the above call because kkt->compute_directions_w_IR(...) failed
@@ -2482,7 +2709,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
         if(!compute_search_direction_inertia_free(kkt, linsol_safe_mode_on, linsol_forcequick, iter_num_)) {
           if(linsol_safe_mode_on_before || linsol_forcequick) {
             // it failed under safe mode
-            delete kkt;
+            release_kkt(kkt);
             return solver_status_ = Err_Step_Computation;
           }
           // safe mode was turned on in the above call because kkt->compute_directions_w_IR(...) failed or the number
@@ -2535,6 +2762,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
       //
       double min_ls_step_size = nlp->options->GetNumeric("min_step_size");
       while(true) {
+        hiopTraceSpan trace_trial(nlp->runStats.trace, "line search trial");
         nlp->runStats.tmSolverInternal.start();  //---
 
         // check the step against the minimum step size, but accept small
@@ -2562,7 +2790,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
         if(!this->evalNlp_funcOnly(*it_trial, _f_nlp_trial, *_c_trial, *_d_trial)) {
           solver_status_ = Error_In_User_Function;
           nlp->runStats.tmOptimizTotal.stop();
-          delete kkt;
+          release_kkt(kkt);
           return Error_In_User_Function;
         }
 
@@ -2780,7 +3008,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
       if(!this->evalNlp_derivOnly(*it_trial, *_grad_f, *_Jac_c, *_Jac_d, *_Hess_Lagr)) {
         solver_status_ = Error_In_User_Function;
         nlp->runStats.tmOptimizTotal.stop();
-        delete kkt;
+        release_kkt(kkt);
         return Error_In_User_Function;
       }
     }
@@ -2818,6 +3046,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
   }
 
   nlp->runStats.tmOptimizTotal.stop();
+  write_trace();
 
   // solver_status_ contains the termination information
   displayTerminationMsg();
@@ -2832,7 +3061,7 @@ hiopSolveStatus hiopAlgFilterIPMNewton::run()
                               *it_curr->get_yc(),
                               *it_curr->get_yd(),
                               _f_nlp);
-  delete kkt;
+  release_kkt(kkt);
 
   return solver_status_;
 }
@@ -2886,6 +3115,145 @@ void hiopAlgFilterIPMNewton::outputIteration(int lsStatus, int lsNum, int use_so
   }
 }
 
+bool hiopAlgFilterIPMNewton::save_state_to_file(const ::std::string& path) noexcept
+{
+  const auto path_rank = hiopCheckpointSnapshot::rank_file_name(path, nlp->get_rank(), nlp->get_num_ranks());
+  try {
+    hiopCheckpointSnapshot chk;
+    save_state_to_snapshot(chk);
+    chk.write(path_rank);
+    return true;
+  } catch(const std::exception& exp) {
+    nlp->log->printf(hovError, "Error when saving checkpoint to file '%s'\n", path_rank.c_str());
+    nlp->log->printf(hovError, "  Addtl info: %s\n", exp.what());
+    return false;
+  }
+}
+
+bool hiopAlgFilterIPMNewton::load_state_from_file(const ::std::string& path) noexcept
+{
+  const auto path_rank = hiopCheckpointSnapshot::rank_file_name(path, nlp->get_rank(), nlp->get_num_ranks());
+  try {
+    if(nullptr == chk_loaded_) {
+      chk_loaded_ = new hiopCheckpointSnapshot();
+    }
+    chk_loaded_->read(path_rank);
+    if(chk_loaded_->get_num_ranks() != nlp->get_num_ranks() || chk_loaded_->get_rank() != nlp->get_rank()) {
+      ::std::stringstream ss;
+      ss << "Mismatch in the MPI ranks used to checkpoint. The file was saved by rank " << chk_loaded_->get_rank()
+         << " of " << chk_loaded_->get_num_ranks() << " ranks while HiOp currently runs on rank " << nlp->get_rank()
+         << " of " << nlp->get_num_ranks() << " ranks.";
+      throw std::runtime_error(ss.str());
+    }
+    nlp->log->printf(hovScalars, "Loaded checkpoint file [%s].\n", path_rank.c_str());
+    return true;
+  } catch(const std::exception& exp) {
+    nlp->log->printf(hovError, "Error in loading checkpoint from file '%s'\n", path_rank.c_str());
+    nlp->log->printf(hovError, "  Addtl info: %s\n", exp.what());
+    delete chk_loaded_;
+    chk_loaded_ = nullptr;
+    return false;
+  }
+}
+
+void hiopAlgFilterIPMNewton::save_state_to_snapshot(hiopCheckpointSnapshot& chk)
+{
+  chk.clear();
+  chk.set_ranks(nlp->get_num_ranks(), nlp->get_rank());
+
+  // iterate state
+  chk.add_iterate("alg_iterate_", *it_curr);
+
+  // algorithmic parameters for this state
+  constexpr double version = HIOP_VERSION_MAJOR * 100 + HIOP_VERSION_MINOR * 10 + HIOP_VERSION_PATCH;
+  const double alg_params[] = {_mu,
+                               (double)iter_num_total_,
+                               (double)nlp->get_num_ranks(),
+                               version,
+                               _tau,
+                               theta_max,
+                               theta_min,
+                               _err_nlp_optim0,
+                               _err_nlp_feas0,
+                               _err_nlp_complem0};
+  chk.add_array("alg_params", alg_params, sizeof(alg_params) / sizeof(double));
+
+  std::vector<double> filter_entries;
+  filter.get_entries(filter_entries);
+  chk.add_array("filter", filter_entries.data(), filter_entries.size());
+
+  pd_perturb_->save_state(chk);
+}
+
+void hiopAlgFilterIPMNewton::load_state_from_snapshot(const hiopCheckpointSnapshot& chk)
+{
+  //!!! dev note: match order in save_state_to_snapshot
+  const int nparams = 10;
+  double alg_params[nparams];
+  chk.copy_array("alg_params", alg_params, nparams);
+
+  // the iterate is loaded first so that a size mismatch leaves the parameters unchanged
+  chk.copy_iterate("alg_iterate_", *it_curr);
+
+  _mu = alg_params[0];
+  iter_num_total_ = alg_params[1];
+  _tau = alg_params[4];
+  theta_max = alg_params[5];
+  theta_min = alg_params[6];
+  _err_nlp_optim0 = alg_params[7];
+  _err_nlp_feas0 = alg_params[8];
+  _err_nlp_complem0 = alg_params[9];
+
+  filter.set_entries(chk.get_array("filter"));
+
+  const int ver_major = ((int)alg_params[3] / 100);
+  const int ver_minor = ((int)alg_params[3] - ver_major * 100) / 10;
+  const int ver_patch = (int)alg_params[3] - ver_major * 100 - ver_minor * 10;
+  nlp->log->printf(hovSummary,
+                   "Loaded checkpoint: ver %d.%d.%d on %d MPI ranks at mu=%12.5e from iter=%d.\n",
+                   ver_major,
+                   ver_minor,
+                   ver_patch,
+                   (int)alg_params[2],
+                   _mu,
+                   iter_num_total_);
+}
+
+void hiopAlgFilterIPMNewton::checkpointing_stuff()
+{
+  if(within_FR_ || nlp->options->GetString("checkpoint_save") == "no") {
+    return;
+  }
+  // the global iteration counter is used so that a restarted run keeps saving at the same iterations
+  int chk_every_N = nlp->options->GetInteger("checkpoint_save_every_N_iter");
+  if(iter_num_ > 0 && iter_num_total_ % chk_every_N == 0) {
+    using ::std::string;
+    // replace "#" in checkpointing file with iteration number
+    string path = nlp->options->GetString("checkpoint_file");
+    const auto s_it_num = ::std::to_string(iter_num_total_);
+    auto pos = path.find("#");
+    while(string::npos != pos) {
+      path.replace(pos, 1, s_it_num);
+      pos = path.find("#", pos);
+    }
+    path = hiopCheckpointSnapshot::rank_file_name(path, nlp->get_rank(), nlp->get_num_ranks());
+
+    if(nullptr == chk_writer_) {
+      chk_writer_ = new hiopCheckpointWriter();
+    }
+    // report the failures of the previous (asynchronous) writes, if any
+    string chk_errors;
+    if(!chk_writer_->check_errors(chk_errors)) {
+      nlp->log->printf(hovError, "Error when saving checkpoint: %s", chk_errors.c_str());
+    }
+
+    nlp->log->printf(hovSummary, "Saving checkpoint at iter %d in '%s'.\n", iter_num_total_, path.c_str());
+    // the state is copied to the snapshot here and written to the file on the writer's background thread
+    save_state_to_snapshot(chk_writer_->acquire());
+    chk_writer_->submit(path);
+  }
+}
+
 bool hiopAlgFilterIPMBase::ensure_moving_lims(const hiopIterate& it, const hiopIterate& dir, double& alpha_pr)
 {
   auto moving_lim_rel = nlp->options->GetNumeric("moving_lim_rel");
@@ -3024,6 +3392,7 @@ int hiopAlgFilterIPMBase::apply_second_order_correction(hiopKKTLinSys* kkt,
                                                         double& grad_phi_dx,
                                                         int& num_adjusted_slacks)
 {
+  hiopTraceSpan trace_soc(nlp->runStats.trace, "second order correction");
   int max_soc_iter = nlp->options->GetInteger("max_soc_iter");
   double kappa_soc = nlp->options->GetNumeric("kappa_soc");
 
@@ -3110,6 +3479,7 @@ int hiopAlgFilterIPMBase::apply_second_order_correction(hiopKKTLinSys* kkt,
 
 bool hiopAlgFilterIPMBase::apply_feasibility_restoration(hiopKKTLinSys* kkt)
 {
+  hiopTraceSpan trace_fr(nlp->runStats.trace, "feasibility restoration");
   bool fr_solved = true;
   bool reset_dual = true;
   if(!within_FR_) {
@@ -3121,51 +3491,44 @@ bool hiopAlgFilterIPMBase::apply_feasibility_restoration(hiopKKTLinSys* kkt)
     }
 
     // continue robust FR
-    hiopNlpFormulation* nlpFR{nullptr};
-    hiopNlpMDS* nlpMDS = dynamic_cast<hiopNlpMDS*>(nlp);
-    if(nlpMDS == nullptr) {
-      hiopNlpSparse* nlpSp = dynamic_cast<hiopNlpSparse*>(nlp);
-      if(nullptr == nlpSp) {
-        hiopNlpDenseConstraints* nlpD = dynamic_cast<hiopNlpDenseConstraints*>(nlp);
-        assert(nlpD && "Unkown system is provided. Please pick one from Dense, Sparse or MDS. ");
-        // this is Dense system
-        hiopFRProbDense nlp_fr_interface(*this);
-        nlpFR = new hiopNlpDenseConstraints(nlp_fr_interface, nlp->options->GetString("options_file_fr_prob").c_str());
-        fr_solved = solve_feasibility_restoration(kkt, *nlpFR);
-        if(fr_solved) {
-          nlp->log->printf(hovScalars, "FR problem provides sufficient reduction in primal feasibility!\n");
-          // FR succeeds, update it_trial->x and it_trial->d to the next search point
-          it_trial->get_x()->copyFrom(nlp_fr_interface.get_fr_sol_x());
-          it_trial->get_d()->copyFrom(nlp_fr_interface.get_fr_sol_d());
-          reset_var_from_fr_sol(kkt, reset_dual = true);
+    if(nullptr == fr_prob_) {
+      // first restoration phase of this solve: create the FR problem and its NLP formulation
+      const std::string fr_options_file = nlp->options->GetString("options_file_fr_prob");
+      hiopNlpMDS* nlpMDS = dynamic_cast<hiopNlpMDS*>(nlp);
+      if(nlpMDS == nullptr) {
+        hiopNlpSparse* nlpSp = dynamic_cast<hiopNlpSparse*>(nlp);
+        if(nullptr == nlpSp) {
+          hiopNlpDenseConstraints* nlpD = dynamic_cast<hiopNlpDenseConstraints*>(nlp);
+          assert(nlpD && "Unkown system is provided. Please pick one from Dense, Sparse or MDS. ");
+          // this is Dense system
+          hiopFRProbDense* fr_prob = new hiopFRProbDense(*this);
+          nlp_fr_ = new hiopNlpDenseConstraints(*fr_prob, fr_options_file.c_str());
+          fr_prob_ = fr_prob;
+        } else {
+          // this is Sparse linear system
+          hiopFRProbSparse* fr_prob = new hiopFRProbSparse(*this);
+          nlp_fr_ = new hiopNlpSparse(*fr_prob, fr_options_file.c_str());
+          fr_prob_ = fr_prob;
         }
       } else {
-        // this is Sparse linear system
-        hiopFRProbSparse nlp_fr_interface(*this);
-        nlpFR = new hiopNlpSparse(nlp_fr_interface, nlp->options->GetString("options_file_fr_prob").c_str());
-        fr_solved = solve_feasibility_restoration(kkt, *nlpFR);
-        if(fr_solved) {
-          nlp->log->printf(hovScalars, "FR problem provides sufficient reduction in primal feasibility!\n");
-          // FR succeeds, update it_trial->x and it_trial->d to the next search point
-          it_trial->get_x()->copyFrom(nlp_fr_interface.get_fr_sol_x());
-          it_trial->get_d()->copyFrom(nlp_fr_interface.get_fr_sol_d());
-          reset_var_from_fr_sol(kkt, reset_dual = true);
-        }
+        // this is MDS system
+        hiopFRProbMDS* fr_prob = new hiopFRProbMDS(*this);
+        nlp_fr_ = new hiopNlpMDS(*fr_prob, fr_options_file.c_str());
+        fr_prob_ = fr_prob;
       }
     } else {
-      // this is MDS system
-      hiopFRProbMDS nlp_fr_interface(*this);
-      nlpFR = new hiopNlpMDS(nlp_fr_interface, nlp->options->GetString("options_file_fr_prob").c_str());
-      fr_solved = solve_feasibility_restoration(kkt, *nlpFR);
-      if(fr_solved) {
-        nlp->log->printf(hovScalars, "FR problem provides sufficient reduction in primal feasibility!\n");
-        // FR succeeds, update it_trial->x and it_trial->d to the next search point
-        it_trial->get_x()->copyFrom(nlp_fr_interface.get_fr_sol_x());
-        it_trial->get_d()->copyFrom(nlp_fr_interface.get_fr_sol_d());
-        reset_var_from_fr_sol(kkt, reset_dual = true);
-      }
+      // the FR problem of a previous restoration phase is reused with the current iterate as reference point
+      fr_prob_->reset_reference_point();
+    }
+
+    fr_solved = solve_feasibility_restoration(kkt, *nlp_fr_);
+    if(fr_solved) {
+      nlp->log->printf(hovScalars, "FR problem provides sufficient reduction in primal feasibility!\n");
+      // FR succeeds, update it_trial->x and it_trial->d to the next search point
+      it_trial->get_x()->copyFrom(fr_prob_->get_fr_sol_x());
+      it_trial->get_d()->copyFrom(fr_prob_->get_fr_sol_d());
+      reset_var_from_fr_sol(kkt, reset_dual = true);
     }
-    delete nlpFR;
   } else {
     // FR problem inside a FR problem, see equation (33)
     // use wildcard function to update primal variables x
@@ -3212,16 +3575,22 @@ bool hiopAlgFilterIPMBase::solve_feasibility_restoration(hiopKKTLinSys* kkt, hio
 
   nlpFR.options->SetNumericValue("mu0", mu_FR);
 
-  hiopSolveStatus FR_status;
-  if(nlpFR.options->GetString("Hessian") == "analytical_exact") {
-    hiopAlgFilterIPMNewton solver(&nlpFR, true);  // solver fr problem
-    FR_status = solver.run();
+  // the solver of the FR problem is created on the first restoration phase and rerun by the following ones
+  if(nullptr == solver_fr_) {
+    if(nlpFR.options->GetString("Hessian") == "analytical_exact") {
+      solver_fr_ = new hiopAlgFilterIPMNewton(&nlpFR, true);  // solver fr problem
+    } else {
+      hiopNlpDenseConstraints* nlpFR_dense = dynamic_cast<hiopNlpDenseConstraints*>(&nlpFR);
+      assert(nlpFR_dense);
+      solver_fr_ = new hiopAlgFilterIPM(nlpFR_dense, true);  // solver fr problem
+    }
   } else {
-    hiopNlpDenseConstraints* nlpFR_dense = dynamic_cast<hiopNlpDenseConstraints*>(&nlpFR);
-    assert(nlpFR_dense);
-    hiopAlgFilterIPM solver(nlpFR_dense, true);  // solver fr problem
-    FR_status = solver.run();
+    // the reference point, hence the data of the FR problem, changed: its formulation (bounds and
+    // transformations, including the scaling) is rebuilt at the beginning of `run`
+    nlpFR.set_problem_data_changed();
   }
+  assert(solver_fr_->get_nlp() == &nlpFR);
+  hiopSolveStatus FR_status = solver_fr_->run();
 
   if(FR_status == User_Stopped) {
     // FR succeeds
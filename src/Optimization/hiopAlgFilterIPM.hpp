@@ -66,6 +66,7 @@
 #include "hiopDualsUpdater.hpp"
 #include "hiopPDPerturbation.hpp"
 #include "hiopFactAcceptor.hpp"
+#include "hiopCheckpoint.hpp"
 
 #ifdef HIOP_USE_AXOM
 namespace axom
@@ -82,6 +83,8 @@ class Group;  // forward declaration
 namespace hiop
 {
 
+class hiopFRProb;  // forward declaration
+
 class hiopAlgFilterIPMBase
 {
 public:
@@ -221,6 +224,8 @@ public:
   virtual bool solve_soft_feasibility_restoration(hiopKKTLinSys* kkt);
   virtual bool solve_feasibility_restoration(hiopKKTLinSys* kkt, hiopNlpFormulation& nlpFR);
   virtual bool reset_var_from_fr_sol(hiopKKTLinSys* kkt, bool reset_dual = false);
+  /// @brief Deletes the feasibility restoration problem, its NLP formulation and its solver
+  void dealloc_fr_objects();
 
   virtual void outputIteration(int lsStatus, int lsNum, int use_soc = 0, int use_fr = 0) = 0;
 
@@ -255,6 +260,12 @@ protected:
   /// Helper method containing all the deallocations done by the base algorithm class. Avoid overidding it.
   void dealloc_alg_objects();
 
+  /// Starts recording the trace of the solver phases if the 'profile_trace' option is on (not for a FR solve)
+  void start_trace();
+
+  /// Writes the trace recorded since `start_trace`, if any, to the file given by 'profile_trace_file'
+  void write_trace();
+
 protected:
   hiopNlpFormulation* nlp;
   hiopFilter filter;
@@ -346,6 +357,15 @@ protected:
   /* Flag to tell if this is a FR problem */
   bool within_FR_;
 
+  /**
+   * Feasibility restoration problem, its NLP formulation and its solver. Created on the first restoration
+   * phase of a solve and reused by the following ones, so that the allocations, the reading of the FR
+   * options file, and the analysis of the FR KKT linear system are done only once per solve.
+   */
+  hiopFRProb* fr_prob_;
+  hiopNlpFormulation* nlp_fr_;
+  hiopAlgFilterIPMBase* solver_fr_;
+
   hiopPDPerturbation* pd_perturb_;
   hiopFactAcceptor* fact_acceptor_;
 };
@@ -455,9 +475,67 @@ public:
 
   virtual hiopSolveStatus run();
 
+  /**
+   * @brief Solves the NLP again after its data changed, e.g., the bounds, the constraints' right-hand sides, or
+   * the parameters of the objective and constraints. The sizes of the NLP and the sparsity structure of the
+   * derivatives should not change.
+   *
+   * @details The bounds and the constraints info are re-queried from the user interface and the starting point
+   * is computed as in `run`. The iterates, the derivative matrices, and the KKT linear system of the previous
+   * `run` or `resolve`, including the ordering and symbolic factorization of the sparse linear solver, are
+   * reused. The KKT linear system is kept between the solves only when the option 'keep_kkt' is 'yes'. The
+   * objects are re-created as in `run` when the sizes of the NLP or the options that determine the KKT linear
+   * system changed.
+   */
+  hiopSolveStatus resolve();
+
+  /**
+   * @brief Save the state of the algorithm to the file for checkpointing.
+   *
+   * @param path the name of the file; for runs on multiple MPI ranks, each rank writes its local part
+   * of the state to the file "path.rank"
+   * @return true if successful, false otherwise
+   *
+   * @details
+   * The state (iterate, log-barrier and fraction-to-the-boundary parameters, filter, primal-dual
+   * perturbation state, and iteration counter) is written in HiOp's native checkpoint format (see
+   * hiopCheckpointSnapshot), which does not require any third-party library. A detailed error
+   * description is sent to the log if an error is caught. The checkpoints saved during `run` based on
+   * the "checkpoint_*" options are written asynchronously; this method writes synchronously.
+   */
+  bool save_state_to_file(const ::std::string& path) noexcept;
+
+  /**
+   * @brief Load the state of the algorithm from checkpoint file.
+   *
+   * @param path the name of the file to load from (without the ".rank" suffix for runs on multiple
+   * MPI ranks)
+   * @return true if successful, false otherwise
+   *
+   * @details
+   * The file should be saved by save_state_to_file() or by `run` (option "checkpoint_save") for a
+   * problem of the same sizes and on the same number of MPI ranks. The state is used as the starting
+   * point of the next call to `run`. A detailed error description is sent to the log if an error
+   * is caught.
+   */
+  bool load_state_from_file(const ::std::string& path) noexcept;
+
 protected:
   virtual void outputIteration(int lsStatus, int lsNum, int use_soc = 0, int use_fr = 0);
 
+  /// Saves the state of the algorithm to the checkpoint snapshot
+  void save_state_to_snapshot(hiopCheckpointSnapshot& chk);
+
+  /**
+   * Loads the iterate, the algorithmic parameters, and the filter from the checkpoint snapshot. The
+   * primal-dual perturbation state is loaded separately in `run` once the perturbation object is created.
+   * Throws std::runtime_error if the snapshot does not match the problem.
+   */
+  void load_state_from_snapshot(const hiopCheckpointSnapshot& chk);
+
+  /// The options-based logic for saving checkpoints; the files are written by `chk_writer_` on a background thread
+  void checkpointing_stuff();
+
   /// @brief Decides and creates the KKT linear system based on user options and NLP formulation.
   virtual hiopKKTLinSys* decideAndCreateLinearSystem(hiopNlpFormulation* nlp);
 
@@ -495,6 +573,34 @@ protected:
   /// Overridden method from base class that does some preprocessing specific to Newton solver
   void reload_options();
 
+  /**
+   * Keeps the KKT linear system at the end of `run` for the next call, or deletes it. The KKT matrix and the
+   * linear solver (with its symbolic analysis) are reused by the feasibility restoration solver, whose problem
+   * does not change between the restoration phases, and by `resolve` when the option 'keep_kkt' is 'yes'.
+   */
+  void release_kkt(hiopKKTLinSys* kkt);
+
+  /// Returns the KKT linear system kept by the previous `run` if it can be reused, otherwise a new one
+  hiopKKTLinSys* acquire_kkt();
+
+  /// Signature of the options that determine the KKT linear system and its linear solver
+  std::string kkt_options_signature() const;
+
+  /// KKT linear system kept between the calls to `run`
+  hiopKKTLinSys* kkt_kept_;
+
+  /// Value of `kkt_options_signature` when `kkt_kept_` was created
+  std::string kkt_kept_options_;
+
+  /// Whether `run` is called from `resolve`
+  bool resolving_;
+
+  /// Asynchronous writer of the checkpoints saved during `run`; created at the first checkpoint
+  hiopCheckpointWriter* chk_writer_;
+
+  /// Checkpoint loaded by `load_state_from_file` to be used as the starting point of the next `run`
+  hiopCheckpointSnapshot* chk_loaded_;
+
 private:
   hiopAlgFilterIPMNewton()
       : hiopAlgFilterIPMBase(NULL) {};
@@ -56,8 +56,14 @@
 #include "hiopInterfacePrimalDecomp.hpp"
 #include "hiopLogger.hpp"
 
+#ifdef HIOP_USE_OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <numeric>
 
 using namespace std;
 
@@ -65,8 +71,10 @@ namespace hiop
 {
 #ifdef HIOP_USE_MPI
 /** This struct provides the info necessary for the recourse approximation function
- * buffer[n+1] contains both the function value and gradient w.r.t x.
- * buffer[0] is the function value and buffer[1:n] the gradient.
+ * buffer[n+2+max_batch] contains the function value and gradient w.r.t x, followed by the status and the
+ * solve times of the contingencies of the batch.
+ * buffer[0] is the function value, buffer[1:n] the gradient, buffer[n+1] is 1 if the evaluation of a
+ * contingency of the batch failed (0 otherwise) and buffer[n+2:n+1+max_batch] the times.
  * Contains send and receive functionalities for the values in buffer.
  */
 struct ReqRecourseApprox
@@ -74,10 +82,11 @@ struct ReqRecourseApprox
   ReqRecourseApprox()
       : ReqRecourseApprox(1)
   {}
-  ReqRecourseApprox(const int& n)
+  ReqRecourseApprox(const int& n, const int& max_batch = 1)
   {
     n_ = n;
-    buffer = LinearAlgebraFactory::create_vector("DEFAULT", n_ + 1);
+    max_batch_ = max_batch;
+    buffer = LinearAlgebraFactory::create_vector("DEFAULT", n_ + 2 + max_batch_);
     request_ = MPI_REQUEST_NULL;
   }
   virtual ~ReqRecourseApprox() { delete buffer; }
@@ -100,20 +109,41 @@ struct ReqRecourseApprox
     request_ = MPI_REQUEST_NULL;
   }
 
-  // only receive signal (that computation is finished), no actual functional information
+  /** Waits for any of the posted receives/sends in `reqs` to complete and returns its position in `reqs`
+   * or -1 if there are no active requests.
+   */
+  static int wait_any(std::vector<ReqRecourseApprox*>& reqs)
+  {
+    std::vector<MPI_Request> mpi_reqs(reqs.size());
+    for(size_t r = 0; r < reqs.size(); r++) {
+      mpi_reqs[r] = reqs[r]->request_;
+    }
+    int r_done = MPI_UNDEFINED;
+    int ierr = MPI_Waitany(static_cast<int>(mpi_reqs.size()), mpi_reqs.data(), &r_done, MPI_STATUS_IGNORE);
+    assert(MPI_SUCCESS == ierr);
+    if(r_done == MPI_UNDEFINED) {
+      return -1;
+    }
+    reqs[r_done]->request_ = MPI_REQUEST_NULL;
+    return r_done;
+  }
+
+  // only receive signal (that computation is finished), the status and the solve times, no actual functional
+  // information
   void post_recv_end_signal(int tag, int rank_from, MPI_Comm comm)
   {
     assert(request_ == MPI_REQUEST_NULL);
-    int recv_sign = 0;
-    int ierr = MPI_Irecv(&recv_sign, 1, MPI_INT, rank_from, tag, comm, &request_);
+    double* buffer_arr = buffer->local_data();
+    int ierr = MPI_Irecv(buffer_arr + n_ + 1, 1 + max_batch_, MPI_DOUBLE, rank_from, tag, comm, &request_);
     assert(MPI_SUCCESS == ierr);
   }
-  // only sende signal (that computation is finished), no actual functional information
-  void post_send_end_signal(int tag, int rank_to, MPI_Comm comm)
+  // only send signal (that computation is finished), the status and the solve times of the `n_batch` contingencies
+  void post_send_end_signal(int tag, int rank_to, MPI_Comm comm, int n_batch)
   {
     assert(request_ == MPI_REQUEST_NULL);
-    int send_sign = 0;
-    int ierr = MPI_Isend(&send_sign, 1, MPI_INT, rank_to, tag, comm, &request_);
+    assert(n_batch <= max_batch_);
+    double* buffer_arr = buffer->local_data();
+    int ierr = MPI_Isend(buffer_arr + n_ + 1, 1 + n_batch, MPI_DOUBLE, rank_to, tag, comm, &request_);
     assert(MPI_SUCCESS == ierr);
   }
 
@@ -121,41 +151,49 @@ struct ReqRecourseApprox
   {
     assert(request_ == MPI_REQUEST_NULL);
     double* buffer_arr = buffer->local_data();
-    int ierr = MPI_Irecv(buffer_arr, n_ + 1, MPI_DOUBLE, rank_from, tag, comm, &request_);
+    int ierr = MPI_Irecv(buffer_arr, n_ + 2 + max_batch_, MPI_DOUBLE, rank_from, tag, comm, &request_);
     assert(MPI_SUCCESS == ierr);
   }
-  void post_send(int tag, int rank_to, MPI_Comm comm)
+  // sends the function value, the gradient, the status and the solve times of the `n_batch` contingencies
+  void post_send(int tag, int rank_to, MPI_Comm comm, int n_batch)
   {
     assert(request_ == MPI_REQUEST_NULL);
+    assert(n_batch <= max_batch_);
     double* buffer_arr = buffer->local_data();
-    int ierr = MPI_Isend(buffer_arr, n_ + 1, MPI_DOUBLE, rank_to, tag, comm, &request_);
+    int ierr = MPI_Isend(buffer_arr, n_ + 2 + n_batch, MPI_DOUBLE, rank_to, tag, comm, &request_);
     assert(MPI_SUCCESS == ierr);
   }
   double value() { return buffer->local_data()[0]; }
   void set_value(const double v) { buffer->local_data()[0] = v; }
   double grad(int i) { return buffer->local_data()[i + 1]; }
   void set_grad(const double* g) { buffer->copyFromStarting(1, g, n_); }
+  bool failed() { return buffer->local_data()[n_ + 1] != 0.; }
+  void set_failed(const bool failed) { buffer->local_data()[n_ + 1] = failed ? 1. : 0.; }
+  double time(int k) { return buffer->local_data()[n_ + 2 + k]; }
+  double* times() { return buffer->local_data() + n_ + 2; }
 
   MPI_Request request_;
 
 private:
   int n_;
+  int max_batch_;
   hiopVector* buffer;
 };
 
-/** This struct is used to post receive and request for contingency
- * index that is to be solved by the solver ranks.
+/** This struct is used to post receive and request for the batch of contingency
+ * indices that is to be solved by the solver ranks.
+ * buffer[0] is the number of indices in the batch and buffer[1:max_batch] the indices.
+ * An empty batch is the end signal.
  */
 struct ReqContingencyIdx
 {
   ReqContingencyIdx()
-      : ReqContingencyIdx(-1)
+      : ReqContingencyIdx(1)
+  {}
+  ReqContingencyIdx(const int& max_batch)
+      : request_(MPI_REQUEST_NULL),
+        buffer(max_batch + 1, 0)
   {}
-  ReqContingencyIdx(const int& idx_)
-      : request_(MPI_REQUEST_NULL)
-  {
-    idx = idx_;
-  }
 
   int test()
   {
@@ -177,21 +215,105 @@ struct ReqContingencyIdx
   void post_recv(int tag, int rank_from, MPI_Comm comm)
   {
     assert(request_ == MPI_REQUEST_NULL);
-    int ierr = MPI_Irecv(&idx, 1, MPI_INT, rank_from, tag, comm, &request_);
+    int ierr = MPI_Irecv(buffer.data(), static_cast<int>(buffer.size()), MPI_INT, rank_from, tag, comm, &request_);
     assert(MPI_SUCCESS == ierr);
   }
   void post_send(int tag, int rank_to, MPI_Comm comm)
   {
     assert(request_ == MPI_REQUEST_NULL);
-    int ierr = MPI_Isend(&idx, 1, MPI_INT, rank_to, tag, comm, &request_);
+    int ierr = MPI_Isend(buffer.data(), buffer[0] + 1, MPI_INT, rank_to, tag, comm, &request_);
     assert(MPI_SUCCESS == ierr);
   }
-  int value() { return idx; }
-  void set_idx(const int& i) { idx = i; }
+  // number of indices in the batch, 0 for the end signal
+  int size() const { return buffer[0]; }
+  const int* indices() const { return buffer.data() + 1; }
+  void set_idx(const int* idx, const int& n)
+  {
+    assert(n >= 1 && n < static_cast<int>(buffer.size()));
+    buffer[0] = n;
+    std::copy(idx, idx + n, buffer.begin() + 1);
+  }
+  void set_end_signal() { buffer[0] = 0; }
   MPI_Request request_;
 
 private:
-  int idx;
+  std::vector<int> buffer;
+};
+
+/** Contingencies not sent out yet to the evaluator ranks during an outer iteration.
+ * The contingencies are handed out in the order of `order`. When `rank_of` is not empty, the contingencies
+ * are first handed out to the rank `rank_of[i]` that evaluated them at the previous outer iteration: a rank
+ * takes its own contingencies first, then the ones not evaluated yet and, only when none of these are left,
+ * the ones of the other ranks.
+ */
+struct ContingencyQueue
+{
+  ContingencyQueue(const std::vector<int>& order,
+                   const std::vector<double>& work,
+                   const std::vector<int>& rank_of,
+                   const int comm_size)
+      : order_(order),
+        work_(work),
+        sent_(order.size(), 0),
+        own_(comm_size),
+        own_pos_(comm_size, 0),
+        unowned_pos_(0),
+        next_(0),
+        n_left_(static_cast<int>(order.size())),
+        work_left_(0.)
+  {
+    for(int i: order_) {
+      work_left_ += work_[i];
+      const int r = rank_of.empty() ? -1 : rank_of[i];
+      if(r >= 1 && r < comm_size) {
+        own_[r].push_back(i);
+      } else {
+        unowned_.push_back(i);
+      }
+    }
+  }
+
+  /// Returns the next contingency to be sent to rank r (and marks it as sent) or -1 if none is left
+  int next(const int r)
+  {
+    int i = -1;
+    while(i < 0 && own_pos_[r] < static_cast<int>(own_[r].size())) {
+      i = take(own_[r][own_pos_[r]++]);
+    }
+    while(i < 0 && unowned_pos_ < static_cast<int>(unowned_.size())) {
+      i = take(unowned_[unowned_pos_++]);
+    }
+    while(i < 0 && next_ < static_cast<int>(order_.size())) {
+      i = take(order_[next_++]);
+    }
+    return i;
+  }
+
+  int n_left() const { return n_left_; }
+  double work_left() const { return work_left_; }
+
+private:
+  int take(const int i)
+  {
+    if(sent_[i]) {
+      return -1;
+    }
+    sent_[i] = 1;
+    n_left_--;
+    work_left_ -= work_[i];
+    return i;
+  }
+
+  const std::vector<int>& order_;
+  const std::vector<double>& work_;
+  std::vector<char> sent_;
+  std::vector<std::vector<int>> own_;
+  std::vector<int> own_pos_;
+  std::vector<int> unowned_;
+  int unowned_pos_;
+  int next_;
+  int n_left_;
+  double work_left_;
 };
 #endif
 
@@ -578,6 +700,16 @@ hiopAlgPrimalDecomposition::hiopAlgPrimalDecomposition(hiopInterfacePriDecProble
 
   set_local_accum(options_->GetString("accum_local"));
 
+  set_num_threads_rterm(options_->GetInteger("recourse_num_threads"));
+
+  schedule_ = options_->GetString("recourse_schedule");
+  cont_order_ = options_->GetString("recourse_order");
+  cont_time_.assign(S_, 0.);
+  cont_rank_.assign(S_, -1);
+
+  warm_start_ = options_->GetString("recourse_warm_start") == "yes";
+  master_prob_->get_recourse_warm_start().set_enabled(warm_start_);
+
   assert(alpha_max_ > alpha_min_);
 
   set_verbosity(options_->GetInteger("verbosity_level"));
@@ -634,6 +766,16 @@ hiopAlgPrimalDecomposition::hiopAlgPrimalDecomposition(hiopInterfacePriDecProble
 
   set_local_accum(options_->GetString("accum_local"));
 
+  set_num_threads_rterm(options_->GetInteger("recourse_num_threads"));
+
+  schedule_ = options_->GetString("recourse_schedule");
+  cont_order_ = options_->GetString("recourse_order");
+  cont_time_.assign(S_, 0.);
+  cont_rank_.assign(S_, -1);
+
+  warm_start_ = options_->GetString("recourse_warm_start") == "yes";
+  master_prob_->get_recourse_warm_start().set_enabled(warm_start_);
+
   set_verbosity(options_->GetInteger("verbosity_level"));
   log_ = new hiopLogger(options_, stdout, 0, comm_world);
 
@@ -649,6 +791,9 @@ hiopAlgPrimalDecomposition::~hiopAlgPrimalDecomposition()
   delete x_;
   delete options_;
   delete log_;
+  for(auto grad: grad_batch_) {
+    delete grad;
+  }
 #ifdef HIOP_USE_MPI
   delete[] request_;
 #endif
@@ -734,10 +879,282 @@ void hiopAlgPrimalDecomposition::set_alpha_max(const double alp_max) { alpha_max
 
 void hiopAlgPrimalDecomposition::set_local_accum(const std::string local_accum) { local_accum_ = local_accum; }
 
+void hiopAlgPrimalDecomposition::set_num_threads_rterm(const int num_threads)
+{
+  assert(num_threads >= 0);
+#ifdef HIOP_USE_OPENMP
+  num_threads_rterm_ = num_threads > 0 ? num_threads : omp_get_max_threads();
+#else
+  num_threads_rterm_ = 1;
+#endif
+}
+
+bool hiopAlgPrimalDecomposition::eval_rterms_batch(const int* idx,
+                                                   const int n_idx,
+                                                   hiopVector& x0,
+                                                   double& rval,
+                                                   hiopVector& grad,
+                                                   double* times /*=nullptr*/)
+{
+  while(static_cast<int>(grad_batch_.size()) < n_idx) {
+    grad_batch_.push_back(grad.alloc_clone());
+  }
+  for(int k = 0; k < n_idx; k++) {
+    grad_batch_[k]->setToZero();
+  }
+  std::vector<double> rval_batch(n_idx, 0.);
+  double* x0_vec = x0.local_data();
+
+  // the value and gradient of a term are evaluated one after the other by the same thread since the
+  // gradient is usually computed in eval_f_rterm; the recourse problems can take very different times
+  // to solve, hence the dynamic schedule
+  int n_fail = 0;
+#ifdef HIOP_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads_rterm_) if(num_threads_rterm_ > 1 && n_idx > 1) \
+    reduction(+ : n_fail)
+#endif
+  for(int k = 0; k < n_idx; k++) {
+    const auto t_start = std::chrono::steady_clock::now();
+    if(!master_prob_->eval_f_rterm(idx[k], nc_, x0_vec, rval_batch[k])) {
+      n_fail++;
+    }
+    if(!master_prob_->eval_grad_rterm(idx[k], nc_, x0_vec, *grad_batch_[k])) {
+      n_fail++;
+    }
+    if(times) {
+      times[k] = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+    }
+  }
+
+  // accumulate in the order of the batch so that the sums do not depend on the number of threads
+  for(int k = 0; k < n_idx; k++) {
+    rval += rval_batch[k];
+    grad.axpy(1.0, *grad_batch_[k]);
+  }
+  return n_fail == 0;
+}
+
 /** MPI engine for pridec solver
  */
 
 #ifdef HIOP_USE_MPI
+void hiopAlgPrimalDecomposition::setup_batches()
+{
+  // number of threads evaluating the recourse terms of each evaluator rank
+  rank_num_threads_.resize(comm_size_);
+  int ierr = MPI_Allgather(&num_threads_rterm_, 1, MPI_INT, rank_num_threads_.data(), 1, MPI_INT, comm_world_);
+  assert(ierr == MPI_SUCCESS);
+
+  total_num_threads_ = 0;
+  for(int r = 1; r < comm_size_; r++) {
+    total_num_threads_ += rank_num_threads_[r];
+  }
+
+  // The largest batch of a rank is its share (based on threads) of all the contingencies, which is the
+  // size of the first batch of guided scheduling when all contingencies take the same time.
+  rank_max_batch_.resize(comm_size_);
+  rank_max_batch_[0] = 1;
+  for(int r = 1; r < comm_size_; r++) {
+    if(schedule_ == "guided") {
+      const double share = static_cast<double>(S_) * rank_num_threads_[r] / total_num_threads_;
+      rank_max_batch_[r] = std::max(rank_num_threads_[r], static_cast<int>(std::ceil(share)));
+    } else {
+      rank_max_batch_[r] = rank_num_threads_[r];
+    }
+  }
+
+  if(my_rank_ == 0) {
+    log_->printf(hovSummary,
+                 "recourse threads per evaluator rank  min %d  max %d, '%s' batches, '%s' order\n",
+                 *std::min_element(rank_num_threads_.begin() + 1, rank_num_threads_.end()),
+                 *std::max_element(rank_num_threads_.begin() + 1, rank_num_threads_.end()),
+                 schedule_.c_str(),
+                 cont_order_.c_str());
+  }
+}
+
+void hiopAlgPrimalDecomposition::fill_batch(const int r, ContingencyQueue& queue, std::vector<int>& batch) const
+{
+  batch.clear();
+  const int num_threads = rank_num_threads_[r];
+  // Guided self-scheduling: the batch gets the rank's share (based on threads) of the remaining work divided
+  // by `guided_factor_`, so that the batches get smaller towards the end of the iteration and the evaluators
+  // finish at about the same time. A batch has at least one contingency per thread.
+  const double target =
+      schedule_ == "guided" ? queue.work_left() * num_threads / (guided_factor_ * total_num_threads_) : 0.;
+  const int max_batch = schedule_ == "guided" ? rank_max_batch_[r] : num_threads;
+  double batch_work = 0.;
+  while(queue.n_left() > 0 && static_cast<int>(batch.size()) < max_batch &&
+        (static_cast<int>(batch.size()) < num_threads || batch_work < target)) {
+    const double work_left = queue.work_left();
+    batch.push_back(queue.next(r));
+    batch_work += work_left - queue.work_left();
+  }
+}
+
+bool hiopAlgPrimalDecomposition::dispatch_rterms(std::vector<ReqRecourseApprox*>& rec_prob,
+                                                 std::vector<ReqContingencyIdx*>& req_cont_idx,
+                                                 const bool accum_local,
+                                                 double& rval,
+                                                 hiopVector& grad)
+{
+  // the contingencies are sent out in the order of `cont_idx`
+  std::vector<int> cont_idx(S_);
+  std::iota(cont_idx.begin(), cont_idx.end(), 0);
+  if(cont_order_ == "expensive_first") {
+    std::stable_sort(cont_idx.begin(), cont_idx.end(), [&](int a, int b) { return cont_time_[a] > cont_time_[b]; });
+  }
+
+  // Estimated work of each contingency: its solve time at the previous outer iteration or, for contingencies
+  // not solved yet, the average of the known times (any constant when none is known)
+  double known_work = 0.;
+  int n_known = 0;
+  for(int i = 0; i < static_cast<int>(S_); i++) {
+    if(cont_time_[i] > 0.) {
+      known_work += cont_time_[i];
+      n_known++;
+    }
+  }
+  const double unknown_work = n_known > 0 ? known_work / n_known : 1.;
+  std::vector<double> work(S_);
+  for(int i = 0; i < static_cast<int>(S_); i++) {
+    work[i] = cont_time_[i] > 0. ? cont_time_[i] : unknown_work;
+  }
+
+  // with warm start, the contingencies go preferably to the rank that has their previous solution
+  const std::vector<int> no_affinity;
+  ContingencyQueue queue(cont_idx, work, warm_start_ ? cont_rank_ : no_affinity, comm_size_);
+
+  double* grad_vec = grad.local_data();
+  std::vector<int> batch;
+  int n_batches = 0;
+  int n_affinity = 0;
+  int n_failed = 0;
+  // Initialize the recourse communication by sending a first batch to each evaluator. The evaluators
+  // that have no batch in progress once all the contingencies are sent out are done for this iteration.
+  for(int r = 1; r < comm_size_ && queue.n_left() > 0; r++) {
+    fill_batch(r, queue, batch);
+    req_cont_idx[r]->set_idx(batch.data(), static_cast<int>(batch.size()));
+    req_cont_idx[r]->post_send(1, r, comm_world_);
+    // Posting initial receive of recourse solutions from evaluators
+    if(accum_local) {
+      rec_prob[r]->post_recv_end_signal(2, r, comm_world_);  // 2 is the tag, r is the rank source
+    } else {
+      rec_prob[r]->post_recv(2, r, comm_world_);
+    }
+    n_affinity += std::count_if(batch.begin(), batch.end(), [&](int i) { return cont_rank_[i] == r; });
+    n_batches++;
+  }
+
+  // wait for the evaluators' results (rather than polling) and send the next batch to the rank that is done
+  int r = ReqRecourseApprox::wait_any(rec_prob);
+  while(r >= 0) {
+    if(rec_prob[r]->failed()) {
+      // the remaining contingencies are still dispatched, so that all the evaluators reach the end signal
+      log_->printf(hovError, "evaluation of the recourse terms failed on rank %d\n", r);
+      n_failed++;
+    }
+    if(!accum_local) {
+      // add to the master rank variables
+      rval += rec_prob[r]->value();
+      for(int i = 0; i < static_cast<int>(nc_); i++) {
+        grad_vec[i] += rec_prob[r]->grad(i);
+      }
+    }
+    const int* batch_idx = req_cont_idx[r]->indices();
+    for(int k = 0; k < req_cont_idx[r]->size(); k++) {
+      cont_time_[batch_idx[k]] = rec_prob[r]->time(k);
+      cont_rank_[batch_idx[k]] = r;
+    }
+
+    if(queue.n_left() > 0) {
+      fill_batch(r, queue, batch);
+      log_->printf(hovLinesearch, "%lu contingencies (first %d) sent to rank %d\n", batch.size(), batch[0], r);
+      req_cont_idx[r]->wait();  // Ensure previous cont idx send has completed.
+      req_cont_idx[r]->set_idx(batch.data(), static_cast<int>(batch.size()));
+      req_cont_idx[r]->post_send(1, r, comm_world_);
+      if(accum_local) {
+        rec_prob[r]->post_recv_end_signal(2, r, comm_world_);  // 2 is the tag, r is the rank source
+      } else {
+        rec_prob[r]->post_recv(2, r, comm_world_);
+      }
+      n_affinity += std::count_if(batch.begin(), batch.end(), [&](int i) { return cont_rank_[i] == r; });
+      n_batches++;
+    } else {
+      log_->printf(hovLinesearch, "last loop for rank %d\n", r);
+    }
+    r = ReqRecourseApprox::wait_any(rec_prob);
+  }
+
+  // send end signal to all evaluators
+  for(int r = 1; r < comm_size_; r++) {
+    req_cont_idx[r]->wait();  // Ensure previous idx send has completed.
+    req_cont_idx[r]->set_end_signal();
+    req_cont_idx[r]->post_send(1, r, comm_world_);
+  }
+
+  const int i_max = static_cast<int>(std::max_element(cont_time_.begin(), cont_time_.end()) - cont_time_.begin());
+  log_->printf(hovScalars,
+               "recourse terms solved in %d batches, slowest contingency %d (%.3e s)\n",
+               n_batches,
+               i_max,
+               cont_time_[i_max]);
+  if(warm_start_) {
+    log_->printf(hovScalars,
+                 "%d of %lu contingencies evaluated by the same rank as at the previous iteration\n",
+                 n_affinity,
+                 S_);
+  }
+  return n_failed == 0;
+}
+
+void hiopAlgPrimalDecomposition::evaluate_rterms(ReqRecourseApprox& rec_prob,
+                                                 ReqContingencyIdx& req_cont_idx,
+                                                 hiopVector& x0,
+                                                 const bool accum_local,
+                                                 double& rval,
+                                                 hiopVector& grad)
+{
+  const int rank_master = 0;
+  // loop until end signal (an empty batch) is received
+  while(true) {
+    // Receive the indices of the contingencies to evaluate
+    req_cont_idx.post_recv(1, rank_master, comm_world_);
+    req_cont_idx.wait();
+    const int n_batch = req_cont_idx.size();
+    if(n_batch == 0) {
+      break;
+    }
+
+    rec_prob.wait();  // Ensure send buffer is safe to use.
+    if(!accum_local) {
+      rval = 0.;
+      grad.setToZero();
+    }
+    // the solve times are written directly in the send buffer
+    bool bret = eval_rterms_batch(req_cont_idx.indices(), n_batch, x0, rval, grad, rec_prob.times());
+    if(!bret) {
+      log_->printf(hovError,
+                   "evaluation of the recourse terms of %d contingencies (first %d) failed on rank %d\n",
+                   n_batch,
+                   req_cont_idx.indices()[0],
+                   my_rank_);
+    }
+    // the master rank is informed of the failure
+    rec_prob.set_failed(!bret);
+
+    if(accum_local) {
+      // send signal that the subproblems have been solved
+      rec_prob.post_send_end_signal(2, rank_master, comm_world_, n_batch);
+    } else {
+      rec_prob.set_value(rval);
+      rec_prob.set_grad(grad.local_data());
+      rec_prob.post_send(2, rank_master, comm_world_, n_batch);
+    }
+  }
+  rec_prob.wait();  // Ensure the last send has completed.
+}
+
 hiopSolveStatus hiopAlgPrimalDecomposition::run()
 {
   log_->printf(hovSummary, "===============\nHiop Primal Decomposition SOLVER\n===============\n");
@@ -756,6 +1173,8 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run()
     log_->printf(hovSummary, "total number of recourse problems  %lu\n", S_);
     log_->printf(hovSummary, "total ranks %d\n", comm_size_);
   }
+  setup_batches();
+
   // initial point set to all zero, for now
   x_->setToConstant(0.0);
 
@@ -768,22 +1187,17 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run()
   hiopVector* grad_r;
   grad_r = LinearAlgebraFactory::create_vector(options_->GetString("mem_space"), nc_);
   grad_r->setToZero();
-  double* grad_r_vec = grad_r->local_data();
 
   hiopVector* hess_appx = grad_r->alloc_clone();
   hess_appx->setToZero();
 
   hiopVector* x0 = grad_r->alloc_clone();
   x0->setToZero();
-  double* x0_vec = x0->local_data();
 
-  hiopVector* grad_aux = x0->alloc_clone();
-  grad_aux->setToZero();
   // local recourse terms for each evaluator, defined accross all processors
   double rec_val = 0.;
   hiopVector* grad_acc = grad_r->alloc_clone();
   grad_acc->setToZero();
-  double* grad_acc_vec = grad_acc->local_data();
 
   // hess_appx_2 is declared by all ranks while only rank 0 uses it
   HessianApprox* hess_appx_2 = new HessianApprox(nc_, alpha_ratio_, master_prob_, options_);
@@ -850,225 +1264,43 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run()
     // set up recourse problem send/recv interface
     std::vector<ReqRecourseApprox*> rec_prob;
     for(int r = 0; r < comm_size_; r++) {
-      rec_prob.push_back(new ReqRecourseApprox(nc_));
+      rec_prob.push_back(new ReqRecourseApprox(nc_, rank_max_batch_[r]));
     }
 
     std::vector<ReqContingencyIdx*> req_cont_idx;
     for(int r = 0; r < comm_size_; r++) {
-      req_cont_idx.push_back(new ReqContingencyIdx(0));
+      req_cont_idx.push_back(new ReqContingencyIdx(rank_max_batch_[r]));
     }
 
     // master rank communication
     if(my_rank_ == 0) {
-      // array for number of indices, currently the indices are in [0,S_]
       rval = 0.;
       grad_r->setToZero();
 
-      std::vector<int> cont_idx(S_);
-      for(int i = 0; i < static_cast<int>(S_); i++) {
-        cont_idx[i] = i;
-      }
-      // The number of contigencies/recourse problems should be larger than the number of processors
-      assert(static_cast<int>(S_) >= comm_size_ - 1);
-      // idx is the next contingency to be sent out from the master
-      int idx = 0;
-      // Initilize the recourse communication by sending indices to the evaluator
-      // Using Blocking send here
-      for(int r = 1; r < comm_size_; r++) {
-        int cur_idx = cont_idx[idx];
-        int ierr = MPI_Send(&cur_idx, 1, MPI_INT, r, 1, comm_world_);
-        assert(MPI_SUCCESS == ierr);
-        // log_->printf(hovIteration, "rank %d to get contingency index  %d\n", r, cur_idx); //verbosity level 10
-        idx += 1;
-      }
-      // Posting initial receive of recourse solutions from evaluators
-      for(int r = 1; r < comm_size_; r++) {
-        // int cur_idx = cont_idx[idx];
-        rec_prob[r]->post_recv(2, r, comm_world_);  // 2 is the tag, r is the rank source
-      }
-      // Both finish_flag and last_loop are used to deal with the final round remaining contingencies/recourse problems.
-      // Some ranks are finished while others are not. The loop needs to continue to fetch the results.
-      // hiopVectorInt* finish_flag = LinearAlgebraFactory::createVectorInt(comm_size_);
-      // finish_flag->setToZero();
-      std::vector<int> finish_flag(comm_size_);  // standard vector will be replaced by hiopVectorInt
-      for(int i = 0; i < comm_size_; i++) {
-        finish_flag[i] = 0;
-      }
-      int last_loop = 0;
-      // log_->printf(hovIteration, "total idx %d\n", S_);
       t2 = MPI_Wtime();
-
       log_->printf(hovFcnEval, "Elapsed time for entire iteration %d is %f\n", it, t2 - t1);
 
-      while(idx <= static_cast<int>(S_) || last_loop) {
-        for(int r = 1; r < comm_size_; r++) {
-          int mpi_test_flag = rec_prob[r]->test();
-          if(mpi_test_flag && (finish_flag[r] == 0)) {  // receive completed
-            if(!last_loop && idx < static_cast<int>(S_)) {
-              log_->printf(hovLinesearch, "idx %d sent to rank %d\n", idx, r);
-            } else {
-              log_->printf(hovLinesearch, "last loop for rank %d\n", r);
-            }
-            // add to the master rank variables
-            rval += rec_prob[r]->value();
-            for(int i = 0; i < static_cast<int>(nc_); i++) {
-              grad_r_vec[i] += rec_prob[r]->grad(i);
-            }
-            if(last_loop) {
-              finish_flag[r] = 1;
-            }
-            // this is for dealing with the end of contingencies where some ranks have already finished
-            if(idx < static_cast<int>(S_)) {
-              req_cont_idx[r]->wait();  // Ensure previous cont idx send has completed.
-              req_cont_idx[r]->set_idx(cont_idx[idx]);
-              req_cont_idx[r]->post_send(1, r, comm_world_);
-              rec_prob[r]->post_recv(2, r, comm_world_);  // 2 is the tag, r is the rank source
-              // log_->printf(hovFcnEval, "recourse value: is %18.12e)\n", rec_prob[r]->value());
-            } else {
-              finish_flag[r] = 1;
-              last_loop = 1;
-            }
-            idx += 1;
-          }
-        }
-
-        // Current way of ending the loop while accounting for all the last round of results
-        if(last_loop) {
-          last_loop = 0;
-          for(int r = 1; r < comm_size_; r++) {
-            if(finish_flag[r] == 0) {
-              last_loop = 1;
-            }
-          }
-        }
+      if(!dispatch_rterms(rec_prob, req_cont_idx, false, rval, *grad_r)) {
+        solver_status_ = Error_In_User_Function;
+        end_signal = 1;
       }
+
       rval /= S_;
       grad_r->scale(1.0 / S_);
-      // send end signal to all evaluators
-      for(int r = 1; r < comm_size_; r++) {
-        req_cont_idx[r]->wait();  // Ensure previous idx send has completed.
-        req_cont_idx[r]->set_idx(-1);
-        req_cont_idx[r]->post_send(1, r, comm_world_);
-      }
       t2 = MPI_Wtime();
       log_->printf(hovFcnEval, "Elapsed time for entire iteration %d is %f\n", it, t2 - t1);
     }
 
     // evaluators
     if(my_rank_ != 0) {
-      /* old sychronous implementation of contingencies
-       * int cpr = S_/(comm_size_-1); //contingency per rank
-       * int cr = S_%(comm_size_-1); //contingency remained
-       * log_->printf(hovIteration, "my rank start evaluating work %d)\n", my_rank_);
-       */
-      std::vector<int> cont_idx(1);  // currently sending/receiving one contingency index at a time
-      int cont_i = 0;
-      cont_idx[0] = 0;
-      // Receive the index of the contingency to evaluate
-      int mpi_test_flag = 0;
-      int ierr = MPI_Recv(&cont_i, 1, MPI_INT, rank_master, 1, comm_world_, &status_);
-      assert(MPI_SUCCESS == ierr);
-      cont_idx[0] = cont_i;
-      // log_->printf(hovIteration, "contingency index %d, rank %d)\n", cont_idx[0],my_rank_);
-      // compute the recourse function values and gradients
-      rec_val = 0.;
-
-      grad_acc->setToZero();
-      double aux = 0.;
-
       if(nc_ < n_) {
         x0->copy_from_indexes(*x_, *xc_idx_);
       } else {
         assert(nc_ == n_);
         x0->copyFromStarting(0, *x_);
       }
-      for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-        aux = 0.;
-        int idx_temp = cont_idx[ri];
-
-        bret = master_prob_->eval_f_rterm(idx_temp, nc_, x0_vec, aux);  // solving the recourse problem
-        if(!bret) {
-          // TODO
-        }
-        rec_val += aux;
-      }
-      // log_->printf(hovFcnEval, "recourse value: is %18.12e)\n", rec_val);
-
-      grad_aux->setToZero();
-
-      for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-        int idx_temp = cont_idx[ri];
-        bret = master_prob_->eval_grad_rterm(idx_temp, nc_, x0_vec, *grad_aux);
-        if(!bret) {
-          // TODO
-        }
-        grad_acc->axpy(1.0, *grad_aux);
-      }
-      rec_prob[my_rank_]->wait();  // Ensure send buffer is safe to use.
-      rec_prob[my_rank_]->set_value(rec_val);
-
-      rec_prob[my_rank_]->set_grad(grad_acc_vec);
-      rec_prob[my_rank_]->post_send(2, rank_master, comm_world_);
-
-      req_cont_idx[my_rank_]->post_recv(1, rank_master, comm_world_);
-      while(cont_idx[0] != -1) {  // loop until end signal received
-        mpi_test_flag = req_cont_idx[my_rank_]->test();
-        /* contigency starts at 0
-         * sychronous implmentation of contingencist
-         */
-        if(mpi_test_flag) {
-          // log_->printf(hovIteration, "contingency index %d, rank %d)\n", cont_idx[0],my_rank_);
-          for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-            cont_idx[ri] = req_cont_idx[my_rank_]->value();
-          }
-          if(cont_idx[0] == -1) {
-            break;
-          }
-          rec_val = 0.;
-          grad_acc->setToZero();
-
-          double aux = 0.;
-          if(nc_ < n_) {
-            x0->copy_from_indexes(*x_, *xc_idx_);
-          } else {
-            assert(nc_ == n_);
-            x0->copyFromStarting(0, *x_);
-          }
-          for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-            aux = 0.;
-            int idx_temp = cont_idx[ri];
-
-            bret = master_prob_->eval_f_rterm(idx_temp, nc_, x0_vec, aux);  // need to add extra time here
-            if(!bret) {
-              // TODO
-            }
-            rec_val += aux;
-          }
-          // log_->printf(hovFcnEval, "recourse value: is %18.12e)\n", rec_val);
-          grad_aux->setToZero();
-
-          for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-            int idx_temp = cont_idx[ri];
-            bret = master_prob_->eval_grad_rterm(idx_temp, nc_, x0_vec, *grad_aux);
-            if(!bret) {
-              // TODO
-            }
-            grad_acc->axpy(1.0, *grad_aux);
-          }
-
-          rec_prob[my_rank_]->wait();  // Ensure send buffer is safe to use.
-          rec_prob[my_rank_]->set_value(rec_val);
-
-          rec_prob[my_rank_]->set_grad(grad_acc_vec);
-          rec_prob[my_rank_]->post_send(2, rank_master, comm_world_);
-          // do something with the func eval and gradient to determine the quadratic regularization
-          // log_->printf(hovIteration, "send recourse value flag for test %d \n", mpi_test_flag);
-
-          // post recv for new index
-          req_cont_idx[my_rank_]->post_recv(1, rank_master, comm_world_);
-          // ierr = MPI_Irecv(&cont_idx[0], 1, MPI_INT, rank_master, 1, comm_world_, &request_[0]);
-        }
-      }
+      // solve the batches of contingencies and send their recourse values and gradients to the master rank
+      evaluate_rterms(*rec_prob[my_rank_], *req_cont_idx[my_rank_], *x0, false, rec_val, *grad_acc);
     }
 
     if(my_rank_ == 0) {
@@ -1086,7 +1318,10 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run()
         assert(curr->request_ == MPI_REQUEST_NULL);
       }
 #endif  // NDEBUG
+    }
 
+    // the master problem is not updated with the recourse terms of a failed evaluation
+    if(my_rank_ == 0 && !end_signal) {
       recourse_val = rval;
 
       log_->printf(hovSummary, "real rval %18.12e\n", rval);
@@ -1207,7 +1442,6 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run()
   delete grad_r;
   delete hess_appx;
   delete x0;
-  delete grad_aux;
   delete grad_acc;
   delete hess_appx_2;
   delete evaluator;
@@ -1238,6 +1472,8 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_local()
     log_->printf(hovSummary, "total number of recourse problems  %lu\n", S_);
     log_->printf(hovSummary, "total ranks %d\n", comm_size_);
   }
+  setup_batches();
+
   // initial point set to all zero, for now
   x_->setToConstant(0.0);
 
@@ -1264,10 +1500,6 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_local()
 
   hiopVector* x0 = grad_r->alloc_clone();
   x0->setToZero();
-  double* x0_vec = x0->local_data();
-
-  hiopVector* grad_aux = x0->alloc_clone();
-  grad_aux->setToZero();
 
   // local recourse terms for each evaluator, defined accross all processors
   // it is only necessary if a batch of recourse indices are sent at the same time
@@ -1336,12 +1568,12 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_local()
     // set up recourse problem send/recv interface
     std::vector<ReqRecourseApprox*> rec_prob;
     for(int r = 0; r < comm_size_; r++) {
-      rec_prob.push_back(new ReqRecourseApprox(nc_));
+      rec_prob.push_back(new ReqRecourseApprox(nc_, rank_max_batch_[r]));
     }
 
     std::vector<ReqContingencyIdx*> req_cont_idx;
     for(int r = 0; r < comm_size_; r++) {
-      req_cont_idx.push_back(new ReqContingencyIdx(0));
+      req_cont_idx.push_back(new ReqContingencyIdx(rank_max_batch_[r]));
     }
 
     rval = 0.;
@@ -1352,99 +1584,12 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_local()
 
     // master rank communication
     if(my_rank_ == 0) {
-      // array for number of indices, currently the indices are in [0,S_]
-
-      std::vector<int> cont_idx(S_);
-      for(int i = 0; i < static_cast<int>(S_); i++) {
-        cont_idx[i] = i;
-      }
-      // The number of contigencies/recourse problems should be larger than the number of processors
-      assert(static_cast<int>(S_) >= comm_size_ - 1);
-      // idx is the next contingency to be sent out from the master
-      int idx = 0;
-      // Initilize the recourse communication by sending indices to the evaluator
-      // Using Blocking send here
-      for(int r = 1; r < comm_size_; r++) {
-        int cur_idx = cont_idx[idx];
-        int ierr = MPI_Send(&cur_idx, 1, MPI_INT, r, 1, comm_world_);
-        assert(MPI_SUCCESS == ierr);
-        // log_->printf(hovIteration, "rank %d to get contingency index  %d\n", r, cur_idx); //verbosity level 10
-        idx += 1;
-      }
-      // Posting initial receive of recourse solutions from evaluators
-      for(int r = 1; r < comm_size_; r++) {
-        // rec_prob[r]->post_recv(2,r,comm_world_);// 2 is the tag, r is the rank source
-        rec_prob[r]->post_recv_end_signal(2, r, comm_world_);  // 2 is the tag, r is the rank source
-      }
-      // Both finish_flag and last_loop are used to deal with the final round remaining contingencies/recourse problems.
-      // Some ranks are finished while others are not. The loop needs to continue to fetch the results.
-      // hiopVectorInt* finish_flag = LinearAlgebraFactory::createVectorInt(comm_size_);
-      // finish_flag->setToZero();
-      std::vector<int> finish_flag(comm_size_);  // standard vector will be replaced by hiopVectorInt
-      for(int i = 0; i < comm_size_; i++) {
-        finish_flag[i] = 0;
-      }
-      int last_loop = 0;
-      // log_->printf(hovIteration, "total idx %d\n", S_);
       t2 = MPI_Wtime();
-
       log_->printf(hovFcnEval, "Elapsed time for entire iteration %d is %f\n", it, t2 - t1);
 
-      while(idx <= static_cast<int>(S_) || last_loop) {
-        for(int r = 1; r < comm_size_; r++) {
-          int mpi_test_flag = rec_prob[r]->test();
-          if(mpi_test_flag && (finish_flag[r] == 0)) {  // receive completed
-            if(!last_loop && idx < static_cast<int>(S_)) {
-              log_->printf(hovLinesearch, "idx %d sent to rank %d\n", idx, r);
-            } else {
-              log_->printf(hovLinesearch, "last loop for rank %d\n", r);
-            }
-
-            // no need to add to the master rank variables
-            /*
-            rval += rec_prob[r]->value();
-            for(int i=0;i<nc_;i++) {
-              grad_r_vec[i] += rec_prob[r]->grad(i);
-            }
-            */
-
-            if(last_loop) {
-              finish_flag[r] = 1;
-            }
-            // this is for dealing with the end of contingencies where some ranks have already finished
-            if(idx < static_cast<int>(S_)) {
-              req_cont_idx[r]->wait();  // Ensure previous send has completed.
-              req_cont_idx[r]->set_idx(cont_idx[idx]);
-              req_cont_idx[r]->post_send(1, r, comm_world_);
-
-              rec_prob[r]->post_recv_end_signal(2, r, comm_world_);  // 2 is the tag, r is the rank source
-              // rec_prob[r]->post_recv(2,r,comm_world_);// 2 is the tag, r is the rank source
-              // log_->printf(hovFcnEval, "recourse value: is %18.12e)\n", rec_prob[r]->value());
-            } else {
-              finish_flag[r] = 1;
-              last_loop = 1;
-            }
-            idx += 1;
-          }
-        }
-
-        // Current way of ending the loop while accounting for all the last round of results
-        if(last_loop) {
-          last_loop = 0;
-          for(int r = 1; r < comm_size_; r++) {
-            if(finish_flag[r] == 0) {
-              last_loop = 1;
-            }
-          }
-        }
-      }
-      // rval /= S_;
-      // grad_r->scale(1.0/S_);
-      //  send end signal to all evaluators
-      for(int r = 1; r < comm_size_; r++) {
-        req_cont_idx[r]->wait();  // Ensure previous send has completed.
-        req_cont_idx[r]->set_idx(-1);
-        req_cont_idx[r]->post_send(1, r, comm_world_);
+      if(!dispatch_rterms(rec_prob, req_cont_idx, true, rval, *grad_r)) {
+        solver_status_ = Error_In_User_Function;
+        end_signal = 1;
       }
       t2 = MPI_Wtime();
       log_->printf(hovFcnEval, "Elapsed time for entire iteration %d is %f\n", it, t2 - t1);
@@ -1452,135 +1597,14 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_local()
 
     // evaluators
     if(my_rank_ != 0) {
-      /* old sychronous implementation of contingencies
-       * int cpr = S_/(comm_size_-1); //contingency per rank
-       * int cr = S_%(comm_size_-1); //contingency remained
-       * log_->printf(hovIteration, "my rank start evaluating work %d)\n", my_rank_);
-       */
-      std::vector<int> cont_idx(1);  // currently sending/receiving one contingency index at a time
-      int cont_i = 0;
-      cont_idx[0] = 0;
-      // Receive the index of the contingency to evaluate
-      int mpi_test_flag = 0;
-      int ierr = MPI_Recv(&cont_i, 1, MPI_INT, rank_master, 1, comm_world_, &status_);
-      assert(MPI_SUCCESS == ierr);
-      cont_idx[0] = cont_i;
-      // log_->printf(hovIteration, "contingency index %d, rank %d)\n", cont_idx[0],my_rank_);
-      // compute the recourse function values and gradients
-
-      // accumulate locally so cannot set to zero
-      // rec_val = 0.;
-      // grad_acc->setToZero();
-
-      double aux = 0.;
-
       if(nc_ < n_) {
         x0->copy_from_indexes(*x_, *xc_idx_);
       } else {
         assert(nc_ == n_);
         x0->copyFromStarting(0, *x_);
       }
-      for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-        aux = 0.;
-        int idx_temp = cont_idx[ri];
-
-        bret = master_prob_->eval_f_rterm(idx_temp, nc_, x0_vec, aux);  // solving the recourse problem
-        if(!bret) {
-          // TODO
-        }
-        // rec_val += aux;
-        rval += aux;
-      }
-
-      // log_->printf(hovFcnEval, "recourse value: is %18.12e)\n", rec_val);
-      grad_aux->setToZero();
-
-      for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-        int idx_temp = cont_idx[ri];
-        bret = master_prob_->eval_grad_rterm(idx_temp, nc_, x0_vec, *grad_aux);
-        if(!bret) {
-          // TODO
-        }
-        // grad_acc->axpy(1.0, *grad_aux);
-        grad_r->axpy(1.0, *grad_aux);
-      }
-
-      // no need to set values for rec_prob anymore
-      // rec_prob[my_rank_]->set_value(rec_val);
-      // rec_prob[my_rank_]->set_grad(grad_acc_vec);
-
-      // rec_prob[my_rank_]->post_send(2, rank_master, comm_world_);
-      //  send signal that subproblem has been solved
-      rec_prob[my_rank_]->wait();  // Ensure send buffer is safe to use.
-      rec_prob[my_rank_]->post_send_end_signal(2, rank_master, comm_world_);
-
-      // request the next subproblem index
-      req_cont_idx[my_rank_]->post_recv(1, rank_master, comm_world_);
-      while(cont_idx[0] != -1) {  // loop until end signal received
-        mpi_test_flag = req_cont_idx[my_rank_]->test();
-        /* contigency starts at 0
-         * sychronous implmentation of contingencist
-         */
-        if(mpi_test_flag) {
-          // log_->printf(hovIteration, "contingency index %d, rank %d)\n", cont_idx[0],my_rank_);
-          for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-            cont_idx[ri] = req_cont_idx[my_rank_]->value();
-          }
-          if(cont_idx[0] == -1) {
-            break;
-          }
-
-          // accumulate locally so cannot set to zero
-          // rec_val = 0.;
-          // grad_acc->setToZero();
-
-          double aux = 0.;
-          if(nc_ < n_) {
-            x0->copy_from_indexes(*x_, *xc_idx_);
-          } else {
-            assert(nc_ == n_);
-            x0->copyFromStarting(0, *x_);
-          }
-          for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-            aux = 0.;
-            int idx_temp = cont_idx[ri];
-
-            bret = master_prob_->eval_f_rterm(idx_temp, nc_, x0_vec, aux);  // need to add extra time here
-            if(!bret) {
-              // TODO
-            }
-            // rec_val += aux;
-            rval += aux;
-          }
-          // log_->printf(hovFcnEval, "recourse value: is %18.12e)\n", rec_val);
-          grad_aux->setToZero();
-
-          for(int ri = 0; ri < static_cast<int>(cont_idx.size()); ri++) {
-            int idx_temp = cont_idx[ri];
-            bret = master_prob_->eval_grad_rterm(idx_temp, nc_, x0_vec, *grad_aux);
-            if(!bret) {
-              // TODO
-            }
-            // grad_acc->axpy(1.0, *grad_aux);
-            grad_r->axpy(1.0, *grad_aux);
-          }
-
-          // rec_prob[my_rank_]->set_value(rec_val);
-          // rec_prob[my_rank_]->set_grad(grad_acc_vec);
-
-          // send signal that the subproblem has been solved
-          rec_prob[my_rank_]->wait();  // Ensure send buffer is safe to use.
-          rec_prob[my_rank_]->post_send_end_signal(2, rank_master, comm_world_);
-          // rec_prob[my_rank_]->post_send(2, rank_master, comm_world_);
-          //  log_->printf(hovIteration, "send recourse value flag for test %d \n", mpi_test_flag);
-
-          // post recv for new index
-          req_cont_idx[my_rank_]->post_recv(1, rank_master, comm_world_);
-          // ierr = MPI_Irecv(&cont_idx[0], 1, MPI_INT, rank_master, 1, comm_world_, &request_[0]);
-        }
-      }
-      // rval = rec_val;
-      // grad_r->copyFrom(grad_acc_vec);
+      // solve the batches of contingencies and accumulate their recourse values and gradients locally
+      evaluate_rterms(*rec_prob[my_rank_], *req_cont_idx[my_rank_], *x0, true, rval, *grad_r);
     }
 
     if(my_rank_ == 0) {
@@ -1608,7 +1632,8 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_local()
     MPI_Reduce(&rval, &rval_main, 1, MPI_DOUBLE, MPI_SUM, 0, comm_world_);              // collect recourse function value
     MPI_Reduce(grad_r_vec, grad_r_main_vec, nc_, MPI_DOUBLE, MPI_SUM, 0, comm_world_);  // collect recourse function gradient
 
-    if(my_rank_ == 0) {
+    // the master problem is not updated with the recourse terms of a failed evaluation
+    if(my_rank_ == 0 && !end_signal) {
       // std::cout<<"real rval %18.12e\n "<< rval_main<<std::endl;
       rval = rval_main;
       grad_r->copyFrom(grad_r_main_vec);
@@ -1735,7 +1760,6 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_local()
   delete grad_r_main;
   delete hess_appx;
   delete x0;
-  delete grad_aux;
   // delete grad_acc;
   delete hess_appx_2;
   delete evaluator;
@@ -1777,7 +1801,6 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_single()
   hess_appx = grad_r->alloc_clone();
 
   hiopVector* x0 = grad_r->alloc_clone();
-  double* x0_vec = x0->local_data();
 
   grad_r->setToZero();
 
@@ -1800,6 +1823,7 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_single()
   double convg_f = 1e20;
   double convg_g = 1e20;
   int accp_count = 0;
+  bool rterms_ok = true;
 
   std::string options_file_master_prob;
 
@@ -1835,26 +1859,21 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_single()
       assert(nc_ == n_);
       x0->copyFromStarting(0, *x_);
     }
-    for(int i = 0; i < static_cast<int>(S_); i++) {
-      int idx_temp = cont_idx[i];
-      double aux = 0.;
-      bret = master_prob_->eval_f_rterm(idx_temp, nc_, x0_vec, aux);  // need to add extra time here
-      if(!bret) {
-        // TODO
+    // the recourse terms are evaluated in batches of as many terms as threads
+    for(int i = 0; i < static_cast<int>(S_); i += num_threads_rterm_) {
+      const int n_batch = std::min(num_threads_rterm_, static_cast<int>(S_) - i);
+      rterms_ok = eval_rterms_batch(&cont_idx[i], n_batch, *x0, rval, *grad_r);
+      if(!rterms_ok) {
+        log_->printf(hovError,
+                     "evaluation of the recourse terms of %d contingencies (first %d) failed\n",
+                     n_batch,
+                     cont_idx[i]);
+        break;
       }
-      rval += aux;
-      // assert("for debugging" && false); //for debugging purpose
-
-      // TODO: allocate this outside the loop
-      hiopVector* grad_aux = grad_r->alloc_clone();
-      grad_aux->setToZero();
-      // double grad_aux[nc_];
-      bret = master_prob_->eval_grad_rterm(idx_temp, nc_, x0_vec, *grad_aux);
-      if(!bret) {
-        // TODO
-      }
-      grad_r->axpy(1.0, *grad_aux);
-      delete grad_aux;
+    }
+    if(!rterms_ok) {
+      solver_status_ = Error_In_User_Function;
+      break;
     }
 
     rval /= S_;
@@ -1954,7 +1973,7 @@ hiopSolveStatus hiopAlgPrimalDecomposition::run_single()
   delete x0;
   delete hess_appx_2;
   delete evaluator;
-  return Solve_Success;
+  return rterms_ok ? Solve_Success : solver_status_;
 }
 
 }  // namespace hiop
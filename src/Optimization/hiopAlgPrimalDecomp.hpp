@@ -70,6 +70,11 @@ namespace hiop
 {
 
 class hiopLogger;
+#ifdef HIOP_USE_MPI
+struct ReqRecourseApprox;
+struct ReqContingencyIdx;
+struct ContingencyQueue;
+#endif
 
 // temporary output levels, aiming to integrate with hiop verbosity
 enum MPIout
@@ -87,7 +92,8 @@ enum MPIout
  * the basecase and full problem depending whether a recourse approximation is included.
  * Available options to be set in hiop_pridec.options file:
  * mem_space, alpha_max, alpha_min, tolerance, acceptable_tolerance, acceptable_iterations,
- * max_iter, verbosity_level, print_options.
+ * max_iter, recourse_num_threads, recourse_schedule, recourse_order, recourse_warm_start, verbosity_level,
+ * print_options.
  */
 class hiopAlgPrimalDecomposition
 {
@@ -188,6 +194,9 @@ public:
   /** set the variable local_accum_ */
   void set_local_accum(const std::string local_accum);
 
+  /** set the number of threads evaluating the recourse terms on this rank; 0 means the OpenMP default */
+  void set_num_threads_rterm(const int num_threads);
+
   /** Contains information of a previous solution step including function value
    * and gradient. Used for storing the solution for the previous iteration
    * This struct is intended for internal use of hiopAlgPrimalDecomposition class only.
@@ -388,11 +397,69 @@ public:
   };
 
 private:
+  /**
+   * Evaluates the recourse terms with indices idx[0:n_idx-1] at the coupled variables x0 and adds
+   * their values to rval and their gradients to grad. The terms are evaluated concurrently by
+   * `num_threads_rterm_` threads, which requires hiopInterfacePriDecProblem::eval_f_rterm and
+   * hiopInterfacePriDecProblem::eval_grad_rterm to be thread-safe when more than one thread is used.
+   *
+   * Returns false if the evaluation of any of the terms failed.
+   */
+  bool eval_rterms_batch(const int* idx,
+                         const int n_idx,
+                         hiopVector& x0,
+                         double& rval,
+                         hiopVector& grad,
+                         double* times = nullptr);
+
 #ifdef HIOP_USE_MPI
+  /** Gathers the number of threads of the ranks and sets the largest batch size of each rank */
+  void setup_batches();
+
+  /**
+   * Takes from `queue` the next batch of contingencies to be sent to evaluator rank r: as many as the rank
+   * has threads or, with guided scheduling, enough to make up the rank's share of the remaining work.
+   */
+  void fill_batch(const int r, ContingencyQueue& queue, std::vector<int>& batch) const;
+
+  /**
+   * Master rank side of the evaluation of the recourse terms: sends the contingencies to the evaluator
+   * ranks in batches until all are solved. Unless the evaluators accumulate locally (`accum_local`), the
+   * recourse values and gradients they send back are added to rval and grad. The solve times sent by the
+   * evaluators are recorded in `cont_time_` and used to size and order the batches of the next iteration.
+   * With warm start, a contingency is sent preferably to the rank that evaluated it at the previous
+   * iteration (recorded in `cont_rank_`), which has its previous recourse solution.
+   * Returns false if an evaluator reported a failed evaluation of its recourse terms.
+   */
+  bool dispatch_rterms(std::vector<ReqRecourseApprox*>& rec_prob,
+                       std::vector<ReqContingencyIdx*>& req_cont_idx,
+                       const bool accum_local,
+                       double& rval,
+                       hiopVector& grad);
+
+  /**
+   * Evaluator rank side: solves the batches of contingencies received from the master rank until the
+   * end signal is received. With `accum_local` the recourse values and gradients are added to rval and
+   * grad, otherwise rval and grad hold the sums over a batch, which are sent to the master rank. The
+   * failure of the evaluation of a batch is sent to the master rank along with the solve times.
+   */
+  void evaluate_rterms(ReqRecourseApprox& rec_prob,
+                       ReqContingencyIdx& req_cont_idx,
+                       hiopVector& x0,
+                       const bool accum_local,
+                       double& rval,
+                       hiopVector& grad);
+
   MPI_Request* request_;
   MPI_Status status_;
   int my_rank_, comm_size_;
   int my_rank_type_;
+  /// number of threads evaluating the recourse terms on each rank
+  std::vector<int> rank_num_threads_;
+  /// total number of threads of the evaluator ranks
+  int total_num_threads_;
+  /// largest number of contingencies in a batch sent to each rank
+  std::vector<int> rank_max_batch_;
 #endif
 
   MPI_Comm comm_world_;
@@ -422,6 +489,30 @@ private:
   /// number of recourse terms
   size_t S_;
 
+  /// number of threads evaluating the recourse terms on this rank, set by option 'recourse_num_threads'
+  int num_threads_rterm_ = 1;
+
+  /// gradients of the recourse terms of a batch (one per term), used by eval_rterms_batch
+  std::vector<hiopVector*> grad_batch_;
+
+  /// sizing of the batches of contingencies sent to the evaluators, set by option 'recourse_schedule'
+  std::string schedule_ = "fixed";
+
+  /// order in which the contingencies are sent to the evaluators, set by option 'recourse_order'
+  std::string cont_order_ = "index";
+
+  /// with guided scheduling, the share of the remaining work of a rank is split in (about) this many batches
+  const double guided_factor_ = 2.;
+
+  /// solve time of each contingency at the last outer iteration (0 if not solved yet)
+  std::vector<double> cont_time_;
+
+  /// warm start of the recourse solves and rank affinity of the contingencies, set by option 'recourse_warm_start'
+  bool warm_start_ = false;
+
+  /// rank that evaluated each contingency at the last outer iteration (-1 if not evaluated yet)
+  std::vector<int> cont_rank_;
+
   /// level of output through the MPI engine
   size_t ver_ = 1;
 
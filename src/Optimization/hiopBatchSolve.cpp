@@ -0,0 +1,651 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopBatchSolve.cpp
+ *
+ * Concurrent solves of many small NLPs with the same sizes and sparsity structure.
+ *
+ */
+
+#include "hiopBatchSolve.hpp"
+#include "hiopNlpFormulation.hpp"
+#include "hiopAlgFilterIPM.hpp"
+#include "hiopLogger.hpp"
+
+#ifdef HIOP_USE_OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace hiop
+{
+
+namespace
+{
+/// Thrown by the proxy when the sparsity pattern of a problem differs from the one of the worker's KKT
+class hiopPatternMismatch : public std::runtime_error
+{
+public:
+  hiopPatternMismatch()
+      : std::runtime_error("sparsity pattern differs from the one of the previous problem")
+  {}
+};
+
+/**
+ * Forwards the calls of HiOp to the problem being solved by a worker, except for the MPI-related calls:
+ * the problems of a batch are solved on MPI_COMM_SELF and are not distributed.
+ *
+ * The proxy also fingerprints the (i,j) indexes returned by the sparse Jacobian and Hessian evaluations. When
+ * recording, the fingerprints are kept as the patterns of the worker's KKT linear system; when checking, an
+ * evaluation whose fingerprint was not recorded throws hiopPatternMismatch. The first evaluations occur in the
+ * starting procedure, before the KKT linear system kept by the solver is used.
+ */
+class hiopInterfaceMDSProxy : public hiopInterfaceMDS
+{
+public:
+  hiopInterfaceMDSProxy(hiopInterfaceMDS& prob)
+      : prob_(&prob),
+        recording_(true)
+  {}
+  virtual ~hiopInterfaceMDSProxy() {}
+
+  inline void set_problem(hiopInterfaceMDS& prob) { prob_ = &prob; }
+
+  /// The next evaluations record the patterns of the worker's KKT linear system
+  inline void record_patterns()
+  {
+    patterns_.clear();
+    recording_ = true;
+  }
+  /// The next evaluations are checked against the recorded patterns
+  inline void check_patterns() { recording_ = false; }
+
+  bool get_prob_sizes(size_type& n, size_type& m) { return prob_->get_prob_sizes(n, m); }
+  bool get_prob_info(NonlinearityType& type) { return prob_->get_prob_info(type); }
+  bool get_vars_info(const size_type& n, double* xlow, double* xupp, NonlinearityType* type)
+  {
+    return prob_->get_vars_info(n, xlow, xupp, type);
+  }
+  bool get_cons_info(const size_type& m, double* clow, double* cupp, NonlinearityType* type)
+  {
+    return prob_->get_cons_info(m, clow, cupp, type);
+  }
+  bool eval_f(const size_type& n, const double* x, bool new_x, double& obj_value)
+  {
+    return prob_->eval_f(n, x, new_x, obj_value);
+  }
+  bool eval_grad_f(const size_type& n, const double* x, bool new_x, double* gradf)
+  {
+    return prob_->eval_grad_f(n, x, new_x, gradf);
+  }
+  bool eval_cons(const size_type& n,
+                 const size_type& m,
+                 const size_type& num_cons,
+                 const index_type* idx_cons,
+                 const double* x,
+                 bool new_x,
+                 double* cons)
+  {
+    return prob_->eval_cons(n, m, num_cons, idx_cons, x, new_x, cons);
+  }
+  bool eval_cons(const size_type& n, const size_type& m, const double* x, bool new_x, double* cons)
+  {
+    return prob_->eval_cons(n, m, x, new_x, cons);
+  }
+  bool get_MPI_comm(MPI_Comm& comm_out)
+  {
+    comm_out = MPI_COMM_SELF;
+    return true;
+  }
+  bool get_vecdistrib_info(size_type, index_type*) { return false; }
+  bool get_starting_point(const size_type& n, double* x0) { return prob_->get_starting_point(n, x0); }
+  bool get_starting_point(const size_type& n,
+                          const size_type& m,
+                          double* x0,
+                          bool& duals_avail,
+                          double* z_bndL0,
+                          double* z_bndU0,
+                          double* lambda0,
+                          bool& slacks_avail,
+                          double* ineq_slack)
+  {
+    return prob_->get_starting_point(n, m, x0, duals_avail, z_bndL0, z_bndU0, lambda0, slacks_avail, ineq_slack);
+  }
+  bool get_warmstart_point(const size_type& n,
+                           const size_type& m,
+                           double* x0,
+                           double* z_bndL0,
+                           double* z_bndU0,
+                           double* lambda0,
+                           double* ineq_slack,
+                           double* vl0,
+                           double* vu0)
+  {
+    return prob_->get_warmstart_point(n, m, x0, z_bndL0, z_bndU0, lambda0, ineq_slack, vl0, vu0);
+  }
+  void solution_callback(hiopSolveStatus status,
+                         size_type n,
+                         const double* x,
+                         const double* z_L,
+                         const double* z_U,
+                         size_type m,
+                         const double* g,
+                         const double* lambda,
+                         double obj_value)
+  {
+    prob_->solution_callback(status, n, x, z_L, z_U, m, g, lambda, obj_value);
+  }
+  bool iterate_callback(int iter,
+                        double obj_value,
+                        double logbar_obj_value,
+                        int n,
+                        const double* x,
+                        const double* z_L,
+                        const double* z_U,
+                        int m_ineq,
+                        const double* s,
+                        int m,
+                        const double* g,
+                        const double* lambda,
+                        double inf_pr,
+                        double inf_du,
+                        double onenorm_pr,
+                        double mu,
+                        double alpha_du,
+                        double alpha_pr,
+                        int ls_trials)
+  {
+    return prob_->iterate_callback(iter,
+                                   obj_value,
+                                   logbar_obj_value,
+                                   n,
+                                   x,
+                                   z_L,
+                                   z_U,
+                                   m_ineq,
+                                   s,
+                                   m,
+                                   g,
+                                   lambda,
+                                   inf_pr,
+                                   inf_du,
+                                   onenorm_pr,
+                                   mu,
+                                   alpha_du,
+                                   alpha_pr,
+                                   ls_trials);
+  }
+  bool iterate_full_callback(const double* x,
+                             const double* z_L,
+                             const double* z_U,
+                             const double* yc,
+                             const double* yd,
+                             const double* s,
+                             const double* v_L,
+                             const double* v_U)
+  {
+    return prob_->iterate_full_callback(x, z_L, z_U, yc, yd, s, v_L, v_U);
+  }
+  bool force_update_x(const int n, double* x) { return prob_->force_update_x(n, x); }
+
+  bool get_sparse_dense_blocks_info(int& nx_sparse,
+                                    int& nx_dense,
+                                    int& nnz_sparse_Jaceq,
+                                    int& nnz_sparse_Jacineq,
+                                    int& nnz_sparse_Hess_Lagr_SS,
+                                    int& nnz_sparse_Hess_Lagr_SD)
+  {
+    return prob_->get_sparse_dense_blocks_info(nx_sparse,
+                                               nx_dense,
+                                               nnz_sparse_Jaceq,
+                                               nnz_sparse_Jacineq,
+                                               nnz_sparse_Hess_Lagr_SS,
+                                               nnz_sparse_Hess_Lagr_SD);
+  }
+  bool eval_Jac_cons(const size_type& n,
+                     const size_type& m,
+                     const size_type& num_cons,
+                     const index_type* idx_cons,
+                     const double* x,
+                     bool new_x,
+                     const size_type& nsparse,
+                     const size_type& ndense,
+                     const size_type& nnzJacS,
+                     index_type* iJacS,
+                     index_type* jJacS,
+                     double* MJacS,
+                     double* JacD)
+  {
+    const bool bret =
+        prob_->eval_Jac_cons(n, m, num_cons, idx_cons, x, new_x, nsparse, ndense, nnzJacS, iJacS, jJacS, MJacS, JacD);
+    if(bret) {
+      add_pattern(fingerprint(num_cons, idx_cons, nnzJacS, iJacS, jJacS));
+    }
+    return bret;
+  }
+  bool eval_Jac_cons(const size_type& n,
+                     const size_type& m,
+                     const double* x,
+                     bool new_x,
+                     const size_type& nsparse,
+                     const size_type& ndense,
+                     const size_type& nnzJacS,
+                     index_type* iJacS,
+                     index_type* jJacS,
+                     double* MJacS,
+                     double* JacD)
+  {
+    const bool bret = prob_->eval_Jac_cons(n, m, x, new_x, nsparse, ndense, nnzJacS, iJacS, jJacS, MJacS, JacD);
+    if(bret) {
+      add_pattern(fingerprint(m, nullptr, nnzJacS, iJacS, jJacS));
+    }
+    return bret;
+  }
+  bool eval_Hess_Lagr(const size_type& n,
+                      const size_type& m,
+                      const double* x,
+                      bool new_x,
+                      const double& obj_factor,
+                      const double* lambda,
+                      bool new_lambda,
+                      const size_type& nsparse,
+                      const size_type& ndense,
+                      const size_type& nnzHSS,
+                      index_type* iHSS,
+                      index_type* jHSS,
+                      double* MHSS,
+                      double* HDD,
+                      size_type& nnzHSD,
+                      index_type* iHSD,
+                      index_type* jHSD,
+                      double* MHSD)
+  {
+    const bool bret = prob_->eval_Hess_Lagr(n,
+                                            m,
+                                            x,
+                                            new_x,
+                                            obj_factor,
+                                            lambda,
+                                            new_lambda,
+                                            nsparse,
+                                            ndense,
+                                            nnzHSS,
+                                            iHSS,
+                                            jHSS,
+                                            MHSS,
+                                            HDD,
+                                            nnzHSD,
+                                            iHSD,
+                                            jHSD,
+                                            MHSD);
+    if(bret) {
+      add_pattern(fingerprint(-1, nullptr, nnzHSS, iHSS, jHSS));
+    }
+    return bret;
+  }
+
+private:
+  /// FNV-1a hash of the constraints evaluated and of the (i,j) indexes
+  static uint64_t fingerprint(size_type num_cons,
+                              const index_type* idx_cons,
+                              size_type nnz,
+                              const index_type* irow,
+                              const index_type* jcol)
+  {
+    uint64_t h = 14695981039346656037ULL;
+    auto mix = [&h](int64_t v) {
+      h ^= static_cast<uint64_t>(v);
+      h *= 1099511628211ULL;
+    };
+    mix(num_cons);
+    if(idx_cons) {
+      for(size_type k = 0; k < num_cons; ++k) {
+        mix(idx_cons[k]);
+      }
+    }
+    mix(nnz);
+    if(irow && jcol) {
+      for(size_type k = 0; k < nnz; ++k) {
+        mix(irow[k]);
+        mix(jcol[k]);
+      }
+    }
+    return h;
+  }
+
+  void add_pattern(uint64_t fp)
+  {
+    if(recording_) {
+      patterns_.insert(fp);
+    } else if(patterns_.find(fp) == patterns_.end()) {
+      throw hiopPatternMismatch();
+    }
+  }
+
+private:
+  hiopInterfaceMDS* prob_;
+  /// Fingerprints of the patterns of the sparse blocks of the worker's KKT linear system
+  std::unordered_set<uint64_t> patterns_;
+  bool recording_;
+};
+}  // namespace
+
+/// NLP formulation and solver of a worker; both are kept for all the problems solved by the worker
+struct hiopBatchSolverMDS::Worker
+{
+  Worker(hiopInterfaceMDS& first_prob, const char* options_file)
+      : proxy(first_prob),
+        nlp(proxy, options_file),
+        solver(nullptr),
+        patterns_recorded(false)
+  {
+    omp_num_threads_ini = nlp.options->GetInteger("omp_num_threads");
+  }
+  ~Worker() { delete solver; }
+
+  hiopInterfaceMDSProxy proxy;
+  hiopNlpMDS nlp;
+  hiopAlgFilterIPMNewton* solver;
+  /// whether the proxy recorded the sparsity patterns of the solver's KKT linear system
+  bool patterns_recorded;
+  /// value of option 'omp_num_threads' before it is forced to 1 for concurrent solves
+  int omp_num_threads_ini;
+};
+
+void hiopBatchSolveStats::print(FILE* f, const char* msg) const
+{
+  if(msg) {
+    fprintf(f, "%s\n", msg);
+  }
+  fprintf(f,
+          "Batch of %d problems solved by %d workers in %.4f sec (setup %.4f sec): %.2f problems/sec, %d failed\n",
+          num_problems,
+          num_workers,
+          time_wall,
+          time_setup,
+          throughput,
+          num_failed);
+  fprintf(f, "Problem solve times: min %.4f sec, avg %.4f sec, max %.4f sec\n", time_min, time_avg, time_max);
+}
+
+bool hiopBatchSolverMDS::Structure::operator==(const Structure& other) const
+{
+  return n == other.n && m == other.m && nx_sparse == other.nx_sparse && nx_dense == other.nx_dense &&
+         nnz_sparse_Jaceq == other.nnz_sparse_Jaceq && nnz_sparse_Jacineq == other.nnz_sparse_Jacineq &&
+         nnz_sparse_Hess_Lagr_SS == other.nnz_sparse_Hess_Lagr_SS &&
+         nnz_sparse_Hess_Lagr_SD == other.nnz_sparse_Hess_Lagr_SD;
+}
+
+hiopBatchSolverMDS::hiopBatchSolverMDS(int num_workers, const char* options_file)
+    : num_workers_requested_(num_workers),
+      options_file_(options_file ? options_file : "")
+{
+  structure_ = Structure{-1, -1, -1, -1, -1, -1, -1, -1};
+  stats_ = hiopBatchSolveStats{0, 0, 0, 0., 0., 0., 0., 0., 0.};
+}
+
+hiopBatchSolverMDS::~hiopBatchSolverMDS() { dealloc_workers(); }
+
+void hiopBatchSolverMDS::dealloc_workers()
+{
+  for(auto* w: workers_) {
+    delete w;
+  }
+  workers_.clear();
+}
+
+void hiopBatchSolverMDS::set_numeric_option(const std::string& name, double value)
+{
+  numeric_options_.push_back(std::make_pair(name, value));
+}
+
+void hiopBatchSolverMDS::set_integer_option(const std::string& name, int value)
+{
+  integer_options_.push_back(std::make_pair(name, value));
+}
+
+void hiopBatchSolverMDS::set_string_option(const std::string& name, const std::string& value)
+{
+  string_options_.push_back(std::make_pair(name, value));
+}
+
+void hiopBatchSolverMDS::apply_options(Worker& w, int num_workers) const
+{
+  w.nlp.options->SetIntegerValue("omp_num_threads", num_workers > 1 ? 1 : w.omp_num_threads_ini);
+  for(const auto& opt: numeric_options_) {
+    w.nlp.options->SetNumericValue(opt.first.c_str(), opt.second);
+  }
+  for(const auto& opt: integer_options_) {
+    if(num_workers > 1 && opt.first == "omp_num_threads") {
+      continue;
+    }
+    w.nlp.options->SetIntegerValue(opt.first.c_str(), opt.second);
+  }
+  for(const auto& opt: string_options_) {
+    w.nlp.options->SetStringValue(opt.first.c_str(), opt.second.c_str());
+  }
+  // the workers re-solve on the KKT linear system of their previous solve
+  w.nlp.options->SetStringValue("keep_kkt", "yes");
+}
+
+bool hiopBatchSolverMDS::get_structure(hiopInterfaceMDS& prob, Structure& s)
+{
+  return prob.get_prob_sizes(s.n, s.m) && prob.get_sparse_dense_blocks_info(s.nx_sparse,
+                                                                             s.nx_dense,
+                                                                             s.nnz_sparse_Jaceq,
+                                                                             s.nnz_sparse_Jacineq,
+                                                                             s.nnz_sparse_Hess_Lagr_SS,
+                                                                             s.nnz_sparse_Hess_Lagr_SD);
+}
+
+int hiopBatchSolverMDS::setup_workers(const Structure& s, hiopInterfaceMDS& first_prob, int num_problems)
+{
+  if(!(s == structure_)) {
+    dealloc_workers();
+    structure_ = s;
+  }
+
+#ifdef HIOP_USE_OPENMP
+  int num_workers = num_workers_requested_ > 0 ? num_workers_requested_ : omp_get_max_threads();
+#else
+  int num_workers = 1;
+#endif
+  num_workers = std::max(1, std::min(num_workers, num_problems));
+
+  const char* options_file = options_file_.empty() ? nullptr : options_file_.c_str();
+  if(workers_.empty()) {
+    // also initializes MPI if needed (see hiopNlpFormulation)
+    workers_.push_back(new Worker(first_prob, options_file));
+  }
+#ifdef HIOP_USE_MPI
+  if(num_workers > 1) {
+    int provided = MPI_THREAD_SINGLE;
+    [[maybe_unused]] int ierr = MPI_Query_thread(&provided);
+    assert(MPI_SUCCESS == ierr);
+    if(provided < MPI_THREAD_MULTIPLE) {
+      workers_[0]->nlp.log->printf(hovWarning,
+                                   "Batch solve: MPI does not support MPI_THREAD_MULTIPLE; the %d problems will be "
+                                   "solved by one worker instead of %d.\n",
+                                   num_problems,
+                                   num_workers);
+      num_workers = 1;
+    }
+  }
+#endif
+  while(static_cast<int>(workers_.size()) < num_workers) {
+    workers_.push_back(new Worker(first_prob, options_file));
+  }
+
+  // the solvers are created after the options are set since their constructors read them
+  for(int w = 0; w < num_workers; ++w) {
+    apply_options(*workers_[w], num_workers);
+    if(nullptr == workers_[w]->solver) {
+      workers_[w]->solver = new hiopAlgFilterIPMNewton(&workers_[w]->nlp);
+    }
+  }
+  return num_workers;
+}
+
+bool hiopBatchSolverMDS::solve(const std::vector<hiopInterfaceMDS*>& problems)
+{
+  const auto t_start = std::chrono::steady_clock::now();
+  const int num_problems = static_cast<int>(problems.size());
+
+  results_.assign(num_problems, hiopBatchSolveResult{NlpSolve_SolveNotCalled, 0., 0, 0., -1});
+  stats_ = hiopBatchSolveStats{num_problems, 0, 0, 0., 0., 0., 0., 0., 0.};
+  if(0 == num_problems) {
+    return true;
+  }
+
+  //
+  // the structure of the batch is the one of the first problem; the problems with a different structure
+  // are not solved
+  //
+  Structure s;
+  if(!get_structure(*problems[0], s)) {
+    for(auto& res: results_) {
+      res.status = Invalid_Problem_Definition;
+    }
+    stats_.num_failed = num_problems;
+    return false;
+  }
+  std::vector<char> valid(num_problems, 1);
+  for(int k = 1; k < num_problems; ++k) {
+    Structure sk;
+    if(!get_structure(*problems[k], sk) || !(sk == s)) {
+      valid[k] = 0;
+      results_[k].status = Invalid_Problem_Definition;
+    }
+  }
+
+  const int num_workers = setup_workers(s, *problems[0], num_problems);
+  stats_.num_workers = num_workers;
+  stats_.time_setup = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+
+  // the problems can take very different times to solve, hence the dynamic schedule
+#ifdef HIOP_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_workers) if(num_workers > 1)
+#endif
+  for(int k = 0; k < num_problems; ++k) {
+    if(!valid[k]) {
+      continue;
+    }
+#ifdef HIOP_USE_OPENMP
+    const int wid = omp_get_thread_num();
+#else
+    const int wid = 0;
+#endif
+    Worker& w = *workers_[wid];
+    hiopBatchSolveResult& res = results_[k];
+    res.worker = wid;
+
+    const auto t_prob_start = std::chrono::steady_clock::now();
+    try {
+      w.proxy.set_problem(*problems[k]);
+      // the bounds and constraints info are re-queried from the new problem; the iterates, derivatives,
+      // and KKT linear system of the worker's previous solve are reused when the sparsity patterns match
+      bool solved = false;
+      if(w.patterns_recorded) {
+        w.proxy.check_patterns();
+        try {
+          res.status = w.solver->resolve();
+          solved = true;
+        } catch(const hiopPatternMismatch& exp) {
+          w.nlp.log->printf(hovWarning, "Batch solve: problem %d is solved from scratch: %s\n", k, exp.what());
+          // the derivative matrices and the KKT linear system cache the patterns, hence a new solver
+          delete w.solver;
+          w.solver = new hiopAlgFilterIPMNewton(&w.nlp);
+        }
+      }
+      if(!solved) {
+        w.patterns_recorded = false;
+        w.proxy.record_patterns();
+        res.status = w.solver->resolve();
+        w.patterns_recorded = true;
+      }
+      res.objective = w.solver->getObjective();
+      res.num_iterations = w.solver->getNumIterations();
+    } catch(const std::exception& exp) {
+      w.nlp.log->printf(hovError, "Batch solve: exception in solving problem %d: %s\n", k, exp.what());
+      res.status = Exception_Unrecoverable;
+    }
+    res.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_prob_start).count();
+  }
+
+  //
+  // aggregate statistics
+  //
+  stats_.time_wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+  // the solve times are of the problems solved with a (partial) success status
+  int num_solved = 0;
+  double time_sum = 0.;
+  for(const auto& res: results_) {
+    if(res.status < 0) {
+      stats_.num_failed++;
+      continue;
+    }
+    stats_.time_min = 0 == num_solved ? res.time : std::min(stats_.time_min, res.time);
+    stats_.time_max = 0 == num_solved ? res.time : std::max(stats_.time_max, res.time);
+    time_sum += res.time;
+    num_solved++;
+  }
+  stats_.time_avg = num_solved > 0 ? time_sum / num_solved : 0.;
+  stats_.throughput = stats_.time_wall > 0. ? (num_problems - stats_.num_failed) / stats_.time_wall : 0.;
+
+  return 0 == stats_.num_failed;
+}
+
+}  // namespace hiop
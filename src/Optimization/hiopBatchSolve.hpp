@@ -0,0 +1,189 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopBatchSolve.hpp
+ *
+ * Concurrent solves of many small NLPs with the same sizes and sparsity structure.
+ *
+ */
+#ifndef HIOP_BATCH_SOLVE
+#define HIOP_BATCH_SOLVE
+
+#include "hiopInterface.hpp"
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hiop
+{
+
+/// Outcome of the solve of one problem of a batch
+struct hiopBatchSolveResult
+{
+  hiopSolveStatus status;
+  double objective;
+  int num_iterations;
+  /// Solve time, in seconds
+  double time;
+  /// Worker (thread) that solved the problem
+  int worker;
+};
+
+/// Aggregate statistics of a batch solve
+struct hiopBatchSolveStats
+{
+  int num_problems;
+  /// Number of problems for which the status is not a (partial) success, i.e., is negative
+  int num_failed;
+  int num_workers;
+  /// Wall-clock time of the batch, in seconds, and time spent in creating the workers (included)
+  double time_wall;
+  double time_setup;
+  /// Solved problems per second of wall-clock time
+  double throughput;
+  /// Min, average, and max of the solve times of the problems solved with a (partial) success status
+  double time_min;
+  double time_avg;
+  double time_max;
+
+  void print(FILE* f, const char* msg = nullptr) const;
+};
+
+/**
+ * @brief Solves batches of mixed dense-sparse (MDS) NLPs that have the same sizes and sparsity structure,
+ * e.g., the scenarios of a stochastic program, concurrently on the threads of the (MPI) rank.
+ *
+ * @details
+ * Each worker owns one NLP formulation object (hiopNlpMDS) and one Newton IPM solver, which are created
+ * once and then reused (see hiopAlgFilterIPMNewton::resolve) for all the problems the worker solves, in the
+ * current and subsequent batches. The structure (sizes and nonzeros of the sparse blocks) is queried once
+ * from the first problem; a problem with a different structure is not solved and its status is
+ * Invalid_Problem_Definition. A problem with the same structure but with different (i,j) indexes of the sparse
+ * Jacobian or Hessian than the worker's previous problem is detected at its first evaluations and solved by a
+ * new solver of the worker. The bounds, constraints info, starting point, and derivatives are obtained from
+ * each problem through the usual hiopInterfaceMDS calls; the optimal solution is passed to each problem's
+ * `solution_callback`.
+ *
+ * The problems are distributed dynamically over the workers, one OpenMP thread per worker. The workers'
+ * host linear algebra kernels are sequential (option 'omp_num_threads' is set to 1) when there is more than
+ * one worker. Each problem is solved on MPI_COMM_SELF: the problems' `get_MPI_comm` and
+ * `get_vecdistrib_info` are not called. Since HiOp performs (trivial) reductions on this communicator,
+ * MPI needs to be initialized with MPI_THREAD_MULTIPLE for more than one worker to be used.
+ *
+ * The methods of the problems (hiopInterfaceMDS) are called concurrently for different problems, so the
+ * problem objects should not share mutable state. The options of the solvers are read from `options_file`
+ * and can be changed with the set_xxx_option methods before calling `solve`.
+ */
+class hiopBatchSolverMDS
+{
+public:
+  /**
+   * @param num_workers the number of workers/threads; 0 uses the OpenMP default. It is 1 when HiOp is built
+   * without OpenMP.
+   * @param options_file the options file of the workers' NLPs (default hiop.options)
+   */
+  hiopBatchSolverMDS(int num_workers = 0, const char* options_file = nullptr);
+  virtual ~hiopBatchSolverMDS();
+
+  /// Sets an option of the workers' solvers (applied at the next `solve`)
+  void set_numeric_option(const std::string& name, double value);
+  void set_integer_option(const std::string& name, int value);
+  void set_string_option(const std::string& name, const std::string& value);
+
+  /**
+   * Solves the problems concurrently. Returns true when all the problems were solved with a (partial)
+   * success status, see `get_results` and `get_stats` for details.
+   */
+  bool solve(const std::vector<hiopInterfaceMDS*>& problems);
+
+  /// Per-problem outcome of the last `solve`, in the order of the problems
+  inline const std::vector<hiopBatchSolveResult>& get_results() const { return results_; }
+
+  /// Aggregate statistics of the last `solve`
+  inline const hiopBatchSolveStats& get_stats() const { return stats_; }
+
+private:
+  struct Worker;
+
+  /// Sizes and nonzeros of the blocks, which are the same for all the problems of a batch
+  struct Structure
+  {
+    size_type n, m;
+    int nx_sparse, nx_dense;
+    int nnz_sparse_Jaceq, nnz_sparse_Jacineq;
+    int nnz_sparse_Hess_Lagr_SS, nnz_sparse_Hess_Lagr_SD;
+    bool operator==(const Structure& other) const;
+  };
+  static bool get_structure(hiopInterfaceMDS& prob, Structure& s);
+
+  /// Creates the missing workers (recreates all if the structure changed); returns the number of workers to use
+  int setup_workers(const Structure& s, hiopInterfaceMDS& first_prob, int num_problems);
+  void dealloc_workers();
+  void apply_options(Worker& w, int num_workers) const;
+
+private:
+  int num_workers_requested_;
+  std::string options_file_;
+
+  std::vector<std::pair<std::string, double>> numeric_options_;
+  std::vector<std::pair<std::string, int>> integer_options_;
+  std::vector<std::pair<std::string, std::string>> string_options_;
+
+  /// Structure the workers were created for
+  Structure structure_;
+  std::vector<Worker*> workers_;
+
+  std::vector<hiopBatchSolveResult> results_;
+  hiopBatchSolveStats stats_;
+};
+
+}  // namespace hiop
+#endif
@@ -0,0 +1,354 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopCheckpoint.cpp
+ *
+ * Native (dependency-free) checkpoint format of HiOp and its asynchronous writer.
+ *
+ */
+#include "hiopCheckpoint.hpp"
+#include "hiopIterate.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace hiop
+{
+namespace
+{
+const char chk_magic[8] = "HIOPCHK";
+const int64_t chk_format_version = 1;
+
+/// Vectors of the iterate, in the order they are saved
+hiopVector* iterate_vec(const hiopIterate& it, int i)
+{
+  switch(i) {
+    case 0:
+      return it.get_x();
+    case 1:
+      return it.get_d();
+    case 2:
+      return it.get_sxl();
+    case 3:
+      return it.get_sxu();
+    case 4:
+      return it.get_sdl();
+    case 5:
+      return it.get_sdu();
+    case 6:
+      return it.get_yc();
+    case 7:
+      return it.get_yd();
+    case 8:
+      return it.get_zl();
+    case 9:
+      return it.get_zu();
+    case 10:
+      return it.get_vl();
+    default:
+      assert(11 == i);
+      return it.get_vu();
+  }
+}
+const char* iterate_vec_names[] = {"x", "d", "sxl", "sxu", "sdl", "sdu", "yc", "yd", "zl", "zu", "vl", "vu"};
+const int n_iterate_vecs = 12;
+
+void write_or_throw(const void* buf, size_t size, size_t count, FILE* f, const std::string& path)
+{
+  if(count > 0 && fwrite(buf, size, count, f) != count) {
+    fclose(f);
+    throw std::runtime_error("Error writing checkpoint file '" + path + "'.");
+  }
+}
+
+void read_or_throw(void* buf, size_t size, size_t count, FILE* f, const std::string& path)
+{
+  if(count > 0 && fread(buf, size, count, f) != count) {
+    fclose(f);
+    throw std::runtime_error("Error reading checkpoint file '" + path + "': unexpected end of file.");
+  }
+}
+}  // namespace
+
+void hiopCheckpointSnapshot::add_array(const std::string& name, const double* arr, const size_type& size)
+{
+  if(n_arrays_ == arrays_.size()) {
+    names_.emplace_back();
+    arrays_.emplace_back();
+  }
+  names_[n_arrays_] = name;
+  arrays_[n_arrays_].assign(arr, arr + size);
+  n_arrays_++;
+}
+
+void hiopCheckpointSnapshot::add_vec(const std::string& name, const hiopVector& vec)
+{
+  add_array(name, vec.local_data_host_const(), vec.get_local_size());
+}
+
+void hiopCheckpointSnapshot::add_iterate(const std::string& prefix, const hiopIterate& it)
+{
+  for(int i = 0; i < n_iterate_vecs; ++i) {
+    add_vec(prefix + iterate_vec_names[i], *iterate_vec(it, i));
+  }
+}
+
+const std::vector<double>& hiopCheckpointSnapshot::get_array(const std::string& name) const
+{
+  for(size_t i = 0; i < n_arrays_; ++i) {
+    if(names_[i] == name) {
+      return arrays_[i];
+    }
+  }
+  throw std::runtime_error("Checkpoint does not contain the array '" + name + "'.");
+}
+
+void hiopCheckpointSnapshot::copy_array(const std::string& name, double* arr_dest, const size_type& size) const
+{
+  const std::vector<double>& arr = get_array(name);
+  if(arr.size() != static_cast<size_t>(size)) {
+    std::stringstream ss;
+    ss << "Size mismatch between HiOp state and the checkpoint array '" << name << "'. HiOp state has " << size
+       << " doubles, while the checkpoint array has " << arr.size() << " doubles.";
+    throw std::runtime_error(ss.str());
+  }
+  std::copy(arr.begin(), arr.end(), arr_dest);
+}
+
+void hiopCheckpointSnapshot::copy_vec(const std::string& name, hiopVector& vec) const
+{
+  copy_array(name, vec.local_data_host(), vec.get_local_size());
+}
+
+void hiopCheckpointSnapshot::copy_iterate(const std::string& prefix, hiopIterate& it) const
+{
+  for(int i = 0; i < n_iterate_vecs; ++i) {
+    copy_vec(prefix + iterate_vec_names[i], *iterate_vec(it, i));
+  }
+}
+
+void hiopCheckpointSnapshot::write(const std::string& path) const
+{
+  const std::string path_tmp = path + ".tmp";
+  FILE* f = fopen(path_tmp.c_str(), "wb");
+  if(nullptr == f) {
+    throw std::runtime_error("Cannot open checkpoint file '" + path_tmp + "' for writing.");
+  }
+  const int64_t header[] = {chk_format_version, nranks_, rank_, static_cast<int64_t>(n_arrays_)};
+  write_or_throw(chk_magic, 1, sizeof(chk_magic), f, path_tmp);
+  write_or_throw(header, sizeof(int64_t), 4, f, path_tmp);
+  for(size_t i = 0; i < n_arrays_; ++i) {
+    const int64_t len_name = names_[i].size();
+    const int64_t len_arr = arrays_[i].size();
+    write_or_throw(&len_name, sizeof(int64_t), 1, f, path_tmp);
+    write_or_throw(names_[i].data(), 1, len_name, f, path_tmp);
+    write_or_throw(&len_arr, sizeof(int64_t), 1, f, path_tmp);
+    write_or_throw(arrays_[i].data(), sizeof(double), len_arr, f, path_tmp);
+  }
+  if(0 != fclose(f)) {
+    throw std::runtime_error("Error writing checkpoint file '" + path_tmp + "'.");
+  }
+  if(0 != std::rename(path_tmp.c_str(), path.c_str())) {
+    throw std::runtime_error("Cannot rename checkpoint file '" + path_tmp + "' to '" + path + "'.");
+  }
+}
+
+void hiopCheckpointSnapshot::read(const std::string& path)
+{
+  FILE* f = fopen(path.c_str(), "rb");
+  if(nullptr == f) {
+    throw std::runtime_error("Cannot open checkpoint file '" + path + "'.");
+  }
+  char magic[sizeof(chk_magic)];
+  read_or_throw(magic, 1, sizeof(magic), f, path);
+  if(0 != memcmp(magic, chk_magic, sizeof(chk_magic))) {
+    fclose(f);
+    throw std::runtime_error("File '" + path + "' is not a HiOp checkpoint.");
+  }
+  int64_t header[4];
+  read_or_throw(header, sizeof(int64_t), 4, f, path);
+  if(header[0] != chk_format_version) {
+    fclose(f);
+    std::stringstream ss;
+    ss << "Checkpoint file '" << path << "' has format version " << header[0] << ", while version "
+       << chk_format_version << " is expected.";
+    throw std::runtime_error(ss.str());
+  }
+  nranks_ = static_cast<int>(header[1]);
+  rank_ = static_cast<int>(header[2]);
+  const int64_t n_arrays = header[3];
+
+  clear();
+  for(int64_t i = 0; i < n_arrays; ++i) {
+    int64_t len_name, len_arr;
+    read_or_throw(&len_name, sizeof(int64_t), 1, f, path);
+    if(len_name < 0 || len_name > 4096) {
+      fclose(f);
+      throw std::runtime_error("Checkpoint file '" + path + "' is corrupted.");
+    }
+    std::string name(len_name, ' ');
+    read_or_throw(&name[0], 1, len_name, f, path);
+    read_or_throw(&len_arr, sizeof(int64_t), 1, f, path);
+    if(len_arr < 0) {
+      fclose(f);
+      throw std::runtime_error("Checkpoint file '" + path + "' is corrupted.");
+    }
+    if(n_arrays_ == arrays_.size()) {
+      names_.emplace_back();
+      arrays_.emplace_back();
+    }
+    names_[n_arrays_] = name;
+    arrays_[n_arrays_].resize(len_arr);
+    read_or_throw(arrays_[n_arrays_].data(), sizeof(double), len_arr, f, path);
+    n_arrays_++;
+  }
+  fclose(f);
+}
+
+std::string hiopCheckpointSnapshot::rank_file_name(const std::string& path, int rank, int nranks)
+{
+  if(nranks <= 1) {
+    return path;
+  }
+  return path + "." + std::to_string(rank);
+}
+
+hiopCheckpointWriter::hiopCheckpointWriter()
+    : fill_idx_(0),
+      pending_idx_(-1),
+      writing_idx_(-1),
+      stop_(false)
+{}
+
+hiopCheckpointWriter::~hiopCheckpointWriter()
+{
+  if(thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+  }
+}
+
+hiopCheckpointSnapshot& hiopCheckpointWriter::acquire()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return writing_idx_ != fill_idx_; });
+  return snapshots_[fill_idx_];
+}
+
+void hiopCheckpointWriter::submit(const std::string& path)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    assert(writing_idx_ != fill_idx_);
+    paths_[fill_idx_] = path;
+    pending_idx_ = fill_idx_;
+    fill_idx_ = 1 - fill_idx_;
+    if(!thread_.joinable()) {
+      thread_ = std::thread(&hiopCheckpointWriter::thread_loop, this);
+    }
+  }
+  cv_.notify_all();
+}
+
+bool hiopCheckpointWriter::wait(std::string& errors)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return pending_idx_ < 0 && writing_idx_ < 0; });
+  }
+  return check_errors(errors);
+}
+
+bool hiopCheckpointWriter::check_errors(std::string& errors)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  errors.swap(errors_);
+  errors_.clear();
+  return errors.empty();
+}
+
+void hiopCheckpointWriter::thread_loop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while(true) {
+    cv_.wait(lock, [this] { return pending_idx_ >= 0 || stop_; });
+    if(pending_idx_ < 0) {
+      // stop requested and nothing left to write
+      break;
+    }
+    const int idx = pending_idx_;
+    writing_idx_ = idx;
+    pending_idx_ = -1;
+    lock.unlock();
+
+    std::string error;
+    try {
+      snapshots_[idx].write(paths_[idx]);
+    } catch(const std::exception& exp) {
+      error = exp.what();
+    }
+
+    lock.lock();
+    if(!error.empty()) {
+      errors_ += error + "\n";
+    }
+    writing_idx_ = -1;
+    cv_.notify_all();
+  }
+}
+
+}  // namespace hiop
@@ -0,0 +1,219 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopCheckpoint.hpp
+ *
+ * Native (dependency-free) checkpoint format of HiOp and its asynchronous writer.
+ *
+ */
+#ifndef HIOP_CHECKPOINT
+#define HIOP_CHECKPOINT
+
+#include "hiopVector.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hiop
+{
+class hiopIterate;
+
+/**
+ * @brief Snapshot of the state of a HiOp algorithm, stored as a list of named arrays of doubles.
+ *
+ * @details
+ * A snapshot is written to/read from a binary file with the following layout: the magic string
+ * "HIOPCHK", the format version, the number of MPI ranks and the rank of the writer, and the number
+ * of arrays (all int64), followed by, for each array, the length of the name (int64), the name,
+ * the number of elements (int64), and the elements. Numbers are in the native byte order, hence
+ * a checkpoint can be loaded only on a machine of the same architecture.
+ *
+ * Each MPI rank saves its local part of the state in its own file (see `rank_file_name`).
+ *
+ * The storage of the arrays is kept when the snapshot is cleared so that saving the state at
+ * every checkpoint does not reallocate.
+ */
+class hiopCheckpointSnapshot
+{
+public:
+  hiopCheckpointSnapshot()
+      : nranks_(1),
+        rank_(0),
+        n_arrays_(0)
+  {}
+
+  /// Removes the arrays (the memory is kept for reuse)
+  inline void clear() { n_arrays_ = 0; }
+
+  inline void set_ranks(int nranks, int rank)
+  {
+    nranks_ = nranks;
+    rank_ = rank;
+  }
+  inline int get_num_ranks() const { return nranks_; }
+  inline int get_rank() const { return rank_; }
+
+  /// Appends a copy of the array `arr` of `size` elements, under the name `name`
+  void add_array(const std::string& name, const double* arr, const size_type& size);
+
+  /// Same as add_array, but takes the local part of a hiopVector as the source
+  void add_vec(const std::string& name, const hiopVector& vec);
+
+  /// Appends the vectors of the iterate; their names are formed by appending "x", "d", "sxl", etc. to `prefix`
+  void add_iterate(const std::string& prefix, const hiopIterate& it);
+
+  /**
+   * @brief Copies the array named `name` to `arr_dest`.
+   *
+   * @exception std::runtime_error indicates the snapshot does not contain an array with this name or that
+   * the array does not have `size` elements.
+   */
+  void copy_array(const std::string& name, double* arr_dest, const size_type& size) const;
+
+  /// Same as copy_array, but copies to the local part of a hiopVector
+  void copy_vec(const std::string& name, hiopVector& vec) const;
+
+  /// Copies the vectors of the iterate saved by `add_iterate` with the same prefix
+  void copy_iterate(const std::string& prefix, hiopIterate& it) const;
+
+  /// Returns the array named `name`; throws std::runtime_error if the snapshot does not contain it
+  const std::vector<double>& get_array(const std::string& name) const;
+
+  /**
+   * @brief Writes the snapshot to the file `path`.
+   *
+   * @details The snapshot is first written to "path.tmp", which is then renamed to `path`, so that a
+   * failure (or a crash) while writing does not corrupt a previously saved checkpoint.
+   *
+   * @exception std::runtime_error indicates an IO error.
+   */
+  void write(const std::string& path) const;
+
+  /**
+   * @brief Replaces the content of the snapshot with the one read from the file `path`.
+   *
+   * @exception std::runtime_error indicates an IO error or that the file is not a HiOp checkpoint.
+   */
+  void read(const std::string& path);
+
+  /// Name of the file of the rank `rank`: `path` for serial runs and "path.rank" for runs on multiple ranks
+  static std::string rank_file_name(const std::string& path, int rank, int nranks);
+
+private:
+  int nranks_;
+  int rank_;
+  /// Number of arrays in use; `names_` and `arrays_` may contain unused (cleared) entries at the end
+  size_t n_arrays_;
+  std::vector<std::string> names_;
+  std::vector<std::vector<double>> arrays_;
+};
+
+/**
+ * @brief Writes checkpoint snapshots to files on a background thread.
+ *
+ * @details
+ * The writer owns two snapshots (double buffering): the caller fills the snapshot returned by `acquire`,
+ * while the background thread writes the other one, and hands it to the thread with `submit`, which
+ * returns immediately. The caller blocks in `acquire` only when the two snapshots are in use, that is,
+ * when the write of the previous checkpoint is still in progress. A submitted snapshot that was not
+ * yet picked up by the thread is superseded by a newer one.
+ *
+ * The thread is started at the first `submit`. The destructor writes the pending snapshot, if any,
+ * and joins the thread.
+ */
+class hiopCheckpointWriter
+{
+public:
+  hiopCheckpointWriter();
+  ~hiopCheckpointWriter();
+
+  /// Returns the snapshot to be filled by the caller; it is not in use by the background thread
+  hiopCheckpointSnapshot& acquire();
+
+  /// Queues the snapshot returned by the last `acquire` to be written to the file `path`
+  void submit(const std::string& path);
+
+  /**
+   * Blocks until the submitted snapshots are written. Returns false if any write failed since the
+   * previous call, in which case `errors` contains the description of the failures.
+   */
+  bool wait(std::string& errors);
+
+  /// Returns false and the description of the failed writes, if any, since the previous call; does not block
+  bool check_errors(std::string& errors);
+
+private:
+  void thread_loop();
+
+private:
+  hiopCheckpointSnapshot snapshots_[2];
+  std::string paths_[2];
+  /// Index of the snapshot filled by the caller
+  int fill_idx_;
+  /// Index of the snapshot submitted and not yet picked up by the thread, or -1
+  int pending_idx_;
+  /// Index of the snapshot being written by the thread, or -1
+  int writing_idx_;
+  bool stop_;
+  std::string errors_;
+
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+private:
+  hiopCheckpointWriter(const hiopCheckpointWriter&) = delete;
+  hiopCheckpointWriter& operator=(const hiopCheckpointWriter&) = delete;
+};
+
+}  // namespace hiop
+#endif
@@ -86,12 +86,7 @@ hiopFRProbSparse::hiopFRProbSparse(hiopAlgFilterIPMBase& solver_base)
   ni_st_ = pi_st_ + m_ineq_;
 
   x_ref_ = solver_base.get_it_curr()->get_x();
-
-  // build vector VR
-  DR_ = x_ref_->new_copy();
-  DR_->component_abs();
-  DR_->invert();
-  DR_->component_min(1.0);
+  DR_ = x_ref_->alloc_clone();
 
   wrk_x_ = x_ref_->alloc_clone();
   wrk_c_ = LinearAlgebraFactory::create_vector(nlp_base_->options->GetString("mem_space"), m_eq_);
@@ -120,14 +115,29 @@ hiopFRProbSparse::hiopFRProbSparse(hiopAlgFilterIPMBase& solver_base)
                                                        nnz_Jac_c_ + nnz_Jac_d_);
   Hess_cd_ = LinearAlgebraFactory::create_matrix_sym_sparse(nlp_base_->options->GetString("mem_space"), n_, nnz_Hess_Lag_);
 
+  rho_ = 1000;  // FIXME: make this as an user option
+
+  reset_reference_point();
+}
+
+void hiopFRProbSparse::reset_reference_point()
+{
+  // the iterates of the base solver are swapped as steps are accepted
+  x_ref_ = solver_base_.get_it_curr()->get_x();
+
+  // build vector VR
+  DR_->copyFrom(*x_ref_);
+  DR_->component_abs();
+  DR_->invert();
+  DR_->component_min(1.0);
+
   // set mu0 to be the maximun of the current barrier parameter mu and norm_inf(|c|)*/
   theta_ref_ = solver_base_.get_resid()->get_theta();  // at current point, i.e., reference point
   nrmInf_feas_ref_ = solver_base_.get_resid()->get_nrmInf_bar_feasib();
-  mu_ = solver_base.get_mu();
+  mu_ = solver_base_.get_mu();
   mu_ = std::max(mu_, nrmInf_feas_ref_);
 
   zeta_ = std::sqrt(mu_);
-  rho_ = 1000;  // FIXME: make this as an user option
 }
 
 hiopFRProbSparse::~hiopFRProbSparse()
@@ -715,12 +725,7 @@ hiopFRProbMDS::hiopFRProbMDS(hiopAlgFilterIPMBase& solver_base)
   x_de_st_ = ni_st_ + m_ineq_;
 
   x_ref_ = solver_base.get_it_curr()->get_x();
-
-  // build vector VR
-  DR_ = x_ref_->new_copy();
-  DR_->component_abs();
-  DR_->invert();
-  DR_->component_min(1.0);
+  DR_ = x_ref_->alloc_clone();
 
   wrk_x_ = x_ref_->alloc_clone();
   wrk_c_ = LinearAlgebraFactory::create_vector(nlp_base_->options->GetString("mem_space"), m_eq_);
@@ -750,14 +755,29 @@ hiopFRProbMDS::hiopFRProbMDS(hiopAlgFilterIPMBase& solver_base)
   Jac_cd_ = new hiopMatrixMDS(m_, n_sp_, n_de_, nnz_sp_Jac_c_ + nnz_sp_Jac_d_, nlp_base_->options->GetString("mem_space"));
   Hess_cd_ = new hiopMatrixSymBlockDiagMDS(n_sp_, n_de_, nnz_sp_Hess_Lagr_SS_, nlp_base_->options->GetString("mem_space"));
 
+  rho_ = 1000;  // FIXME: make this as an user option
+
+  reset_reference_point();
+}
+
+void hiopFRProbMDS::reset_reference_point()
+{
+  // the iterates of the base solver are swapped as steps are accepted
+  x_ref_ = solver_base_.get_it_curr()->get_x();
+
+  // build vector VR
+  DR_->copyFrom(*x_ref_);
+  DR_->component_abs();
+  DR_->invert();
+  DR_->component_min(1.0);
+
   // set mu0 to be the maximun of the current barrier parameter mu and norm_inf(|c|)*/
   theta_ref_ = solver_base_.get_resid()->get_theta();  // at current point, i.e., reference point
   nrmInf_feas_ref_ = solver_base_.get_resid()->get_nrmInf_bar_feasib();
-  mu_ = solver_base.get_mu();
+  mu_ = solver_base_.get_mu();
   mu_ = std::max(mu_, nrmInf_feas_ref_);
 
   zeta_ = std::sqrt(mu_);
-  rho_ = 1000;  // FIXME: make this as an user option
 }
 
 hiopFRProbMDS::~hiopFRProbMDS()
@@ -1408,12 +1428,7 @@ hiopFRProbDense::hiopFRProbDense(hiopAlgFilterIPMBase& solver_base)
   ni_st_ = pi_st_ + m_ineq_;
 
   x_ref_ = solver_base.get_it_curr()->get_x();
-
-  // build vector VR
-  DR_ = x_ref_->new_copy();
-  DR_->component_abs();
-  DR_->invert();
-  DR_->component_min(1.0);
+  DR_ = x_ref_->alloc_clone();
 
   comm_ = MPI_COMM_WORLD;
   comm_size_ = 1;
@@ -1459,14 +1474,29 @@ hiopFRProbDense::hiopFRProbDense(hiopAlgFilterIPMBase& solver_base)
   last_x_ = x_ref_->alloc_clone();
   last_d_ = wrk_d_->alloc_clone();
 
+  rho_ = 1000;  // FIXME: make this as an user option
+
+  reset_reference_point();
+}
+
+void hiopFRProbDense::reset_reference_point()
+{
+  // the iterates of the base solver are swapped as steps are accepted
+  x_ref_ = solver_base_.get_it_curr()->get_x();
+
+  // build vector VR
+  DR_->copyFrom(*x_ref_);
+  DR_->component_abs();
+  DR_->invert();
+  DR_->component_min(1.0);
+
   // set mu0 to be the maximun of the current barrier parameter mu and norm_inf(|c|)*/
   theta_ref_ = solver_base_.get_resid()->get_theta();  // at current point, i.e., reference point
   nrmInf_feas_ref_ = solver_base_.get_resid()->get_nrmInf_bar_feasib();
-  mu_ = solver_base.get_mu();
+  mu_ = solver_base_.get_mu();
   mu_ = std::max(mu_, nrmInf_feas_ref_);
 
   zeta_ = std::sqrt(mu_);
-  rho_ = 1000;  // FIXME: make this as an user option
 }
 
 hiopFRProbDense::~hiopFRProbDense()
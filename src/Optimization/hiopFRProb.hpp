@@ -69,6 +69,23 @@
 namespace hiop
 {
 
+/**
+ * Methods common to the feasibility restoration problems. A restoration problem is created by the
+ * base solver on the first restoration phase of a solve and is reused by the following phases:
+ * `reset_reference_point` updates it with the current iterate of the base solver before each phase.
+ */
+class hiopFRProb
+{
+public:
+  virtual ~hiopFRProb() {}
+
+  /// @brief Sets the reference point, the scaling, mu, and zeta from the current iterate of the base solver
+  virtual void reset_reference_point() = 0;
+
+  virtual const hiopVector& get_fr_sol_x() const = 0;
+  virtual const hiopVector& get_fr_sol_d() const = 0;
+};
+
 /** Specialized interface for feasibility restoration problem with sparse blocks in the Jacobian and Hessian.
  *
  * More specifically, this interface is for specifying optimization problem:
@@ -84,7 +101,7 @@ namespace hiop
  * abstraction layer that HiOp uses and via linear solver.
  *
  */
-class hiopFRProbSparse : public hiopInterfaceSparse
+class hiopFRProbSparse : public hiopInterfaceSparse, public hiopFRProb
 {
 public:
   hiopFRProbSparse(hiopAlgFilterIPMBase& solver_base);
@@ -170,6 +187,8 @@ public:
 
   virtual bool force_update_x(const int n, double* x);
 
+  virtual void reset_reference_point();
+
   virtual const hiopVector& get_fr_sol_x() const { return *last_x_; }
   virtual const hiopVector& get_fr_sol_d() const { return *last_d_; }
 
@@ -229,7 +248,7 @@ private:
  * such that Jacobian w.r.t. x and Hessian of the Lagrangian w.r.t. x are MDS
  *
  */
-class hiopFRProbMDS : public hiopInterfaceMDS
+class hiopFRProbMDS : public hiopInterfaceMDS, public hiopFRProb
 {
 public:
   hiopFRProbMDS(hiopAlgFilterIPMBase& solver_base);
@@ -336,6 +355,8 @@ public:
 
   virtual bool force_update_x(const int n, double* x);
 
+  virtual void reset_reference_point();
+
   virtual const hiopVector& get_fr_sol_x() const { return *last_x_; }
   virtual const hiopVector& get_fr_sol_d() const { return *last_d_; }
 
@@ -410,7 +431,7 @@ private:
  * abstraction layer that HiOp uses and via linear solver.
  *
  */
-class hiopFRProbDense : public hiopInterfaceDenseConstraints
+class hiopFRProbDense : public hiopInterfaceDenseConstraints, public hiopFRProb
 {
 public:
   hiopFRProbDense(hiopAlgFilterIPMBase& solver_base);
@@ -481,6 +502,8 @@ public:
 
   virtual bool force_update_x(const int n, double* x);
 
+  virtual void reset_reference_point();
+
   virtual const hiopVector& get_fr_sol_x() const { return *last_x_; }
   virtual const hiopVector& get_fr_sol_d() const { return *last_d_; }
 
@@ -48,6 +48,8 @@
 
 #include "hiopFilter.hpp"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace hiop
@@ -55,16 +57,44 @@ namespace hiop
 
 bool hiopFilter::contains(const double& theta, const double& phi) const
 {
-  list<FilterEntry>::const_iterator it = entries.begin();
-  bool bFound = false;
-  while(it != entries.end()) {
-    if(theta >= it->theta && phi >= it->phi) {
-      bFound = true;
-      break;
-    }
-    ++it;
+  // first entry with theta strictly larger than 'theta'; the entries before it have theta <= 'theta' and the
+  // smallest phi among them is the one of the last entry
+  auto it = upper_bound(entries.begin(), entries.end(), theta, [](const double& t, const FilterEntry& fe) {
+    return t < fe.theta;
+  });
+  if(it == entries.begin()) {
+    return false;
+  }
+  --it;
+  return phi >= it->phi;
+}
+
+void hiopFilter::add(const double& theta, const double& phi)
+{
+  if(contains(theta, phi)) {
+    // the entries already in the filter dominate the new pair
+    return;
+  }
+  // the entries dominated by the new pair have theta >= 'theta' and phi >= 'phi'; since phi decreases as theta
+  // increases, these are contiguous and start at the first entry with theta >= 'theta'
+  auto first = lower_bound(entries.begin(), entries.end(), theta, [](const FilterEntry& fe, const double& t) {
+    return fe.theta < t;
+  });
+  auto last = first;
+  while(last != entries.end() && last->phi >= phi) {
+    ++last;
+  }
+  if(first != last) {
+    *first = FilterEntry(theta, phi);
+    entries.erase(first + 1, last);
+  } else {
+    entries.insert(first, FilterEntry(theta, phi));
+  }
+#ifdef HIOP_DEEPCHECKS
+  for(size_t i = 1; i < entries.size(); ++i) {
+    assert(entries[i - 1].theta < entries[i].theta && entries[i - 1].phi > entries[i].phi && "filter is not a Pareto front");
   }
-  return bFound;
+#endif
 }
 
 void hiopFilter::print(FILE* file, const char* msg) const
@@ -50,12 +50,20 @@
 #define HIOP_FILTER
 
 #include <cstdio>
-#include <list>
+#include <vector>
 #include <cassert>
 
 namespace hiop
 {
 
+/**
+ * Filter of (theta, phi) pairs. A pair is in the filter (i.e., is rejected) when it is dominated by one
+ * of the entries, that is, when both its theta and phi are larger than or equal to those of the entry.
+ *
+ * Only the Pareto front of the added pairs is stored, in a contiguous array sorted increasingly by theta
+ * (and, as a consequence, decreasingly by phi). Entries dominated by a new pair are pruned in `add` and
+ * `contains` is a binary search.
+ */
 class hiopFilter
 {
 public:
@@ -64,17 +72,39 @@ public:
   inline void initialize(const double& theta_max)
   {
     entries.clear();
-    entries.push_front(FilterEntry(theta_max, -1e20));
+    entries.push_back(FilterEntry(theta_max, -1e20));
   }
   inline void reinitialize(const double& theta_max) { initialize(theta_max); }
 
   inline void clear() { entries.clear(); }
 
-  // entries are pushed at the front since these are most likely to reject new iterates
-  inline void add(const double& theta, const double& phi) { entries.push_front(FilterEntry(theta, phi)); }
+  /// Adds the pair to the filter and removes the entries it dominates; no-op if the pair is already in the filter
+  void add(const double& theta, const double& phi);
 
   bool contains(const double& theta, const double& phi) const;
 
+  /// Number of (non-dominated) entries
+  inline size_t size() const { return entries.size(); }
+
+  /// Copies the entries as consecutive (theta, phi) pairs to `pairs` (used for checkpointing)
+  inline void get_entries(std::vector<double>& pairs) const
+  {
+    pairs.resize(2 * entries.size());
+    for(size_t i = 0; i < entries.size(); ++i) {
+      pairs[2 * i] = entries[i].theta;
+      pairs[2 * i + 1] = entries[i].phi;
+    }
+  }
+
+  /// Replaces the entries with the (theta, phi) pairs saved by `get_entries`
+  inline void set_entries(const std::vector<double>& pairs)
+  {
+    entries.clear();
+    for(size_t i = 0; i + 1 < pairs.size(); i += 2) {
+      entries.push_back(FilterEntry(pairs[i], pairs[i + 1]));
+    }
+  }
+
   void print(FILE* file, const char* msg) const;
 
 private:
@@ -93,7 +123,8 @@ private:
     }
 #endif
   };
-  std::list<FilterEntry> entries;
+  /// Pareto front: theta strictly increasing and phi strictly decreasing
+  std::vector<FilterEntry> entries;
 };
 
 }  // namespace hiop
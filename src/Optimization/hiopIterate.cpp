@@ -332,31 +332,23 @@ void hiopIterate::determineDualsBounds_d(const double& mu)
 bool hiopIterate::fractionToTheBdry(const hiopIterate& dir, const double& tau, double& alphaprimal, double& alphadual) const
 {
   alphaprimal = alphadual = 10.0;
-  double alpha = 0;
-  alpha = sxl->fractionToTheBdry_w_pattern_local(*dir.sxl, tau, nlp->get_ixl());
-  alphaprimal = fmin(alphaprimal, alpha);
-
-  alpha = sxu->fractionToTheBdry_w_pattern_local(*dir.sxu, tau, nlp->get_ixu());
-  alphaprimal = fmin(alphaprimal, alpha);
-
-  alpha = sdl->fractionToTheBdry_w_pattern_local(*dir.sdl, tau, nlp->get_idl());
-  alphaprimal = fmin(alphaprimal, alpha);
-
-  alpha = sdu->fractionToTheBdry_w_pattern_local(*dir.sdu, tau, nlp->get_idu());
-  alphaprimal = fmin(alphaprimal, alpha);
-
-  // for dual variables
-  alpha = zl->fractionToTheBdry_w_pattern_local(*dir.zl, tau, nlp->get_ixl());
-  alphadual = fmin(alphadual, alpha);
-
-  alpha = zu->fractionToTheBdry_w_pattern_local(*dir.zu, tau, nlp->get_ixu());
-  alphadual = fmin(alphadual, alpha);
-
-  alpha = vl->fractionToTheBdry_w_pattern_local(*dir.vl, tau, nlp->get_idl());
-  alphadual = fmin(alphadual, alpha);
-
-  alpha = vu->fractionToTheBdry_w_pattern_local(*dir.vu, tau, nlp->get_idu());
-  alphadual = fmin(alphadual, alpha);
+  // each slack and its dual share the pattern, so both step lengths are computed in one pass
+  double alpha_p, alpha_d;
+  sxl->fraction_to_the_bdry_pair_w_pattern_local(*dir.sxl, *zl, *dir.zl, tau, nlp->get_ixl(), alpha_p, alpha_d);
+  alphaprimal = fmin(alphaprimal, alpha_p);
+  alphadual = fmin(alphadual, alpha_d);
+
+  sxu->fraction_to_the_bdry_pair_w_pattern_local(*dir.sxu, *zu, *dir.zu, tau, nlp->get_ixu(), alpha_p, alpha_d);
+  alphaprimal = fmin(alphaprimal, alpha_p);
+  alphadual = fmin(alphadual, alpha_d);
+
+  sdl->fraction_to_the_bdry_pair_w_pattern_local(*dir.sdl, *vl, *dir.vl, tau, nlp->get_idl(), alpha_p, alpha_d);
+  alphaprimal = fmin(alphaprimal, alpha_p);
+  alphadual = fmin(alphadual, alpha_d);
+
+  sdu->fraction_to_the_bdry_pair_w_pattern_local(*dir.sdu, *vu, *dir.vu, tau, nlp->get_idu(), alpha_p, alpha_d);
+  alphaprimal = fmin(alphaprimal, alpha_p);
+  alphadual = fmin(alphadual, alpha_d);
 #ifdef HIOP_USE_MPI
   double aux[2] = {alphaprimal, alphadual}, aux_g[2];
   int ierr = MPI_Allreduce(aux, aux_g, 2, MPI_DOUBLE, MPI_MIN, nlp->get_comm());
@@ -373,10 +365,8 @@ bool hiopIterate::takeStep_primals(const hiopIterate& iter,
                                    const double& alphaprimal,
                                    const double& alphadual)
 {
-  x->copyFrom(*iter.x);
-  x->axpy(alphaprimal, *dir.x);
-  d->copyFrom(*iter.d);
-  d->axpy(alphaprimal, *dir.d);
+  x->copy_from_axpy(*iter.x, alphaprimal, *dir.x);
+  d->copy_from_axpy(*iter.d, alphaprimal, *dir.d);
 
   return true;
 }
@@ -386,18 +376,12 @@ bool hiopIterate::takeStep_duals(const hiopIterate& iter,
                                  const double& alphaprimal,
                                  const double& alphadual)
 {
-  yd->copyFrom(*iter.yd);
-  yd->axpy(alphaprimal, *dir.yd);
-  yc->copyFrom(*iter.yc);
-  yc->axpy(alphaprimal, *dir.yc);
-  zl->copyFrom(*iter.zl);
-  zl->axpy(alphadual, *dir.zl);
-  zu->copyFrom(*iter.zu);
-  zu->axpy(alphadual, *dir.zu);
-  vl->copyFrom(*iter.vl);
-  vl->axpy(alphadual, *dir.vl);
-  vu->copyFrom(*iter.vu);
-  vu->axpy(alphadual, *dir.vu);
+  yd->copy_from_axpy(*iter.yd, alphaprimal, *dir.yd);
+  yc->copy_from_axpy(*iter.yc, alphaprimal, *dir.yc);
+  zl->copy_from_axpy(*iter.zl, alphadual, *dir.zl);
+  zu->copy_from_axpy(*iter.zu, alphadual, *dir.zu);
+  vl->copy_from_axpy(*iter.vl, alphadual, *dir.vl);
+  vu->copy_from_axpy(*iter.vu, alphadual, *dir.vu);
 #ifdef HIOP_DEEPCHECKS
   assert(zl->matchesPattern(nlp->get_ixl()));
   assert(zu->matchesPattern(nlp->get_ixu()));
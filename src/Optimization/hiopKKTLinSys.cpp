@@ -67,7 +67,7 @@ hiopKKTLinSys::hiopKKTLinSys(hiopNlpFormulation* nlp)
       safe_mode_(true),
       kkt_opr_(nullptr),
       prec_opr_(nullptr),
-      bicgIR_(nullptr),
+      krylovIR_(nullptr),
       delta_wx_(nullptr),
       delta_wd_(nullptr),
       delta_cc_(nullptr),
@@ -82,7 +82,7 @@ hiopKKTLinSys::~hiopKKTLinSys()
 {
   delete kkt_opr_;
   delete prec_opr_;
-  delete bicgIR_;
+  delete krylovIR_;
 }
 
 // computes the solve error for the KKT Linear system; used only for correctness checking
@@ -942,7 +942,20 @@ bool hiopKKTLinSys::compute_directions_w_IR(const hiopResidual* resid, hiopItera
   if(nullptr == kkt_opr_) {
     kkt_opr_ = new hiopMatVecKKTFullOpr(this, iter_);
     prec_opr_ = new hiopPrecondKKTOpr(this, iter_);
-    bicgIR_ = new hiopBiCGStabSolver(dim_rhs, kkt_opr_, prec_opr_);
+  }
+  const bool use_fgmres = "fgmres" == nlp_->options->GetString("ir_outer_solver");
+  hiopFGMRESSolver* fgmresIR = dynamic_cast<hiopFGMRESSolver*>(krylovIR_);
+  if(nullptr == krylovIR_ || use_fgmres != (nullptr != fgmresIR)) {
+    delete krylovIR_;
+    if(use_fgmres) {
+      fgmresIR = new hiopFGMRESSolver(dim_rhs, kkt_opr_, prec_opr_, nullptr, nullptr, nlp_->get_comm());
+      krylovIR_ = fgmresIR;
+    } else {
+      krylovIR_ = new hiopBiCGStabSolver(dim_rhs, kkt_opr_, prec_opr_);
+    }
+  }
+  if(fgmresIR) {
+    fgmresIR->set_restart(nlp_->options->GetInteger("ir_outer_restart"));
   }
 
   // need to reset the pointer to the current iter, since the outer loop keeps swtiching between curr_iter and trial_iter
@@ -950,20 +963,20 @@ bool hiopKKTLinSys::compute_directions_w_IR(const hiopResidual* resid, hiopItera
 
   double tol =
       std::min(mu_ * nlp_->options->GetNumeric("ir_outer_tol_factor"), nlp_->options->GetNumeric("ir_outer_tol_min"));
-  bicgIR_->set_max_num_iter(nlp_->options->GetInteger("ir_outer_maxit"));
-  bicgIR_->set_tol(tol);
-  bicgIR_->set_x0(0.0);
+  krylovIR_->set_max_num_iter(nlp_->options->GetInteger("ir_outer_maxit"));
+  krylovIR_->set_tol(tol);
+  krylovIR_->set_x0(0.0);
 
-  bool bret = bicgIR_->solve(dir, resid);
+  bool bret = krylovIR_->solve(dir, resid);
 
-  nlp_->runStats.kkt.nIterRefinInner += bicgIR_->get_sol_num_iter();
+  nlp_->runStats.kkt.nIterRefinInner += krylovIR_->get_sol_num_iter();
   if(!bret) {
-    nlp_->log->printf(hovWarning, "%s", bicgIR_->get_convergence_info().c_str());
+    nlp_->log->printf(hovWarning, "%s", krylovIR_->get_convergence_info().c_str());
 
     // accept the stpe since this is IR
     bret = true;
   } else {
-    nlp_->log->printf(hovScalars, "%s", bicgIR_->get_convergence_info().c_str());
+    nlp_->log->printf(hovScalars, "%s", krylovIR_->get_convergence_info().c_str());
   }
 
   nlp_->runStats.tmSolverInternal.stop();
@@ -172,8 +172,8 @@ protected:
   /// Preconditioner operator that solves with the given (usually compressed) KKT system
   hiopPrecondKKTOpr* prec_opr_;
 
-  /// iterative refinement from BiCGStab solver
-  hiopBiCGStabSolver* bicgIR_;
+  /// Krylov solver (BiCGStab or FGMRES, see option 'ir_outer_solver') of the outer iterative refinement
+  hiopKrylovSolver* krylovIR_;
 
   friend class hiopMatVecKKTFullOpr;
   friend class hiopPrecondKKTOpr;
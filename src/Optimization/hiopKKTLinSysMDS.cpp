@@ -48,6 +48,7 @@
 
 #include "hiopKKTLinSysMDS.hpp"
 #include "hiopLinSolverSymDenseLapack.hpp"
+#include "hiopLinSolverSymDenseLDLT.hpp"
 
 #ifdef HIOP_USE_MAGMA
 #include "hiopLinSolverSymDenseMagma.hpp"
@@ -430,6 +431,16 @@ bool hiopKKTLinSysCompressedMDSXYcYd::solveCompressed(hiopVector& rx,
   return true;
 }
 
+hiopLinSolverSymDense* hiopKKTLinSysCompressedMDSXYcYd::create_cpu_dense_linsys(int n, const char* tag)
+{
+  if("lapack" == nlp_->options->GetString("linear_solver_dense")) {
+    nlp_->log->printf(hovScalars, "KKT_MDS_XYcYd linsys: Lapack for a matrix of size %d %s\n", n, tag);
+    return new hiopLinSolverSymDenseLapack(n, nlp_);
+  }
+  nlp_->log->printf(hovScalars, "KKT_MDS_XYcYd linsys: LDLT for a matrix of size %d %s\n", n, tag);
+  return new hiopLinSolverSymDenseLDLT(n, nlp_);
+}
+
 hiopLinSolverSymDense* hiopKKTLinSysCompressedMDSXYcYd::determineAndCreateLinsys(int nxd, int neq, int nineq)
 {
 #ifdef HIOP_USE_MAGMA
@@ -461,8 +472,7 @@ hiopLinSolverSymDense* hiopKKTLinSysCompressedMDSXYcYd::determineAndCreateLinsys
     int n = nxd + neq + nineq;
 
     if("cpu" == nlp_->options->GetString("compute_mode")) {
-      nlp_->log->printf(hovScalars, "KKT_MDS_XYcYd linsys: Lapack for a matrix of size %d [1]\n", n);
-      linSys_ = new hiopLinSolverSymDenseLapack(n, nlp_);
+      linSys_ = create_cpu_dense_linsys(n, "[1]");
       return dynamic_cast<hiopLinSolverSymDense*>(linSys_);
     }
 
@@ -496,13 +506,11 @@ hiopLinSolverSymDense* hiopKKTLinSysCompressedMDSXYcYd::determineAndCreateLinsys
         // p->set_fake_inertia(neq + nineq);
       }
     } else {
-      nlp_->log->printf(hovScalars, "KKT_MDS_XYcYd linsys: Lapack for a matrix of size %d [2]\n", n);
-      linSys_ = new hiopLinSolverSymDenseLapack(n, nlp_);
+      linSys_ = create_cpu_dense_linsys(n, "[2]");
       return dynamic_cast<hiopLinSolverSymDense*>(linSys_);
     }
 #else
-    nlp_->log->printf(hovScalars, "KKT_MDS_XYcYd linsys: Lapack for a matrix of size %d [3]\n", n);
-    linSys_ = new hiopLinSolverSymDenseLapack(n, nlp_);
+    linSys_ = create_cpu_dense_linsys(n, "[3]");
     return dynamic_cast<hiopLinSolverSymDense*>(linSys_);
 #endif
   }
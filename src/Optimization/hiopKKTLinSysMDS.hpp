@@ -148,6 +148,9 @@ protected:
 private:
   // placeholder for the code that decides which linear solver to used based on safe_mode_
   hiopLinSolverSymDense* determineAndCreateLinsys(int nxd, int neq, int nineq);
+
+  // creates the CPU dense solver selected by the 'linear_solver_dense' option; 'tag' is used in the log
+  hiopLinSolverSymDense* create_cpu_dense_linsys(int n, const char* tag);
 };
 
 }  // namespace hiop
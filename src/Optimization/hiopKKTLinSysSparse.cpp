@@ -81,7 +81,9 @@ hiopKKTLinSysCompressedSparseXYcYd::hiopKKTLinSysCompressedSparseXYcYd(hiopNlpFo
       Jac_cSp_(NULL),
       Jac_dSp_(NULL),
       write_linsys_counter_(-1),
-      csr_writer_(nlp)
+      csr_writer_(nlp),
+      blocks_outdated_(true),
+      diag_nnz_st_(0)
 {
   nlpSp_ = dynamic_cast<hiopNlpSparse*>(nlp_);
   assert(nlpSp_);
@@ -93,6 +95,17 @@ hiopKKTLinSysCompressedSparseXYcYd::~hiopKKTLinSysCompressedSparseXYcYd()
   delete Hx_;
 }
 
+bool hiopKKTLinSysCompressedSparseXYcYd::update(const hiopIterate* iter,
+                                                const hiopVector* grad_f,
+                                                const hiopMatrix* Jac_c,
+                                                const hiopMatrix* Jac_d,
+                                                hiopMatrix* Hess)
+{
+  // new outer iteration: Hessian and Jacobians have changed
+  blocks_outdated_ = true;
+  return hiopKKTLinSysCompressedXYcYd::update(iter, grad_f, Jac_c, Jac_d, Hess);
+}
+
 bool hiopKKTLinSysCompressedSparseXYcYd::build_kkt_matrix(const hiopPDPerturbation& pdreg)
 {
   delta_wx_ = perturb_calc_->get_curr_delta_wx();
@@ -138,16 +151,26 @@ bool hiopKKTLinSysCompressedSparseXYcYd::build_kkt_matrix(const hiopPDPerturbati
   {
     nlp_->runStats.kkt.tmUpdateLinsys.start();
 
-    Msys->setToZero();
-
-    // copy Jac and Hes to the full iterate matrix
-    size_type dest_nnz_st{0};
-    Msys->copyRowsBlockFrom(*HessSp_, 0, nx, 0, dest_nnz_st);
-    dest_nnz_st += HessSp_->numberOfNonzeros();
-    Msys->copyRowsBlockFrom(*Jac_cSp_, 0, neq, nx, dest_nnz_st);
-    dest_nnz_st += Jac_cSp_->numberOfNonzeros();
-    Msys->copyRowsBlockFrom(*Jac_dSp_, 0, nineq, nx + neq, dest_nnz_st);
-    dest_nnz_st += Jac_dSp_->numberOfNonzeros();
+    // The Hessian and Jacobian blocks change only at a new outer iteration; the inertia correction trials
+    // of an iteration only patch the diagonal entries, which are stored after the blocks (from `diag_nnz_st_`).
+    // All the nonzeros of Msys are written below, hence Msys does not need to be zeroed.
+    if(blocks_outdated_) {
+      nlp_->runStats.kkt.tmUpdateLinsysBlocks.start();
+
+      // copy Jac and Hes to the full iterate matrix
+      size_type dest_nnz_st{0};
+      Msys->copyRowsBlockFrom(*HessSp_, 0, nx, 0, dest_nnz_st);
+      dest_nnz_st += HessSp_->numberOfNonzeros();
+      Msys->copyRowsBlockFrom(*Jac_cSp_, 0, neq, nx, dest_nnz_st);
+      dest_nnz_st += Jac_cSp_->numberOfNonzeros();
+      Msys->copyRowsBlockFrom(*Jac_dSp_, 0, nineq, nx + neq, dest_nnz_st);
+      dest_nnz_st += Jac_dSp_->numberOfNonzeros();
+
+      diag_nnz_st_ = dest_nnz_st;
+      blocks_outdated_ = false;
+      nlp_->runStats.kkt.tmUpdateLinsysBlocks.stop();
+    }
+    size_type dest_nnz_st = diag_nnz_st_;
 
     // build the diagonal Hx = Dx + delta_wx
     if(NULL == Hx_) {
@@ -177,7 +200,7 @@ bool hiopKKTLinSysCompressedSparseXYcYd::build_kkt_matrix(const hiopPDPerturbati
      */
 
     // Dd = (Sdl)^{-1}Vu + (Sdu)^{-1}Vu + delta_wd * I
-    Dd_inv_->axpy(1., *delta_wd_);
+    Dd_inv_->copyFrom(*delta_wd_);
     Dd_inv_->axdzpy_w_pattern(1.0, *iter_->vl, *iter_->sdl, nlp_->get_idl());
     Dd_inv_->axdzpy_w_pattern(1.0, *iter_->vu, *iter_->sdu, nlp_->get_idu());
 
@@ -297,6 +320,8 @@ bool hiopKKTLinSysCompressedSparseXYcYd::solveCompressed(hiopVector& rx,
 hiopLinSolverSymSparse* hiopKKTLinSysCompressedSparseXYcYd::determineAndCreateLinsys(int nx, int neq, int nineq, int nnz)
 {
   if(nullptr == linSys_) {
+    // the blocks are not in the system matrix of the new linear solver
+    blocks_outdated_ = true;
     int n = nx + neq + nineq;
 
     assert(false == safe_mode_ && "KKT_SPARSE_XYcYd linsys does not support safe mode.");
@@ -432,7 +457,9 @@ hiopKKTLinSysCompressedSparseXDYcYd::hiopKKTLinSysCompressedSparseXDYcYd(hiopNlp
       Jac_cSp_{nullptr},
       Jac_dSp_{nullptr},
       write_linsys_counter_(-1),
-      csr_writer_(nlp)
+      csr_writer_(nlp),
+      blocks_outdated_(true),
+      diag_nnz_st_(0)
 {
   nlpSp_ = dynamic_cast<hiopNlpSparse*>(nlp_);
   assert(nlpSp_);
@@ -445,6 +472,17 @@ hiopKKTLinSysCompressedSparseXDYcYd::~hiopKKTLinSysCompressedSparseXDYcYd()
   delete Hd_;
 }
 
+bool hiopKKTLinSysCompressedSparseXDYcYd::update(const hiopIterate* iter,
+                                                 const hiopVector* grad_f,
+                                                 const hiopMatrix* Jac_c,
+                                                 const hiopMatrix* Jac_d,
+                                                 hiopMatrix* Hess)
+{
+  // new outer iteration: Hessian and Jacobians have changed
+  blocks_outdated_ = true;
+  return hiopKKTLinSysCompressedXDYcYd::update(iter, grad_f, Jac_c, Jac_d, Hess);
+}
+
 bool hiopKKTLinSysCompressedSparseXDYcYd::build_kkt_matrix(const hiopPDPerturbation& pdreg)
 {
   delta_wx_ = perturb_calc_->get_curr_delta_wx();
@@ -488,20 +526,30 @@ bool hiopKKTLinSysCompressedSparseXDYcYd::build_kkt_matrix(const hiopPDPerturbat
   {
     nlp_->runStats.kkt.tmUpdateLinsys.start();
 
-    Msys->setToZero();
-
-    // copy Jac and Hes to the full iterate matrix
-    size_type dest_nnz_st{0};
-    Msys->copyRowsBlockFrom(*HessSp_, 0, nx, 0, dest_nnz_st);
-    dest_nnz_st += HessSp_->numberOfNonzeros();
-    Msys->copyRowsBlockFrom(*Jac_cSp_, 0, neq, nx + nd, dest_nnz_st);
-    dest_nnz_st += Jac_cSp_->numberOfNonzeros();
-    Msys->copyRowsBlockFrom(*Jac_dSp_, 0, nineq, nx + nd + neq, dest_nnz_st);
-    dest_nnz_st += Jac_dSp_->numberOfNonzeros();
-
-    // minus identity matrix for slack variables
-    Msys->copyDiagMatrixToSubblock(-1., nx + nd + neq, nx, dest_nnz_st, nineq);
-    dest_nnz_st += nineq;
+    // The Hessian and Jacobian blocks change only at a new outer iteration; the inertia correction trials
+    // of an iteration only patch the diagonal entries, which are stored after the blocks (from `diag_nnz_st_`).
+    // All the nonzeros of Msys are written below, hence Msys does not need to be zeroed.
+    if(blocks_outdated_) {
+      nlp_->runStats.kkt.tmUpdateLinsysBlocks.start();
+
+      // copy Jac and Hes to the full iterate matrix
+      size_type dest_nnz_st{0};
+      Msys->copyRowsBlockFrom(*HessSp_, 0, nx, 0, dest_nnz_st);
+      dest_nnz_st += HessSp_->numberOfNonzeros();
+      Msys->copyRowsBlockFrom(*Jac_cSp_, 0, neq, nx + nd, dest_nnz_st);
+      dest_nnz_st += Jac_cSp_->numberOfNonzeros();
+      Msys->copyRowsBlockFrom(*Jac_dSp_, 0, nineq, nx + nd + neq, dest_nnz_st);
+      dest_nnz_st += Jac_dSp_->numberOfNonzeros();
+
+      // minus identity matrix for slack variables
+      Msys->copyDiagMatrixToSubblock(-1., nx + nd + neq, nx, dest_nnz_st, nineq);
+      dest_nnz_st += nineq;
+
+      diag_nnz_st_ = dest_nnz_st;
+      blocks_outdated_ = false;
+      nlp_->runStats.kkt.tmUpdateLinsysBlocks.stop();
+    }
+    size_type dest_nnz_st = diag_nnz_st_;
 
     // build the diagonal Hx = Dx + delta_wx
     if(NULL == Hx_) {
@@ -653,6 +701,8 @@ bool hiopKKTLinSysCompressedSparseXDYcYd::solveCompressed(hiopVector& rx,
 hiopLinSolverSymSparse* hiopKKTLinSysCompressedSparseXDYcYd::determineAndCreateLinsys(int nx, int neq, int nineq, int nnz)
 {
   if(nullptr == linSys_) {
+    // the blocks are not in the system matrix of the new linear solver
+    blocks_outdated_ = true;
     int n = nx + nineq + neq + nineq;
     auto compute_mode = nlp_->options->GetString("compute_mode");
 
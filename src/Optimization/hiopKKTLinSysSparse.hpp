@@ -77,6 +77,17 @@ public:
   hiopKKTLinSysCompressedSparseXYcYd(hiopNlpFormulation* nlp);
   virtual ~hiopKKTLinSysCompressedSparseXYcYd();
 
+  /**
+   * Marks the Hessian and Jacobian blocks of the linsys as outdated, then updates the KKT system. The
+   * blocks are copied in the first `build_kkt_matrix` that follows; inertia correction trials only patch
+   * the diagonal entries.
+   */
+  virtual bool update(const hiopIterate* iter,
+                      const hiopVector* grad_f,
+                      const hiopMatrix* Jac_c,
+                      const hiopMatrix* Jac_d,
+                      hiopMatrix* Hess);
+
   virtual bool build_kkt_matrix(const hiopPDPerturbation& pdreg);
 
   virtual bool solveCompressed(hiopVector& rx,
@@ -113,6 +124,12 @@ protected:
   int write_linsys_counter_;
   hiopCSR_IO csr_writer_;
 
+  // true when the Hessian and Jacobian blocks of the linsys need to be (re)copied, see `update` and
+  // `determineAndCreateLinsys`
+  bool blocks_outdated_;
+  // index of the first nonzero of the diagonal entries (that follow the blocks) of the linsys matrix
+  size_type diag_nnz_st_;
+
 private:
   // placeholder for the code that decides which linear solver to used based on safe_mode_
   hiopLinSolverSymSparse* determineAndCreateLinsys(int nxd, int neq, int nineq, int nnz);
@@ -139,6 +156,17 @@ public:
   hiopKKTLinSysCompressedSparseXDYcYd(hiopNlpFormulation* nlp);
   virtual ~hiopKKTLinSysCompressedSparseXDYcYd();
 
+  /**
+   * Marks the Hessian and Jacobian blocks of the linsys as outdated, then updates the KKT system. The
+   * blocks are copied in the first `build_kkt_matrix` that follows; inertia correction trials only patch
+   * the diagonal entries.
+   */
+  virtual bool update(const hiopIterate* iter,
+                      const hiopVector* grad_f,
+                      const hiopMatrix* Jac_c,
+                      const hiopMatrix* Jac_d,
+                      hiopMatrix* Hess);
+
   virtual bool build_kkt_matrix(const hiopPDPerturbation& pdreg);
 
   virtual bool solveCompressed(hiopVector& rx,
@@ -178,6 +206,12 @@ protected:
   int write_linsys_counter_;
   hiopCSR_IO csr_writer_;
 
+  // true when the Hessian and Jacobian blocks of the linsys need to be (re)copied, see `update` and
+  // `determineAndCreateLinsys`
+  bool blocks_outdated_;
+  // index of the first nonzero of the diagonal entries (that follow the blocks) of the linsys matrix
+  size_type diag_nnz_st_;
+
 private:
   // placeholder for the code that decides which linear solver to used based on safe_mode_
   hiopLinSolverSymSparse* determineAndCreateLinsys(int nxd, int neq, int nineq, int nnz);
@@ -61,6 +61,8 @@
 #include "hiopDualsUpdater.hpp"
 
 #include "hiopVectorIntSeq.hpp"
+#include "hiopMatrixSparseTriplet.hpp"
+#include "hiopOMP.hpp"
 
 #include <stdlib.h> /* exit, EXIT_FAILURE */
 #include <cassert>
@@ -81,6 +83,7 @@ hiopNlpFormulation::hiopNlpFormulation(hiopInterfaceBase& interface_, const char
 {
   strFixedVars_ = "";    // uninitialized
   dFixedVarsTol_ = -1.;  // uninitialized
+  problem_data_changed_ = false;
   bool bret;
 #ifdef HIOP_USE_MPI
   bret = interface_base.get_MPI_comm(comm_);
@@ -188,6 +191,9 @@ hiopNlpFormulation::~hiopNlpFormulation()
 
 bool hiopNlpFormulation::finalizeInitialization()
 {
+  // the number of threads of the host kernels can be changed between solves
+  omp::set_num_threads(options->GetInteger("omp_num_threads"));
+
   // check if there was a change in the user options that requires reinitialization of 'this'
   bool doinit = false;
   if(strFixedVars_ != options->GetString("fixed_var")) {
@@ -197,12 +203,16 @@ bool hiopNlpFormulation::finalizeInitialization()
   if(dFixedVarsTol_ != fixedVarTol) {
     doinit = true;
   }
+  if(problem_data_changed_) {
+    doinit = true;
+  }
 
   // more checks whether we should reinitialize go here (for example change in the rescaling option)
 
   if(!doinit) {
     return true;
   }
+  problem_data_changed_ = false;
 
   // Select memory space where to create linear algebra objects
   string mem_space = options->GetString("mem_space");
@@ -213,7 +223,10 @@ bool hiopNlpFormulation::finalizeInitialization()
   ////////////////////////////////////////////////////////////////////////////
   bool bret = interface_base.get_prob_sizes(n_vars_, n_cons_);
   assert(bret);
+  // the transformations are deleted by `clear` and will be recreated if needed
   nlp_transformations_.clear();
+  nlp_scaling_ = nullptr;
+  relax_bounds_ = nullptr;
   nlp_transformations_.setUserNlpNumVars(n_vars_);
 
   delete xl_;
@@ -674,6 +687,12 @@ bool hiopNlpFormulation::apply_scaling(hiopVector& c, hiopVector& d, hiopVector&
     return false;
   }
 
+  // the scaling of a previous run is in the transformations and the constraints bounds are scaled already;
+  // it is cleared, together with the transformations, when `finalizeInitialization` reinitializes `this`
+  if(nullptr != nlp_scaling_) {
+    return true;
+  }
+
   const double max_grad = options->GetNumeric("scaling_max_grad");
   const double max_obj_grad = options->GetNumeric("scaling_max_obj_grad");
   const double max_con_grad = options->GetNumeric("scaling_max_con_grad");
@@ -1281,10 +1300,10 @@ bool hiopNlpFormulation::user_callback_full_iterate(hiopVector& x,
     s.copy_to_vectorpar(s_host);
 
     hiopVectorPar vl_host(n_cons_ineq_, vec_distrib_, comm_);
-    v_L.copy_to_vectorpar(zl_host);
+    v_L.copy_to_vectorpar(vl_host);
 
     hiopVectorPar vu_host(n_cons_ineq_, vec_distrib_, comm_);
-    v_U.copy_to_vectorpar(zu_host);
+    v_U.copy_to_vectorpar(vu_host);
 
     bret = interface_base.iterate_full_callback(x_host.local_data_const(),
                                                 zl_host.local_data_const(),
@@ -1863,6 +1882,15 @@ bool hiopNlpMDS::finalizeInitialization()
  */
 hiopDualsLsqUpdate* hiopNlpSparse::alloc_duals_lsq_updater() { return new hiopDualsLsqUpdateLinsysAugSparse(this); }
 
+hiopMatrixSparse* hiopNlpSparse::set_compressed_spmv(hiopMatrixSparse* M) const
+{
+  auto* M_triplet = dynamic_cast<hiopMatrixSparseTriplet*>(M);
+  if(M_triplet && options->GetString("sparse_compressed_spmv") == "yes") {
+    M_triplet->set_compressed_spmv(true);
+  }
+  return M;
+}
+
 bool hiopNlpSparse::eval_Jac_c(hiopVector& x, bool new_x, hiopMatrix& Jac_c)
 {
   if((prob_type_ == hiopInterfaceBase::hiopLinear || prob_type_ == hiopInterfaceBase::hiopQuadratic) && nlp_evaluated_) {
@@ -101,6 +101,14 @@ public:
   virtual ~hiopNlpFormulation();
 
   virtual bool finalizeInitialization();
+
+  /**
+   * Marks the problem data provided by the user interface (bounds, constraints info, etc.) as changed, so that
+   * the next `finalizeInitialization` re-queries and re-processes it. The sizes and the sparsity structure of
+   * the problem should not change.
+   */
+  inline void set_problem_data_changed() { problem_data_changed_ = true; }
+
   virtual bool apply_scaling(hiopVector& c, hiopVector& d, hiopVector& gradf, hiopMatrix& Jac_c, hiopMatrix& Jac_d);
 
   /**
@@ -278,6 +286,11 @@ public:
   inline int get_rank() const { return rank_; }
   inline int get_num_ranks() const { return num_ranks_; }
   inline index_type* getVecDistInfo() { return vec_distrib_; }
+#else
+  // fake communicator (defined by hiop)
+  inline MPI_Comm get_comm() const { return MPI_COMM_SELF; }
+  inline int get_rank() const { return 0; }
+  inline int get_num_ranks() const { return 1; }
 #endif
 protected:
   /* Preprocess bounds in a form supported by the NLP formulation. Returns counts of
@@ -332,6 +345,8 @@ protected:
   // options for which this class was setup
   std::string strFixedVars_;  //"none", "fixed", "relax"
   double dFixedVarsTol_;
+  // whether the user data changed since the last initialization (see `set_problem_data_changed`)
+  bool problem_data_changed_;
 
   /**
    * @brief Internal NLP transformations that supports fixing and relaxing variables as well as
@@ -570,18 +585,16 @@ public:
 
   virtual hiopMatrix* alloc_Jac_c()
   {
-    return LinearAlgebraFactory::create_matrix_sparse(options->GetString("mem_space"),
-                                                      n_cons_eq_,
-                                                      n_vars_,
-                                                      nnz_sparse_Jaceq_);
+    return set_compressed_spmv(
+        LinearAlgebraFactory::create_matrix_sparse(options->GetString("mem_space"), n_cons_eq_, n_vars_, nnz_sparse_Jaceq_));
     // return new hiopMatrixSparseTriplet(n_cons_eq_, n_vars_, nnz_sparse_Jaceq_);
   }
   virtual hiopMatrix* alloc_Jac_d()
   {
-    return LinearAlgebraFactory::create_matrix_sparse(options->GetString("mem_space"),
-                                                      n_cons_ineq_,
-                                                      n_vars_,
-                                                      nnz_sparse_Jacineq_);
+    return set_compressed_spmv(LinearAlgebraFactory::create_matrix_sparse(options->GetString("mem_space"),
+                                                                          n_cons_ineq_,
+                                                                          n_vars_,
+                                                                          nnz_sparse_Jacineq_));
     // return new hiopMatrixSparseTriplet(n_cons_ineq_, n_vars_, nnz_sparse_Jacineq_);
   }
   virtual hiopMatrix* alloc_Jac_cons()
@@ -594,7 +607,8 @@ public:
   }
   virtual hiopMatrix* alloc_Hess_Lagr()
   {
-    return LinearAlgebraFactory::create_matrix_sym_sparse(options->GetString("mem_space"), n_vars_, nnz_sparse_Hess_Lagr_);
+    return set_compressed_spmv(
+        LinearAlgebraFactory::create_matrix_sym_sparse(options->GetString("mem_space"), n_vars_, nnz_sparse_Hess_Lagr_));
     // return new hiopMatrixSymSparseTriplet(n_vars_, nnz_sparse_Hess_Lagr_);
   }
   virtual size_type nx() const { return n_vars_; }
@@ -616,6 +630,13 @@ public:
   inline int get_nnz_Jacineq() const { return nnz_sparse_Jacineq_; }
   inline int get_nnz_Hess_Lagr() const { return nnz_sparse_Hess_Lagr_; }
 
+protected:
+  /**
+   * Enables the cached CSR/CSC index of the sparsity pattern (see hiopMatrixSparseTriplet::set_compressed_spmv)
+   * of the host triplet matrix `M` when option 'sparse_compressed_spmv' is 'yes'. Returns `M`.
+   */
+  hiopMatrixSparse* set_compressed_spmv(hiopMatrixSparse* M) const;
+
 protected:
   hiopInterfaceSparse& interface;
   int nnz_sparse_Jaceq_;
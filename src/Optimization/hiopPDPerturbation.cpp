@@ -105,6 +105,50 @@ bool hiopPDPerturbation::initialize(hiopNlpFormulation* nlp)
   return true;
 }
 
+void hiopPDPerturbation::save_state(hiopCheckpointSnapshot& chk) const
+{
+  const double params[] = {delta_wx_curr_db_,
+                           delta_wd_curr_db_,
+                           delta_cc_curr_db_,
+                           delta_cd_curr_db_,
+                           delta_wx_last_db_,
+                           delta_wd_last_db_,
+                           delta_cc_last_db_,
+                           delta_cd_last_db_,
+                           (double)hess_degenerate_,
+                           (double)jac_degenerate_,
+                           (double)num_degen_iters_,
+                           (double)deltas_test_type_};
+  chk.add_array("PD_perturb_params", params, sizeof(params) / sizeof(double));
+  chk.add_vec("PD_perturb_wx_last", *delta_wx_last_);
+  chk.add_vec("PD_perturb_wd_last", *delta_wd_last_);
+  chk.add_vec("PD_perturb_cc_last", *delta_cc_last_);
+  chk.add_vec("PD_perturb_cd_last", *delta_cd_last_);
+}
+
+void hiopPDPerturbation::load_state(const hiopCheckpointSnapshot& chk)
+{
+  //!!! dev note: match order in save_state
+  double params[12];
+  chk.copy_array("PD_perturb_params", params, 12);
+  delta_wx_curr_db_ = params[0];
+  delta_wd_curr_db_ = params[1];
+  delta_cc_curr_db_ = params[2];
+  delta_cd_curr_db_ = params[3];
+  delta_wx_last_db_ = params[4];
+  delta_wd_last_db_ = params[5];
+  delta_cc_last_db_ = params[6];
+  delta_cd_last_db_ = params[7];
+  hess_degenerate_ = static_cast<DegeneracyType>(params[8]);
+  jac_degenerate_ = static_cast<DegeneracyType>(params[9]);
+  num_degen_iters_ = static_cast<int>(params[10]);
+  deltas_test_type_ = static_cast<DeltasTestType>(params[11]);
+  chk.copy_vec("PD_perturb_wx_last", *delta_wx_last_);
+  chk.copy_vec("PD_perturb_wd_last", *delta_wd_last_);
+  chk.copy_vec("PD_perturb_cc_last", *delta_cc_last_);
+  chk.copy_vec("PD_perturb_cd_last", *delta_cd_last_);
+}
+
 /** Decides degeneracy @hess_degenerate_ and @jac_degenerate_ based on @deltas_test_type_
  *  when the @num_degen_iters_ > @num_degen_max_iters_
  */
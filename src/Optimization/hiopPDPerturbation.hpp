@@ -3,6 +3,7 @@
 
 #include "hiopNlpFormulation.hpp"
 #include "hiopVector.hpp"
+#include "hiopCheckpoint.hpp"
 
 namespace hiop
 {
@@ -114,6 +115,16 @@ public:
 
   virtual bool check_consistency() = 0;
 
+  /** Saves to a checkpoint snapshot the state carried over between the iterations, that is, the current and
+   * last perturbations and the status of the degeneracy detection.
+   */
+  virtual void save_state(hiopCheckpointSnapshot& chk) const;
+
+  /** Loads the state saved by `save_state`; should be called after `initialize`.
+   * Throws std::runtime_error if the snapshot does not contain the state or its sizes do not match.
+   */
+  virtual void load_state(const hiopCheckpointSnapshot& chk);
+
 protected:
   /** Current and last perturbations, primal is split in x and d, dual in c and d. */
   hiopVector* delta_wx_curr_;
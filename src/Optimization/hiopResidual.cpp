@@ -76,6 +76,8 @@ hiopResidual::hiopResidual(hiopNlpFormulation* nlp_)
   rsvl = rd->new_copy();
   rsvu = rsvl->new_copy();
 
+  reduction_ = new hiopReductionBatch(nlp->get_comm());
+
   nrmInf_nlp_optim = nrmInf_nlp_feasib = nrmInf_nlp_complem = 1e6;
   nrmInf_bar_optim = nrmInf_bar_feasib = nrmInf_bar_complem = 1e6;
   nrmOne_nlp_feasib = nrmOne_nlp_optim = 1e6;
@@ -97,13 +99,13 @@ hiopResidual::~hiopResidual()
   if(rszu) delete rszu;
   if(rsvl) delete rsvl;
   if(rsvu) delete rsvu;
+  delete reduction_;
 }
 
 double hiopResidual::compute_nlp_infeasib_onenorm(const hiopIterate& it, const hiopVector& c, const hiopVector& d)
 {
   nlp->runStats.tmSolverInternal.start();
   double nrmOne_infeasib = 0.;
-  size_type nx_loc = rx->get_local_size();
   // ryc
   ryc->copyFrom(nlp->get_crhs());
   ryc->axpy(-1.0, c);
@@ -114,37 +116,20 @@ double hiopResidual::compute_nlp_infeasib_onenorm(const hiopIterate& it, const h
   nrmOne_infeasib += ryd->onenorm();
   // rxl=x-sxl-xl
   if(nlp->n_low_local() > 0) {
-    rxl->copyFrom(*it.x);
-    rxl->axpy(-1.0, *it.sxl);
-    rxl->axpy(-1.0, nlp->get_xl());
-    // zero out entries in the resid that don't correspond to a finite low bound
-    if(nlp->n_low_local() < nx_loc) {
-      rxl->selectPattern(nlp->get_ixl());
-    }
+    rxl->bound_residual_w_pattern_local(*it.x, *it.sxl, nlp->get_xl(), nlp->get_ixl());
   }
   // rxu=-x-sxu+xu
   if(nlp->n_upp_local() > 0) {
-    rxu->copyFrom(nlp->get_xu());
-    rxu->axpy(-1.0, *it.x);
-    rxu->axpy(-1.0, *it.sxu);
-    if(nlp->n_upp_local() < nx_loc) {
-      rxu->selectPattern(nlp->get_ixu());
-    }
+    rxu->bound_residual_w_pattern_local(nlp->get_xu(), *it.x, *it.sxu, nlp->get_ixu());
   }
   // rdl=d-sdl-dl
   if(nlp->m_ineq_low() > 0) {
-    rdl->copyFrom(*it.d);
-    rdl->axpy(-1.0, *it.sdl);
-    rdl->axpy(-1.0, nlp->get_dl());
-    rdl->selectPattern(nlp->get_idl());
+    rdl->bound_residual_w_pattern_local(*it.d, *it.sdl, nlp->get_dl(), nlp->get_idl());
   }
 
   // rdu=-d-sdu+du
   if(nlp->m_ineq_upp() > 0) {
-    rdu->copyFrom(nlp->get_du());
-    rdu->axpy(-1.0, *it.sdu);
-    rdu->axpy(-1.0, *it.d);
-    rdu->selectPattern(nlp->get_idu());
+    rdu->bound_residual_w_pattern_local(nlp->get_du(), *it.sdu, *it.d, nlp->get_idu());
   }
 
   nlp->runStats.tmSolverInternal.stop();
@@ -167,8 +152,6 @@ int hiopResidual::update(const hiopIterate& it,
   nrmOne_nlp_optim = nrmOne_bar_optim = 0.;
   nrmInf_cons_violation = 0.;
 
-  size_type nx_loc = rx->get_local_size();
-  const double& mu = logprob.mu;
   double buf;
 #ifdef HIOP_DEEPCHECKS
   assert(it.zl->matchesPattern(nlp->get_ixl()));
@@ -176,32 +159,10 @@ int hiopResidual::update(const hiopIterate& it,
   assert(it.sxl->matchesPattern(nlp->get_ixl()));
   assert(it.sxu->matchesPattern(nlp->get_ixu()));
 #endif
-  // rx = -grad_f - J_c^t*x - J_d^t*x+zl-zu - linear damping term in x
-  rx->copyFrom(grad);
-  jac_c.transTimesVec(1.0, *rx, 1.0, *it.yc);
-  jac_d.transTimesVec(1.0, *rx, 1.0, *it.yd);
-  rx->axpy(-1.0, *it.zl);
-  rx->axpy(1.0, *it.zu);
-  buf = rx->infnorm_local();
-  nrmInf_nlp_optim = fmax(nrmInf_nlp_optim, buf);
-  nrmOne_nlp_optim += rx->onenorm();
-  nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rx=%22.17e\n", buf);
-  logprob.addNonLogBarTermsToGrad_x(1.0, *rx);
-  rx->negate();
-  nrmInf_bar_optim = fmax(nrmInf_bar_optim, rx->infnorm_local());
-  nrmOne_bar_optim += rx->onenorm();
-  //~ done with rx
-  // rd
-  rd->copyFrom(*it.yd);
-  rd->axpy(1.0, *it.vl);
-  rd->axpy(-1.0, *it.vu);
-  buf = rd->infnorm_local();
-  nrmInf_nlp_optim = fmax(nrmInf_nlp_optim, buf);
-  nrmOne_nlp_optim += rd->onenorm();
-  nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rd=%22.17e\n", buf);
-  logprob.addNonLogBarTermsToGrad_d(-1.0, *rd);
-  nrmInf_bar_optim = fmax(nrmInf_bar_optim, rd->infnorm_local());
-  nrmOne_bar_optim += rd->onenorm();
+  // the norms of the (distributed) residuals in x are reduced while the residuals in d are computed
+  update_x_residuals(it, grad, jac_c, jac_d, logprob);
+  update_d_residuals(it, logprob);
+
   // ryc
   ryc->copyFrom(nlp->get_crhs());
   ryc->axpy(-1.0, c);
@@ -234,140 +195,133 @@ int hiopResidual::update(const hiopIterate& it,
   nrmOne_nlp_feasib += ryd->onenorm();
   nlp->log->printf(hovScalars, "NLP resid [update]: inf norm ryd=%22.17e\n", buf);
 
+  // set the feasibility error for the log barrier problem
+  nrmInf_bar_feasib = nrmInf_nlp_feasib;
+  nrmOne_bar_feasib = nrmOne_nlp_feasib;
+
+  complete_x_reductions();
+  nlp->runStats.tmSolverInternal.stop();
+  return true;
+}
+
+void hiopResidual::update_x_residuals(const hiopIterate& it,
+                                      const hiopVector& grad,
+                                      const hiopMatrix& jac_c,
+                                      const hiopMatrix& jac_d,
+                                      const hiopLogBarProblem& logprob)
+{
+  const double& mu = logprob.mu;
+  double buf;
+  // The local norms are queued in the order used by `complete_x_reductions`: inf and one norms of rx for
+  // the nlp, the same for the barrier problem, inf norms of [rszl,rszu] for the nlp and the barrier problem
+  reduction_->clear();
+
+  // rx = -grad_f - J_c^t*x - J_d^t*x+zl-zu - linear damping term in x
+  rx->copyFrom(grad);
+  jac_c.transTimesVec(1.0, *rx, 1.0, *it.yc);
+  jac_d.transTimesVec(1.0, *rx, 1.0, *it.yd);
+  rx->axpy(-1.0, *it.zl);
+  rx->axpy(1.0, *it.zu);
+  buf = rx->infnorm_local();
+  reduction_->add_max(buf);
+  reduction_->add_onenorm(*rx);
+  nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rx=%22.17e\n", buf);
+  logprob.addNonLogBarTermsToGrad_x(1.0, *rx);
+  rx->negate();
+  reduction_->add_max(rx->infnorm_local());
+  reduction_->add_onenorm(*rx);
+  //~ done with rx
+
   // rxl=x-sxl-xl
   if(nlp->n_low_local() > 0) {
-    rxl->copyFrom(*it.x);
-    rxl->axpy(-1.0, *it.sxl);
-    rxl->axpy(-1.0, nlp->get_xl());
-    // zero out entries in the resid that don't correspond to a finite low bound
-    if(nlp->n_low_local() < nx_loc) {
-      rxl->selectPattern(nlp->get_ixl());
-    }
-    buf = rxl->infnorm_local();
-    // nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
+    buf = rxl->bound_residual_w_pattern_local(*it.x, *it.sxl, nlp->get_xl(), nlp->get_ixl());
     nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rxl=%22.17e\n", buf);
   }
-  // printf("  %10.4e (xl)", nrmInf_nlp_feasib);
   // rxu=-x-sxu+xu
   if(nlp->n_upp_local() > 0) {
-    rxu->copyFrom(nlp->get_xu());
-    rxu->axpy(-1.0, *it.x);
-    rxu->axpy(-1.0, *it.sxu);
-    if(nlp->n_upp_local() < nx_loc) {
-      rxu->selectPattern(nlp->get_ixu());
-    }
-    buf = rxu->infnorm_local();
-    // nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
+    buf = rxu->bound_residual_w_pattern_local(nlp->get_xu(), *it.x, *it.sxu, nlp->get_ixu());
     nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rxu=%22.17e\n", buf);
   }
-  // printf("  %10.4e (xu)", nrmInf_nlp_feasib);
-  // rdl=d-sdl-dl
-  if(nlp->m_ineq_low() > 0) {
-    rdl->copyFrom(*it.d);
-    rdl->axpy(-1.0, *it.sdl);
-    rdl->axpy(-1.0, nlp->get_dl());
-    rdl->selectPattern(nlp->get_idl());
-    buf = rdl->infnorm_local();
-    // nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rdl=%22.17e\n", buf);
-  }
-  // printf("  %10.4e (dl)", nrmInf_nlp_feasib);
-  // rdu=-d-sdu+du
-  if(nlp->m_ineq_upp() > 0) {
-    rdu->copyFrom(nlp->get_du());
-    rdu->axpy(-1.0, *it.sdu);
-    rdu->axpy(-1.0, *it.d);
-    rdu->selectPattern(nlp->get_idu());
-    buf = rdu->infnorm_local();
-    // nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rdu=%22.17e\n", buf);
-  }
-  // printf("  %10.4e (du)\n", nrmInf_nlp_feasib);
-  // set the feasibility error for the log barrier problem
-  nrmInf_bar_feasib = nrmInf_nlp_feasib;
-  nrmOne_bar_feasib = nrmOne_nlp_feasib;
 
+  // the complementarity residuals and their nlp and barrier inf-norms are computed in one pass
+  double nrm_nlp;
+  double nrm_nlp_complem = 0.;
+  double nrm_bar_complem = 0.;
   // rszl = \mu e - sxl * zl
   if(nlp->n_low_local() > 0) {
-    rszl->setToZero();
-    rszl->axzpy(-1.0, *it.sxl, *it.zl);
-    if(nlp->n_low_local() < nx_loc) {
-      rszl->selectPattern(nlp->get_ixl());
-    }
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, rszl->infnorm_local());
-
-    rszl->addConstant_w_patternSelect(mu, nlp->get_ixl());
-    buf = rszl->infnorm_local();
-    nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
+    buf = rszl->complementarity_residual_local(mu, *it.sxl, *it.zl, nlp->get_ixl(), nrm_nlp);
+    nrm_nlp_complem = fmax(nrm_nlp_complem, nrm_nlp);
+    nrm_bar_complem = fmax(nrm_bar_complem, buf);
     nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rszl=%22.17e\n", buf);
   }
   // rszu = \mu e - sxu * zu
   if(nlp->n_upp_local() > 0) {
-    rszu->setToZero();
-    rszu->axzpy(-1.0, *it.sxu, *it.zu);
-    if(nlp->n_upp_local() < nx_loc) {
-      rszu->selectPattern(nlp->get_ixu());
-    }
+    buf = rszu->complementarity_residual_local(mu, *it.sxu, *it.zu, nlp->get_ixu(), nrm_nlp);
+    nrm_nlp_complem = fmax(nrm_nlp_complem, nrm_nlp);
+    nrm_bar_complem = fmax(nrm_bar_complem, buf);
+    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rszu=%22.17e\n", buf);
+  }
+  reduction_->add_max(nrm_nlp_complem);
+  reduction_->add_max(nrm_bar_complem);
 
-    buf = rszu->infnorm_local();
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, buf);
+  // here we reduce all the norms together, with one (nonblocking) Allreduce, instead of one Allreduce
+  // for each norm
+  reduction_->start(true);
+}
 
-    rszu->addConstant_w_patternSelect(mu, nlp->get_ixu());
-    buf = rszu->infnorm_local();
-    nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rszu=%22.17e\n", buf);
+void hiopResidual::update_d_residuals(const hiopIterate& it, const hiopLogBarProblem& logprob)
+{
+  const double& mu = logprob.mu;
+  double buf;
+  // rd
+  rd->copyFrom(*it.yd);
+  rd->axpy(1.0, *it.vl);
+  rd->axpy(-1.0, *it.vu);
+  buf = rd->infnorm_local();
+  nrmInf_nlp_optim = fmax(nrmInf_nlp_optim, buf);
+  nrmOne_nlp_optim += rd->onenorm();
+  nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rd=%22.17e\n", buf);
+  logprob.addNonLogBarTermsToGrad_d(-1.0, *rd);
+  nrmInf_bar_optim = fmax(nrmInf_bar_optim, rd->infnorm_local());
+  nrmOne_bar_optim += rd->onenorm();
+
+  // rdl=d-sdl-dl
+  if(nlp->m_ineq_low() > 0) {
+    buf = rdl->bound_residual_w_pattern_local(*it.d, *it.sdl, nlp->get_dl(), nlp->get_idl());
+    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rdl=%22.17e\n", buf);
+  }
+  // rdu=-d-sdu+du
+  if(nlp->m_ineq_upp() > 0) {
+    buf = rdu->bound_residual_w_pattern_local(nlp->get_du(), *it.sdu, *it.d, nlp->get_idu());
+    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rdu=%22.17e\n", buf);
   }
+
+  double nrm_nlp;
   // rsvl = \mu e - sdl * vl
   if(nlp->m_ineq_low() > 0) {
-    rsvl->setToZero();
-    rsvl->axzpy(-1.0, *it.sdl, *it.vl);
-    if(nlp->m_ineq_low() < nlp->m_ineq()) {
-      rsvl->selectPattern(nlp->get_idl());
-    }
-    buf = rsvl->infnorm_local();
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, buf);
-
-    // add mu
-    rsvl->addConstant_w_patternSelect(mu, nlp->get_idl());
-    buf = rsvl->infnorm_local();
+    buf = rsvl->complementarity_residual_local(mu, *it.sdl, *it.vl, nlp->get_idl(), nrm_nlp);
+    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, nrm_nlp);
     nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
     nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rsvl=%22.17e\n", buf);
   }
   // rsvu = \mu e - sdu * vu
   if(nlp->m_ineq_upp() > 0) {
-    rsvu->setToZero();
-    rsvu->axzpy(-1.0, *it.sdu, *it.vu);
-
-    if(nlp->m_ineq_upp() < nlp->m_ineq()) {
-      rsvu->selectPattern(nlp->get_idu());
-    }
-    buf = rsvu->infnorm_local();
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, buf);
-
-    // add mu
-    rsvu->addConstant_w_patternSelect(mu, nlp->get_idu());
-    buf = rsvu->infnorm_local();
+    buf = rsvu->complementarity_residual_local(mu, *it.sdu, *it.vu, nlp->get_idu(), nrm_nlp);
+    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, nrm_nlp);
     nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
     nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rsvu=%22.17e\n", buf);
   }
+}
 
-#ifdef HIOP_USE_MPI
-  // here we reduce each of the norm together for a total cost of 1 Allreduce of 3 doubles
-  // otherwise, if calling infnorm() for each vector, there will be 12 Allreduce's, each of 1 double
-  double aux[6] =
-      {nrmInf_nlp_optim, nrmInf_nlp_feasib, nrmInf_nlp_complem, nrmInf_bar_optim, nrmInf_bar_feasib, nrmInf_bar_complem};
-  double aux_g[6];
-  int ierr = MPI_Allreduce(aux, aux_g, 6, MPI_DOUBLE, MPI_MAX, nlp->get_comm());
-  assert(MPI_SUCCESS == ierr);
-  nrmInf_nlp_optim = aux_g[0];
-  nrmInf_nlp_feasib = aux_g[1];
-  nrmInf_nlp_complem = aux_g[2];
-  nrmInf_bar_optim = aux_g[3];
-  nrmInf_bar_feasib = aux_g[4];
-  nrmInf_bar_complem = aux_g[5];
-#endif
-  nlp->runStats.tmSolverInternal.stop();
-  return true;
+void hiopResidual::complete_x_reductions()
+{
+  reduction_->wait();
+  nrmInf_nlp_optim = fmax(nrmInf_nlp_optim, reduction_->value(0));
+  nrmOne_nlp_optim += reduction_->value(1);
+  nrmInf_bar_optim = fmax(nrmInf_bar_optim, reduction_->value(2));
+  nrmOne_bar_optim += reduction_->value(3);
+  nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, reduction_->value(4));
+  nrmInf_bar_complem = fmax(nrmInf_bar_complem, reduction_->value(5));
 }
 
 void hiopResidual::print(FILE* f, const char* msg /*=NULL*/, int max_elems /*=-1*/, int rank /*=-1*/) const
@@ -445,8 +399,6 @@ void hiopResidual::update_soc(const hiopIterate& it,
   nrmOne_nlp_feasib = nrmOne_bar_feasib = 0.;
   nrmOne_nlp_optim = nrmOne_bar_optim = 0.;
 
-  size_type nx_loc = rx->get_local_size();
-  const double& mu = logprob.mu;
   double buf;
 #ifdef HIOP_DEEPCHECKS
   assert(it.zl->matchesPattern(nlp->get_ixl()));
@@ -454,32 +406,9 @@ void hiopResidual::update_soc(const hiopIterate& it,
   assert(it.sxl->matchesPattern(nlp->get_ixl()));
   assert(it.sxu->matchesPattern(nlp->get_ixu()));
 #endif
-  // rx = -grad_f - J_c^t*x - J_d^t*x+zl-zu - linear damping term in x
-  rx->copyFrom(grad);
-  jac_c.transTimesVec(1.0, *rx, 1.0, *it.yc);
-  jac_d.transTimesVec(1.0, *rx, 1.0, *it.yd);
-  rx->axpy(-1.0, *it.zl);
-  rx->axpy(1.0, *it.zu);
-  buf = rx->infnorm_local();
-  nrmInf_nlp_optim = fmax(nrmInf_nlp_optim, buf);
-  nrmOne_nlp_optim += rx->onenorm();
-  nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rx=%22.17e\n", buf);
-  logprob.addNonLogBarTermsToGrad_x(1.0, *rx);
-  rx->negate();
-  nrmInf_bar_optim = fmax(nrmInf_bar_optim, rx->infnorm_local());
-  nrmOne_bar_optim += rx->onenorm();
-
-  // rd
-  rd->copyFrom(*it.yd);
-  rd->axpy(1.0, *it.vl);
-  rd->axpy(-1.0, *it.vu);
-  buf = rd->infnorm_local();
-  nrmInf_nlp_optim = fmax(nrmInf_nlp_optim, buf);
-  nrmOne_nlp_optim += rd->onenorm();
-  nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rd=%22.17e\n", buf);
-  logprob.addNonLogBarTermsToGrad_d(-1.0, *rd);
-  nrmInf_bar_optim = fmax(nrmInf_bar_optim, rd->infnorm_local());
-  nrmOne_bar_optim += rd->onenorm();
+  // the norms of the (distributed) residuals in x are reduced while the residuals in d are computed
+  update_x_residuals(it, grad, jac_c, jac_d, logprob);
+  update_d_residuals(it, logprob);
 
   // ryc for soc: \alpha*c + c_trial
   ryc->copyFrom(c_soc);
@@ -495,137 +424,11 @@ void hiopResidual::update_soc(const hiopIterate& it,
   nrmOne_nlp_feasib += ryd->onenorm();
   nlp->log->printf(hovScalars, "NLP resid [update]: inf norm ryd=%22.17e\n", buf);
 
-  // rxl=x-sxl-xl
-  if(nlp->n_low_local() > 0) {
-    rxl->copyFrom(*it.x);
-    rxl->axpy(-1.0, *it.sxl);
-    rxl->axpy(-1.0, nlp->get_xl());
-    // zero out entries in the resid that don't correspond to a finite low bound
-    if(nlp->n_low_local() < nx_loc) {
-      rxl->selectPattern(nlp->get_ixl());
-    }
-    buf = rxl->infnorm_local();
-    // nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rxl=%22.17e\n", buf);
-  }
-  // printf("  %10.4e (xl)", nrmInf_nlp_feasib);
-  // rxu=-x-sxu+xu
-  if(nlp->n_upp_local() > 0) {
-    rxu->copyFrom(nlp->get_xu());
-    rxu->axpy(-1.0, *it.x);
-    rxu->axpy(-1.0, *it.sxu);
-    if(nlp->n_upp_local() < nx_loc) {
-      rxu->selectPattern(nlp->get_ixu());
-    }
-    buf = rxu->infnorm_local();
-    // nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rxu=%22.17e\n", buf);
-  }
-  // printf("  %10.4e (xu)", nrmInf_nlp_feasib);
-  // rdl=d-sdl-dl
-  if(nlp->m_ineq_low() > 0) {
-    rdl->copyFrom(*it.d);
-    rdl->axpy(-1.0, *it.sdl);
-    rdl->axpy(-1.0, nlp->get_dl());
-    rdl->selectPattern(nlp->get_idl());
-    buf = rdl->infnorm_local();
-    // nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rdl=%22.17e\n", buf);
-  }
-  // printf("  %10.4e (dl)", nrmInf_nlp_feasib);
-  // rdu=-d-sdu+du
-  if(nlp->m_ineq_upp() > 0) {
-    rdu->copyFrom(nlp->get_du());
-    rdu->axpy(-1.0, *it.sdu);
-    rdu->axpy(-1.0, *it.d);
-    rdu->selectPattern(nlp->get_idu());
-    buf = rdu->infnorm_local();
-    //    nrmInf_nlp_feasib = fmax(nrmInf_nlp_feasib, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rdl=%22.17e\n", buf);
-  }
-  // printf("  %10.4e (du)\n", nrmInf_nlp_feasib);
   // set the feasibility error for the log barrier problem
   nrmInf_bar_feasib = nrmInf_nlp_feasib;
   nrmOne_bar_feasib = nrmOne_nlp_feasib;
 
-  // rszl = \mu e - sxl * zl
-  if(nlp->n_low_local() > 0) {
-    rszl->setToZero();
-    rszl->axzpy(-1.0, *it.sxl, *it.zl);
-    if(nlp->n_low_local() < nx_loc) {
-      rszl->selectPattern(nlp->get_ixl());
-    }
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, rszl->infnorm_local());
-
-    rszl->addConstant_w_patternSelect(mu, nlp->get_ixl());
-    buf = rszl->infnorm_local();
-    nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rszl=%22.17e\n", buf);
-  }
-  // rszu = \mu e - sxu * zu
-  if(nlp->n_upp_local() > 0) {
-    rszu->setToZero();
-    rszu->axzpy(-1.0, *it.sxu, *it.zu);
-    if(nlp->n_upp_local() < nx_loc) {
-      rszu->selectPattern(nlp->get_ixu());
-    }
-
-    buf = rszu->infnorm_local();
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, buf);
-
-    rszu->addConstant_w_patternSelect(mu, nlp->get_ixu());
-    buf = rszu->infnorm_local();
-    nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rszu=%22.17e\n", buf);
-  }
-  // rsvl = \mu e - sdl * vl
-  if(nlp->m_ineq_low() > 0) {
-    rsvl->setToZero();
-    rsvl->axzpy(-1.0, *it.sdl, *it.vl);
-    if(nlp->m_ineq_low() < nlp->m_ineq()) {
-      rsvl->selectPattern(nlp->get_idl());
-    }
-    buf = rsvl->infnorm_local();
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, buf);
-
-    // add mu
-    rsvl->addConstant_w_patternSelect(mu, nlp->get_idl());
-    buf = rsvl->infnorm_local();
-    nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rsvl=%22.17e\n", buf);
-  }
-  // rsvu = \mu e - sdu * vu
-  if(nlp->m_ineq_upp() > 0) {
-    rsvu->setToZero();
-    rsvu->axzpy(-1.0, *it.sdu, *it.vu);
-
-    if(nlp->m_ineq_upp() < nlp->m_ineq()) {
-      rsvu->selectPattern(nlp->get_idu());
-    }
-    buf = rsvu->infnorm_local();
-    nrmInf_nlp_complem = fmax(nrmInf_nlp_complem, buf);
-
-    // add mu
-    rsvu->addConstant_w_patternSelect(mu, nlp->get_idu());
-    buf = rsvu->infnorm_local();
-    nrmInf_bar_complem = fmax(nrmInf_bar_complem, buf);
-    nlp->log->printf(hovScalars, "NLP resid [update]: inf norm rsvu=%22.17e\n", buf);
-  }
-#ifdef HIOP_USE_MPI
-  // here we reduce each of the norm together for a total cost of 1 Allreduce of 3 doubles
-  // otherwise, if calling infnorm() for each vector, there will be 12 Allreduce's, each of 1 double
-  double aux[6] =
-      {nrmInf_nlp_optim, nrmInf_nlp_feasib, nrmInf_nlp_complem, nrmInf_bar_optim, nrmInf_bar_feasib, nrmInf_bar_complem},
-         aux_g[6];
-  int ierr = MPI_Allreduce(aux, aux_g, 6, MPI_DOUBLE, MPI_MAX, nlp->get_comm());
-  assert(MPI_SUCCESS == ierr);
-  nrmInf_nlp_optim = aux_g[0];
-  nrmInf_nlp_feasib = aux_g[1];
-  nrmInf_nlp_complem = aux_g[2];
-  nrmInf_bar_optim = aux_g[3];
-  nrmInf_bar_feasib = aux_g[4];
-  nrmInf_bar_complem = aux_g[5];
-#endif
+  complete_x_reductions();
   nlp->runStats.tmSolverInternal.stop();
 }
 
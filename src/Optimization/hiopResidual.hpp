@@ -54,6 +54,7 @@
 #include "hiopIterate.hpp"
 
 #include "hiopLogBarProblem.hpp"
+#include "hiopReductionBatch.hpp"
 
 namespace hiop
 {
@@ -188,6 +189,20 @@ private:
   // and associated info from problem formulation
   hiopNlpFormulation* nlp;
 
+  /// the norms of the residuals in x, which are distributed, are reduced together by this batch
+  hiopReductionBatch* reduction_;
+
+  /// computes rx, rxl, rxu, rszl, and rszu and starts the (nonblocking) reduction of their norms
+  void update_x_residuals(const hiopIterate& it,
+                          const hiopVector& grad,
+                          const hiopMatrix& jac_c,
+                          const hiopMatrix& jac_d,
+                          const hiopLogBarProblem& logprob);
+  /// computes rd, rdl, rdu, rsvl, and rsvu and their norms, which do not need communication
+  void update_d_residuals(const hiopIterate& it, const hiopLogBarProblem& logprob);
+  /// waits for the reduction started by update_x_residuals and updates the norms of the residuals
+  void complete_x_reductions();
+
 private:
   hiopResidual() {};
   hiopResidual(const hiopResidual&) {};
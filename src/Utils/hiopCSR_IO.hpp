@@ -1,6 +1,9 @@
 #ifndef HIOP_CSR_IO
 #define HIOP_CSR_IO
 
+#include "hiopKKTDump.hpp"
+
+#include <memory>
 #include <string>
 #ifdef HIOP_USE_MPI
 #include <mpi.h>
@@ -17,6 +20,9 @@ namespace hiop
  *   3. writeSolToFile -> will append the sol
  *
  * The format of .iajaaa files is described in src/LinAlg/csr_iajaaa.md
+ *
+ * With the option `write_kkt_format` set to 'binary', the systems are instead appended to a single binary file
+ * (kkt_linsys.hkkt) by a background thread, see `hiopKKTDumpWriter`.
  */
 class hiopCSR_IO
 {
@@ -31,7 +37,15 @@ public:
         last_counter(-1)
   {}
 
-  virtual ~hiopCSR_IO() {}
+  virtual ~hiopCSR_IO()
+  {
+    if(bin_writer_) {
+      std::string errors;
+      if(!bin_writer_->wait(errors)) {
+        _nlp->log->printf(hovError, "Failed to write the KKT linear systems: %s", errors.c_str());
+      }
+    }
+  }
 
   /**
    * @brief Appends a right-hand side vector to the .iajaaa file
@@ -46,6 +60,11 @@ public:
 #endif
     assert(counter == last_counter);
     assert(m == rhs.get_size());
+    if(write_binary()) {
+      binary_writer().write_rhs(counter, m, rhs.local_data_const());
+      check_binary_errors();
+      return;
+    }
 
     std::string fname = "kkt_linsys_";
     fname += std::to_string(counter);
@@ -69,7 +88,20 @@ public:
    * @param counter specifies the suffix in the filename, usually is the iteration number
    */
 
-  inline void writeSolToFile(const hiopVector& sol, const int& counter) { writeRhsToFile(sol, counter); }
+  inline void writeSolToFile(const hiopVector& sol, const int& counter)
+  {
+    if(write_binary()) {
+#ifdef HIOP_USE_MPI
+      if(_master_rank >= 0 && _master_rank != _nlp->get_rank()) return;
+#endif
+      assert(counter == last_counter);
+      assert(m == sol.get_size());
+      binary_writer().write_sol(counter, m, sol.local_data_const());
+      check_binary_errors();
+      return;
+    }
+    writeRhsToFile(sol, counter);
+  }
 
   /**
    * @brief Writes a dense matrix in the sparse iajaaa format (zero elements are not written)
@@ -87,6 +119,11 @@ public:
 #endif
     last_counter = counter;
     m = Msys.m();
+    if(write_binary()) {
+      binary_writer().write_matrix_dense(counter, m, nx, meq, mineq, Msys.local_data_const());
+      check_binary_errors();
+      return;
+    }
 
     std::string fname = "kkt_linsys_";
     fname += std::to_string(counter);
@@ -157,6 +194,20 @@ public:
 #endif
     last_counter = counter;
     m = Msys.m();
+    if(write_binary()) {
+      // the CSR conversion is done by the background thread
+      binary_writer().write_matrix_triplet(counter,
+                                           m,
+                                           nx,
+                                           meq,
+                                           mineq,
+                                           Msys.numberOfNonzeros(),
+                                           Msys.i_row(),
+                                           Msys.j_col(),
+                                           Msys.M());
+      check_binary_errors();
+      return;
+    }
 
     std::string fname = "kkt_linsys_";
     fname += std::to_string(counter);
@@ -227,6 +278,33 @@ public:
     }
   }
 
+private:
+  inline bool write_binary() const { return _nlp->options->GetString("write_kkt_format") == "binary"; }
+
+  /// Creates the binary writer at the first use
+  hiopKKTDumpWriter& binary_writer()
+  {
+    if(!bin_writer_) {
+      const bool compress = _nlp->options->GetString("write_kkt_compression") == "yes";
+      const std::string path = hiopKKTDumpWriter::unique_path("kkt_linsys");
+      bin_writer_.reset(new hiopKKTDumpWriter(path, compress));
+      _nlp->log->printf(hovSummary,
+                        "Writing the KKT linear systems to '%s' (%s).\n",
+                        path.c_str(),
+                        compress ? (hiopKKTDumpWriter::has_zstd() ? "delta+zstd" : "delta") : "uncompressed");
+    }
+    return *bin_writer_;
+  }
+
+  /// Logs the failures of the background writes, if any; does not block
+  void check_binary_errors()
+  {
+    std::string errors;
+    if(!bin_writer_->check_errors(errors)) {
+      _nlp->log->printf(hovError, "Failed to write the KKT linear systems: %s", errors.c_str());
+    }
+  }
+
 private:
   hiopNlpFormulation* _nlp;
 #ifdef HIOP_USE_MPI
@@ -234,6 +312,7 @@ private:
 #endif
   int m;
   int last_counter;  // used only for consistency (such as order of calls) checks
+  std::unique_ptr<hiopKKTDumpWriter> bin_writer_;
 };
 }  // namespace hiop
 
@@ -0,0 +1,774 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopKKTDump.cpp
+ *
+ * Binary KKT dump format: encoding, asynchronous writer, and reader.
+ *
+ */
+#include "hiopKKTDump.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+#ifdef HIOP_USE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace hiop
+{
+namespace
+{
+const char kkt_magic[8] = "HIOPKKT";
+const uint32_t kkt_format_version = 1;
+/// type, codec, encoded size, stored size
+const size_t kkt_record_header_size = 18;
+const int kkt_zstd_level = 3;
+
+inline void put_u8(std::string& out, uint8_t v) { out.push_back(static_cast<char>(v)); }
+
+inline void put_u64(std::string& out, uint64_t v)
+{
+  for(int b = 0; b < 8; b++) {
+    out.push_back(static_cast<char>((v >> (8 * b)) & 0xff));
+  }
+}
+
+inline void put_i64(std::string& out, int64_t v) { put_u64(out, static_cast<uint64_t>(v)); }
+
+inline void put_varint(std::string& out, uint64_t v)
+{
+  while(v >= 0x80) {
+    out.push_back(static_cast<char>((v & 0x7f) | 0x80));
+    v >>= 7;
+  }
+  out.push_back(static_cast<char>(v));
+}
+
+inline uint64_t zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+
+inline int64_t unzigzag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+inline uint64_t double_bits(double d)
+{
+  uint64_t u;
+  memcpy(&u, &d, sizeof(u));
+  return u;
+}
+
+inline double bits_double(uint64_t u)
+{
+  double d;
+  memcpy(&d, &u, sizeof(d));
+  return d;
+}
+
+/**
+ * Appends `n` doubles: raw, or, with the delta codec, as the XOR with `prev` (which is updated) preceded by the
+ * number of significant bytes, of which only the low ones are written.
+ */
+void put_doubles(std::string& out, const double* v, size_t n, bool delta, std::vector<double>& prev)
+{
+  if(!delta) {
+    for(size_t i = 0; i < n; i++) {
+      put_u64(out, double_bits(v[i]));
+    }
+    return;
+  }
+  if(prev.size() != n) {
+    prev.assign(n, 0.);
+  }
+  for(size_t i = 0; i < n; i++) {
+    const uint64_t x = double_bits(v[i]) ^ double_bits(prev[i]);
+    int nbytes = 8;
+    while(nbytes > 0 && 0 == (x >> (8 * (nbytes - 1)))) {
+      nbytes--;
+    }
+    put_u8(out, static_cast<uint8_t>(nbytes));
+    for(int b = 0; b < nbytes; b++) {
+      out.push_back(static_cast<char>((x >> (8 * b)) & 0xff));
+    }
+    prev[i] = v[i];
+  }
+}
+
+/// Sequential decoding of a payload; `ok` becomes false when reading past the end
+struct Cursor
+{
+  explicit Cursor(const std::string& buf)
+      : buf_(buf),
+        pos_(0),
+        ok(true)
+  {}
+
+  inline uint8_t u8()
+  {
+    if(pos_ >= buf_.size()) {
+      ok = false;
+      return 0;
+    }
+    return static_cast<uint8_t>(buf_[pos_++]);
+  }
+
+  inline uint64_t u64()
+  {
+    uint64_t v = 0;
+    for(int b = 0; b < 8; b++) {
+      v |= static_cast<uint64_t>(u8()) << (8 * b);
+    }
+    return v;
+  }
+
+  inline int64_t i64() { return static_cast<int64_t>(u64()); }
+
+  inline uint64_t varint()
+  {
+    uint64_t v = 0;
+    for(int shift = 0; shift < 64 && ok; shift += 7) {
+      const uint8_t byte = u8();
+      v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if(0 == (byte & 0x80)) {
+        return v;
+      }
+    }
+    ok = false;
+    return 0;
+  }
+
+  void doubles(double* v, size_t n, bool delta, std::vector<double>& prev)
+  {
+    if(!delta) {
+      for(size_t i = 0; i < n && ok; i++) {
+        v[i] = bits_double(u64());
+      }
+      return;
+    }
+    if(prev.size() != n) {
+      prev.assign(n, 0.);
+    }
+    for(size_t i = 0; i < n && ok; i++) {
+      const int nbytes = u8();
+      if(nbytes > 8) {
+        ok = false;
+        return;
+      }
+      uint64_t x = 0;
+      for(int b = 0; b < nbytes; b++) {
+        x |= static_cast<uint64_t>(u8()) << (8 * b);
+      }
+      v[i] = bits_double(x ^ double_bits(prev[i]));
+      prev[i] = v[i];
+    }
+  }
+
+private:
+  const std::string& buf_;
+  size_t pos_;
+
+public:
+  bool ok;
+};
+
+/// Full upper triangle pattern of a dense matrix of size `n`
+void dense_upper_pattern(int64_t n, std::vector<int64_t>& row_ptr, std::vector<int64_t>& col)
+{
+  row_ptr.resize(n + 1);
+  col.resize(n * (n + 1) / 2);
+  row_ptr[0] = 0;
+  for(int64_t i = 0; i < n; i++) {
+    row_ptr[i + 1] = row_ptr[i] + n - i;
+    std::iota(col.begin() + row_ptr[i], col.begin() + row_ptr[i + 1], i);
+  }
+}
+}  // namespace
+
+hiopKKTDumpWriter::hiopKKTDumpWriter(const std::string& path, bool compress)
+    : path_(path),
+      compress_(compress),
+      file_(nullptr),
+      failed_(false),
+      queued_bytes_(0),
+      busy_(false),
+      stop_(false)
+{}
+
+hiopKKTDumpWriter::~hiopKKTDumpWriter()
+{
+  if(thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+  }
+  if(file_) {
+    fclose(file_);
+  }
+}
+
+std::string hiopKKTDumpWriter::unique_path(const std::string& prefix)
+{
+  static std::atomic<int> num_writers(0);
+  const int k = num_writers++;
+  return 0 == k ? prefix + ".hkkt" : prefix + "_" + std::to_string(k) + ".hkkt";
+}
+
+bool hiopKKTDumpWriter::has_zstd()
+{
+#ifdef HIOP_USE_ZSTD
+  return true;
+#else
+  return false;
+#endif
+}
+
+void hiopKKTDumpWriter::write_matrix_triplet(int counter,
+                                             int n,
+                                             int nx,
+                                             int meq,
+                                             int mineq,
+                                             int nnz,
+                                             const int* irow,
+                                             const int* jcol,
+                                             const double* vals)
+{
+  const size_t bytes_idx = static_cast<size_t>(nnz) * sizeof(int);
+  const bool same_pattern = pattern_ && !pattern_->dense && pattern_->n == n && pattern_->nx == nx &&
+                            pattern_->meq == meq && pattern_->mineq == mineq &&
+                            pattern_->irow.size() == static_cast<size_t>(nnz) &&
+                            0 == memcmp(pattern_->irow.data(), irow, bytes_idx) &&
+                            0 == memcmp(pattern_->jcol.data(), jcol, bytes_idx);
+  if(!same_pattern) {
+    std::shared_ptr<Pattern> p = std::make_shared<Pattern>();
+    p->n = n;
+    p->nx = nx;
+    p->meq = meq;
+    p->mineq = mineq;
+    p->dense = false;
+    p->irow.assign(irow, irow + nnz);
+    p->jcol.assign(jcol, jcol + nnz);
+
+    // sort the triplets by rows and columns; duplicates share the same CSR position
+    std::vector<int> order(nnz);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      return irow[a] != irow[b] ? irow[a] < irow[b] : jcol[a] < jcol[b];
+    });
+    bool lower = true, upper = true;
+    p->row_ptr.assign(n + 1, 0);
+    p->col.clear();
+    p->col.reserve(nnz);
+    p->trip2csr.resize(nnz);
+    for(int k = 0; k < nnz; k++) {
+      const int t = order[k];
+      assert(irow[t] >= 0 && irow[t] < n && jcol[t] >= 0 && jcol[t] < n);
+      const bool duplicate = k > 0 && irow[t] == irow[order[k - 1]] && jcol[t] == jcol[order[k - 1]];
+      if(!duplicate) {
+        p->col.push_back(jcol[t]);
+        p->row_ptr[irow[t] + 1]++;
+      }
+      p->trip2csr[t] = static_cast<int64_t>(p->col.size()) - 1;
+      lower = lower && jcol[t] <= irow[t];
+      upper = upper && jcol[t] >= irow[t];
+    }
+    for(int i = 0; i < n; i++) {
+      p->row_ptr[i + 1] += p->row_ptr[i];
+    }
+    p->triangle = lower ? 'L' : (upper ? 'U' : 'F');
+    pattern_ = p;
+    enqueue(Record{kPattern, counter, pattern_, std::vector<double>()});
+  }
+
+  Record rec{kMatrix, counter, pattern_, acquire_buffer(nnz)};
+  std::copy(vals, vals + nnz, rec.data.begin());
+  enqueue(std::move(rec));
+}
+
+void hiopKKTDumpWriter::write_matrix_dense(int counter, int n, int nx, int meq, int mineq, const double* M)
+{
+  const bool same_pattern = pattern_ && pattern_->dense && pattern_->n == n && pattern_->nx == nx &&
+                            pattern_->meq == meq && pattern_->mineq == mineq;
+  if(!same_pattern) {
+    std::shared_ptr<Pattern> p = std::make_shared<Pattern>();
+    p->n = n;
+    p->nx = nx;
+    p->meq = meq;
+    p->mineq = mineq;
+    p->dense = true;
+    p->triangle = 'U';
+    pattern_ = p;
+    enqueue(Record{kPattern, counter, pattern_, std::vector<double>()});
+  }
+
+  Record rec{kMatrix, counter, pattern_, acquire_buffer(static_cast<size_t>(n) * (n + 1) / 2)};
+  double* dest = rec.data.data();
+  for(int i = 0; i < n; i++) {
+    std::copy(M + static_cast<size_t>(i) * n + i, M + static_cast<size_t>(i + 1) * n, dest);
+    dest += n - i;
+  }
+  enqueue(std::move(rec));
+}
+
+void hiopKKTDumpWriter::write_rhs(int counter, int n, const double* rhs) { write_vector(kRhs, counter, n, rhs); }
+
+void hiopKKTDumpWriter::write_sol(int counter, int n, const double* sol) { write_vector(kSol, counter, n, sol); }
+
+void hiopKKTDumpWriter::write_vector(int type, int counter, int n, const double* v)
+{
+  Record rec{type, counter, nullptr, acquire_buffer(n)};
+  std::copy(v, v + n, rec.data.begin());
+  enqueue(std::move(rec));
+}
+
+std::vector<double> hiopKKTDumpWriter::acquire_buffer(size_t n)
+{
+  std::vector<double> buf;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if(!free_buffers_.empty()) {
+      buf.swap(free_buffers_.back());
+      free_buffers_.pop_back();
+    }
+  }
+  buf.resize(n);
+  return buf;
+}
+
+void hiopKKTDumpWriter::enqueue(Record&& rec)
+{
+  const size_t bytes = rec.data.size() * sizeof(double);
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return 0 == queued_bytes_ || queued_bytes_ + bytes <= max_queued_bytes; });
+    queued_bytes_ += bytes;
+    queue_.push_back(std::move(rec));
+    if(!thread_.joinable()) {
+      thread_ = std::thread(&hiopKKTDumpWriter::thread_loop, this);
+    }
+  }
+  cv_.notify_all();
+}
+
+bool hiopKKTDumpWriter::wait(std::string& errors)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return queue_.empty() && !busy_; });
+  }
+  return check_errors(errors);
+}
+
+bool hiopKKTDumpWriter::check_errors(std::string& errors)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  errors.swap(errors_);
+  errors_.clear();
+  return errors.empty();
+}
+
+void hiopKKTDumpWriter::thread_loop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while(true) {
+    cv_.wait(lock, [this] { return !queue_.empty() || stop_; });
+    if(queue_.empty()) {
+      // stop requested and nothing left to write
+      break;
+    }
+    Record rec = std::move(queue_.front());
+    queue_.pop_front();
+    busy_ = true;
+    lock.unlock();
+
+    // after a failure, the records are dropped (the file would be unreadable past the failed record)
+    std::string error;
+    if(!failed_) {
+      try {
+        payload_.clear();
+        encode(rec, payload_);
+        write_record(rec.type, payload_);
+      } catch(const std::exception& exp) {
+        error = exp.what();
+        failed_ = true;
+        if(file_) {
+          fclose(file_);
+          file_ = nullptr;
+        }
+      }
+    }
+
+    lock.lock();
+    queued_bytes_ -= rec.data.size() * sizeof(double);
+    if(!error.empty()) {
+      errors_ += error + "\n";
+    }
+    if(rec.data.capacity() > 0 && free_buffers_.size() < 4) {
+      free_buffers_.push_back(std::move(rec.data));
+    }
+    busy_ = false;
+    cv_.notify_all();
+  }
+}
+
+void hiopKKTDumpWriter::encode(const Record& rec, std::string& out)
+{
+  const bool delta = compress_;
+  const Pattern* p = rec.pattern.get();
+  switch(rec.type) {
+    case kPattern: {
+      const int64_t nnz = p->dense ? p->n * (p->n + 1) / 2 : static_cast<int64_t>(p->col.size());
+      put_i64(out, p->n);
+      put_i64(out, p->nx);
+      put_i64(out, p->meq);
+      put_i64(out, p->mineq);
+      put_i64(out, nnz);
+      put_u8(out, p->dense ? 1 : 0);
+      put_u8(out, static_cast<uint8_t>(p->triangle));
+      if(p->dense) {
+        break;
+      }
+      if(!delta) {
+        for(int64_t v : p->row_ptr) {
+          put_i64(out, v);
+        }
+        for(int64_t v : p->col) {
+          put_i64(out, v);
+        }
+        break;
+      }
+      for(int64_t i = 0; i < p->n; i++) {
+        put_varint(out, static_cast<uint64_t>(p->row_ptr[i + 1] - p->row_ptr[i]));
+      }
+      for(int64_t i = 0; i < p->n; i++) {
+        int64_t prev = i;
+        for(int64_t k = p->row_ptr[i]; k < p->row_ptr[i + 1]; k++) {
+          put_varint(out, zigzag(p->col[k] - prev));
+          prev = p->col[k];
+        }
+      }
+    } break;
+    case kMatrix: {
+      put_i64(out, rec.counter);
+      if(p->dense) {
+        put_doubles(out, rec.data.data(), rec.data.size(), delta, prev_[kMatrix]);
+        break;
+      }
+      // triplets to CSR, summing the duplicates
+      csr_vals_.assign(p->col.size(), 0.);
+      for(size_t k = 0; k < rec.data.size(); k++) {
+        csr_vals_[p->trip2csr[k]] += rec.data[k];
+      }
+      put_doubles(out, csr_vals_.data(), csr_vals_.size(), delta, prev_[kMatrix]);
+    } break;
+    default: {
+      assert(kRhs == rec.type || kSol == rec.type);
+      put_i64(out, rec.counter);
+      put_i64(out, static_cast<int64_t>(rec.data.size()));
+      put_doubles(out, rec.data.data(), rec.data.size(), delta, prev_[rec.type]);
+    }
+  }
+}
+
+void hiopKKTDumpWriter::write_record(int type, const std::string& payload)
+{
+  if(nullptr == file_) {
+    file_ = fopen(path_.c_str(), "wb");
+    if(nullptr == file_) {
+      throw std::runtime_error("Could not open '" + path_ + "' for writing the KKT linear systems.");
+    }
+    std::string header(kkt_magic, sizeof(kkt_magic));
+    put_u64(header, kkt_format_version);
+    header.resize(sizeof(kkt_magic) + sizeof(uint32_t));
+    if(1 != fwrite(header.data(), header.size(), 1, file_)) {
+      throw std::runtime_error("Could not write to '" + path_ + "'.");
+    }
+  }
+
+  uint8_t codec = compress_ ? kDelta : 0;
+  const std::string* stored = &payload;
+#ifdef HIOP_USE_ZSTD
+  if(compress_) {
+    zbuf_.resize(ZSTD_compressBound(payload.size()));
+    const size_t zsize = ZSTD_compress(&zbuf_[0], zbuf_.size(), payload.data(), payload.size(), kkt_zstd_level);
+    if(ZSTD_isError(zsize)) {
+      throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(zsize));
+    }
+    zbuf_.resize(zsize);
+    codec |= kZstd;
+    stored = &zbuf_;
+  }
+#endif
+
+  std::string header;
+  put_u8(header, static_cast<uint8_t>(type));
+  put_u8(header, codec);
+  put_u64(header, payload.size());
+  put_u64(header, stored->size());
+  assert(header.size() == kkt_record_header_size);
+  // flushed after each record, so that the file holds the records written so far if the run ends or crashes
+  // while the writer is alive
+  if(1 != fwrite(header.data(), header.size(), 1, file_) ||
+     (!stored->empty() && 1 != fwrite(stored->data(), stored->size(), 1, file_)) || 0 != fflush(file_)) {
+    throw std::runtime_error("Could not write to '" + path_ + "'.");
+  }
+}
+
+hiopKKTDumpReader::hiopKKTDumpReader()
+    : file_(nullptr),
+      dense_(false),
+      has_pattern_(false),
+      pending_type_(0),
+      pending_codec_(0)
+{}
+
+hiopKKTDumpReader::~hiopKKTDumpReader()
+{
+  if(file_) {
+    fclose(file_);
+  }
+}
+
+bool hiopKKTDumpReader::open(const std::string& path, std::string& error)
+{
+  path_ = path;
+  file_ = fopen(path.c_str(), "rb");
+  if(nullptr == file_) {
+    error = "Could not open '" + path + "'.";
+    return false;
+  }
+  std::string header(sizeof(kkt_magic) + sizeof(uint32_t), '\0');
+  if(1 != fread(&header[0], header.size(), 1, file_) || 0 != memcmp(header.data(), kkt_magic, sizeof(kkt_magic))) {
+    error = "'" + path + "' is not a HiOp KKT dump.";
+    return false;
+  }
+  std::string version = header.substr(sizeof(kkt_magic)) + std::string(4, '\0');
+  Cursor c(version);
+  if(c.u64() != kkt_format_version) {
+    error = "'" + path + "' has an unsupported version of the KKT dump format.";
+    return false;
+  }
+  return true;
+}
+
+bool hiopKKTDumpReader::read_record(int& type, int& codec, std::string& payload, std::string& error)
+{
+  std::string header(kkt_record_header_size, '\0');
+  const size_t nread = fread(&header[0], 1, header.size(), file_);
+  if(0 == nread) {
+    return false;
+  }
+  if(nread != header.size()) {
+    error = "'" + path_ + "' is truncated.";
+    return false;
+  }
+  Cursor c(header);
+  type = c.u8();
+  codec = c.u8();
+  const uint64_t size = c.u64();
+  const uint64_t stored_size = c.u64();
+  if(size > (uint64_t(1) << 40) || stored_size > (uint64_t(1) << 40)) {
+    error = "'" + path_ + "' is corrupted.";
+    return false;
+  }
+  std::string stored(stored_size, '\0');
+  if(stored_size > 0 && 1 != fread(&stored[0], stored_size, 1, file_)) {
+    error = "'" + path_ + "' is truncated.";
+    return false;
+  }
+  if(0 == (codec & hiopKKTDumpWriter::kZstd)) {
+    payload.swap(stored);
+    return true;
+  }
+#ifdef HIOP_USE_ZSTD
+  payload.resize(size);
+  const size_t zsize = ZSTD_decompress(&payload[0], payload.size(), stored.data(), stored.size());
+  if(ZSTD_isError(zsize) || zsize != size) {
+    error = "'" + path_ + "' is corrupted (zstd decompression failed).";
+    return false;
+  }
+  return true;
+#else
+  error = "'" + path_ + "' is compressed with zstd, but HiOp was built without zstd (HIOP_USE_ZSTD).";
+  return false;
+#endif
+}
+
+bool hiopKKTDumpReader::read_next(hiopKKTDumpSystem& sys, std::string& error)
+{
+  error.clear();
+  if(nullptr == file_) {
+    error = "no KKT dump file is open";
+    return false;
+  }
+  bool has_matrix = false;
+  while(true) {
+    int type, codec;
+    std::string payload;
+    if(pending_type_ > 0) {
+      type = pending_type_;
+      codec = pending_codec_;
+      payload.swap(pending_payload_);
+      pending_type_ = 0;
+    } else if(!read_record(type, codec, payload, error)) {
+      return has_matrix && error.empty();
+    }
+    if(has_matrix && (hiopKKTDumpWriter::kPattern == type || hiopKKTDumpWriter::kMatrix == type)) {
+      // the next system starts
+      pending_type_ = type;
+      pending_codec_ = codec;
+      pending_payload_.swap(payload);
+      return true;
+    }
+
+    const bool delta = 0 != (codec & hiopKKTDumpWriter::kDelta);
+    Cursor c(payload);
+    switch(type) {
+      case hiopKKTDumpWriter::kPattern: {
+        pattern_.n = c.i64();
+        pattern_.nx = c.i64();
+        pattern_.meq = c.i64();
+        pattern_.mineq = c.i64();
+        const int64_t nnz = c.i64();
+        dense_ = 1 == c.u8();
+        pattern_.triangle = static_cast<char>(c.u8());
+        if(!c.ok || pattern_.n < 0 || nnz < 0) {
+          c.ok = false;
+          break;
+        }
+        if(dense_) {
+          dense_upper_pattern(pattern_.n, pattern_.row_ptr, pattern_.col);
+          c.ok = static_cast<int64_t>(pattern_.col.size()) == nnz;
+          has_pattern_ = c.ok;
+          break;
+        }
+        // at least one byte per index
+        if(static_cast<uint64_t>(nnz + pattern_.n) > payload.size()) {
+          c.ok = false;
+          break;
+        }
+        pattern_.row_ptr.resize(pattern_.n + 1);
+        pattern_.col.resize(nnz);
+        if(!delta) {
+          for(int64_t& v : pattern_.row_ptr) {
+            v = c.i64();
+          }
+          for(int64_t& v : pattern_.col) {
+            v = c.i64();
+          }
+        } else {
+          pattern_.row_ptr[0] = 0;
+          for(int64_t i = 0; i < pattern_.n; i++) {
+            pattern_.row_ptr[i + 1] = pattern_.row_ptr[i] + static_cast<int64_t>(c.varint());
+          }
+          if(pattern_.row_ptr[pattern_.n] != nnz) {
+            c.ok = false;
+            break;
+          }
+          for(int64_t i = 0; i < pattern_.n && c.ok; i++) {
+            int64_t prev = i;
+            for(int64_t k = pattern_.row_ptr[i]; k < pattern_.row_ptr[i + 1]; k++) {
+              pattern_.col[k] = prev + unzigzag(c.varint());
+              prev = pattern_.col[k];
+            }
+          }
+        }
+        has_pattern_ = c.ok;
+      } break;
+      case hiopKKTDumpWriter::kMatrix: {
+        if(!has_pattern_) {
+          error = "'" + path_ + "' has a matrix without pattern.";
+          return false;
+        }
+        sys.counter = c.i64();
+        sys.n = pattern_.n;
+        sys.nx = pattern_.nx;
+        sys.meq = pattern_.meq;
+        sys.mineq = pattern_.mineq;
+        sys.triangle = pattern_.triangle;
+        sys.row_ptr = pattern_.row_ptr;
+        sys.col = pattern_.col;
+        sys.vals.resize(sys.col.size());
+        c.doubles(sys.vals.data(), sys.vals.size(), delta, prev_[type]);
+        sys.rhs.clear();
+        sys.sol.clear();
+        has_matrix = true;
+      } break;
+      case hiopKKTDumpWriter::kRhs:
+      case hiopKKTDumpWriter::kSol: {
+        if(!has_matrix) {
+          error = "'" + path_ + "' has a right-hand side or solution without matrix.";
+          return false;
+        }
+        c.i64();
+        const int64_t n = c.i64();
+        if(n != sys.n) {
+          c.ok = false;
+          break;
+        }
+        std::vector<std::vector<double>>& vecs = hiopKKTDumpWriter::kRhs == type ? sys.rhs : sys.sol;
+        vecs.emplace_back(n);
+        c.doubles(vecs.back().data(), n, delta, prev_[type]);
+      } break;
+      default:
+        // unknown record types are skipped
+        break;
+    }
+    if(!c.ok) {
+      error = "'" + path_ + "' is corrupted.";
+      return false;
+    }
+  }
+}
+
+}  // namespace hiop
@@ -0,0 +1,284 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopKKTDump.hpp
+ *
+ * Binary, optionally compressed format for the KKT linear systems saved with the option `write_kkt`, its
+ * asynchronous writer, and its reader.
+ *
+ */
+
+#ifndef HIOP_KKT_DUMP
+#define HIOP_KKT_DUMP
+
+#include "hiop_defs.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hiop
+{
+
+/**
+ * Linear system read from a binary KKT dump: the matrix in CSR format (0-based indexes, one triangle for the
+ * symmetric KKT matrices) and the right-hand side-solution pairs of the solves done with it.
+ */
+struct hiopKKTDumpSystem
+{
+  /// Suffix passed by the KKT class, usually the index of the factorization
+  int64_t counter;
+  int64_t n;
+  int64_t nx;
+  int64_t meq;
+  int64_t mineq;
+  /// 'L' or 'U' for the lower or upper triangle, 'F' if the entries are not in one triangle
+  char triangle;
+  std::vector<int64_t> row_ptr;
+  std::vector<int64_t> col;
+  std::vector<double> vals;
+  std::vector<std::vector<double>> rhs;
+  std::vector<std::vector<double>> sol;
+};
+
+/**
+ * @brief Writes KKT linear systems to a binary file on a background thread.
+ *
+ * @details
+ * The file starts with the 8-byte magic "HIOPKKT" and the format version (uint32). It is followed by records
+ * made of the record type (uint8), the codec (uint8), the sizes (uint64) of the encoded and of the stored
+ * payload, and the payload. All integers and doubles are little-endian, independently of the host. The records
+ * are
+ *  - pattern: n, nx, meq, mineq, nnz (int64), dense flag and triangle (uint8), and, if not dense, the CSR row
+ * pointers and column indexes; a dense pattern is the upper triangle of the matrix, stored by rows;
+ *  - matrix: counter (int64) and the nonzeros in the order of the last pattern;
+ *  - rhs and solution: counter, size (int64) and the entries.
+ *
+ * The pattern is written only when it changes, so a sequence of KKT systems takes one pattern and one set of
+ * values per factorization. With the delta codec, the row pointers are stored as varint row counts, the
+ * column indexes as zigzag varint differences, and each double as the XOR with the same entry of the previous
+ * record of the same type, preceded by the number of its leading zero bytes, which are not written; values
+ * that do not change between iterations take one byte. When HiOp is built with zstd (HIOP_USE_ZSTD), the
+ * encoded payloads are additionally compressed.
+ *
+ * The calling thread only copies the values into a recycled buffer and queues them (and sorts the triplets
+ * once per pattern); the CSR permutation, encoding, compression, and writing are done by the background
+ * thread. The caller blocks only when the queued records exceed `max_queued_bytes`. The file is created by
+ * the first record and flushed after each record; the destructor writes the queued records and joins the
+ * thread.
+ */
+class hiopKKTDumpWriter
+{
+public:
+  /// Record types
+  enum
+  {
+    kPattern = 1,
+    kMatrix = 2,
+    kRhs = 3,
+    kSol = 4
+  };
+  /// Codec flags of a record
+  enum
+  {
+    kDelta = 1,
+    kZstd = 2
+  };
+
+  static const size_t max_queued_bytes = size_t(256) << 20;
+
+  hiopKKTDumpWriter(const std::string& path, bool compress);
+  ~hiopKKTDumpWriter();
+
+  /**
+   * Returns `prefix`.hkkt for the first writer of the process and `prefix`_k.hkkt for the k-th next one, so
+   * that the KKT systems of different solves (e.g., feasibility restoration) do not overwrite each other.
+   */
+  static std::string unique_path(const std::string& prefix);
+
+  /// True if the writers compress the records with zstd when asked to compress
+  static bool has_zstd();
+
+  /**
+   * Queues a sparse matrix given by `nnz` triplets. Duplicate entries are summed. The triangle stored by the
+   * triplets is detected when the pattern changes.
+   */
+  void write_matrix_triplet(int counter,
+                            int n,
+                            int nx,
+                            int meq,
+                            int mineq,
+                            int nnz,
+                            const int* irow,
+                            const int* jcol,
+                            const double* vals);
+
+  /// Queues the upper triangle of the `n`x`n` row-major dense matrix `M`
+  void write_matrix_dense(int counter, int n, int nx, int meq, int mineq, const double* M);
+
+  void write_rhs(int counter, int n, const double* rhs);
+
+  void write_sol(int counter, int n, const double* sol);
+
+  /**
+   * Blocks until the queued records are written. Returns false if any write failed since the previous call,
+   * in which case `errors` contains the description of the failures.
+   */
+  bool wait(std::string& errors);
+
+  /// Returns false and the description of the failed writes, if any, since the previous call; does not block
+  bool check_errors(std::string& errors);
+
+private:
+  struct Pattern
+  {
+    int64_t n;
+    int64_t nx;
+    int64_t meq;
+    int64_t mineq;
+    bool dense;
+    char triangle;
+    /// Triplets as passed by the caller, to detect changes of the pattern
+    std::vector<int> irow;
+    std::vector<int> jcol;
+    std::vector<int64_t> row_ptr;
+    std::vector<int64_t> col;
+    /// Position in the CSR arrays of each triplet
+    std::vector<int64_t> trip2csr;
+  };
+
+  struct Record
+  {
+    int type;
+    int64_t counter;
+    std::shared_ptr<const Pattern> pattern;
+    std::vector<double> data;
+  };
+
+  /// Returns a recycled buffer of size `n`
+  std::vector<double> acquire_buffer(size_t n);
+  void enqueue(Record&& rec);
+  void write_vector(int type, int counter, int n, const double* v);
+  void thread_loop();
+  /// Appends the payload of `rec` to `out`; runs on the background thread
+  void encode(const Record& rec, std::string& out);
+  void write_record(int type, const std::string& payload);
+
+private:
+  std::string path_;
+  bool compress_;
+  /// Last pattern queued, owned with the records that use it
+  std::shared_ptr<Pattern> pattern_;
+
+  /// State of the background thread: file, previous values of each record type (delta codec), scratch
+  FILE* file_;
+  bool failed_;
+  std::vector<double> prev_[5];
+  std::vector<double> csr_vals_;
+  std::string payload_;
+  std::string zbuf_;
+
+  std::deque<Record> queue_;
+  std::vector<std::vector<double>> free_buffers_;
+  size_t queued_bytes_;
+  bool busy_;
+  bool stop_;
+  std::string errors_;
+
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+private:
+  hiopKKTDumpWriter(const hiopKKTDumpWriter&) = delete;
+  hiopKKTDumpWriter& operator=(const hiopKKTDumpWriter&) = delete;
+};
+
+/**
+ * Reads the KKT linear systems of a file written by `hiopKKTDumpWriter`, one at a time.
+ */
+class hiopKKTDumpReader
+{
+public:
+  hiopKKTDumpReader();
+  ~hiopKKTDumpReader();
+
+  bool open(const std::string& path, std::string& error);
+
+  /**
+   * Reads the next matrix and the right-hand sides and solutions that follow it. Returns false at the end of
+   * the file, or on error, in which case `error` is not empty.
+   */
+  bool read_next(hiopKKTDumpSystem& sys, std::string& error);
+
+private:
+  /// Reads and decodes (except for the values) the payload of the next record; false at the end of the file
+  bool read_record(int& type, int& codec, std::string& payload, std::string& error);
+
+private:
+  std::string path_;
+  FILE* file_;
+  hiopKKTDumpSystem pattern_;
+  bool dense_;
+  bool has_pattern_;
+  /// Record read ahead by `read_next`, if `pending_type_` > 0
+  int pending_type_;
+  int pending_codec_;
+  std::string pending_payload_;
+  std::vector<double> prev_[5];
+};
+
+}  // namespace hiop
+#endif
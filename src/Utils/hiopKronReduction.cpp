@@ -2,18 +2,62 @@
 
 #include "hiopLinSolverUMFPACKZ.hpp"
 #include "hiopCppStdUtils.hpp"
+#include "hiopOMP.hpp"
+
+#include <algorithm>
 
 namespace hiop
 {
 
+namespace
+{
+/**
+ * Solves A*X=B in place (B is overwritten by X) by Gaussian elimination with partial pivoting. A is
+ * k x k and B is k x nrhs, both row-major. Used for the small systems of the low-rank updates.
+ */
+bool solve_small_dense(int k, std::vector<std::complex<double> >& A, std::vector<std::complex<double> >& B, int nrhs)
+{
+  for(int c = 0; c < k; c++) {
+    int piv = c;
+    for(int r = c + 1; r < k; r++) {
+      if(std::abs(A[r * k + c]) > std::abs(A[piv * k + c])) piv = r;
+    }
+    if(std::abs(A[piv * k + c]) == 0.) return false;
+    if(piv != c) {
+      for(int j = 0; j < k; j++) std::swap(A[c * k + j], A[piv * k + j]);
+      for(int j = 0; j < nrhs; j++) std::swap(B[c * nrhs + j], B[piv * nrhs + j]);
+    }
+    for(int r = c + 1; r < k; r++) {
+      const std::complex<double> f = A[r * k + c] / A[c * k + c];
+      for(int j = c; j < k; j++) A[r * k + j] -= f * A[c * k + j];
+      for(int j = 0; j < nrhs; j++) B[r * nrhs + j] -= f * B[c * nrhs + j];
+    }
+  }
+  for(int c = k - 1; c >= 0; c--) {
+    for(int j = 0; j < nrhs; j++) {
+      std::complex<double> acc = B[c * nrhs + j];
+      for(int i = c + 1; i < k; i++) acc -= A[c * k + i] * B[i * nrhs + j];
+      B[c * nrhs + j] = acc / A[c * k + c];
+    }
+  }
+  return true;
+}
+}  // namespace
+
 hiopKronReduction::hiopKronReduction()
     : linsolver_(NULL),
-      map_nonaux_to_aux_(NULL)
+      Ybb_(NULL),
+      map_nonaux_to_aux_(NULL),
+      map_base_(NULL),
+      Ybus_red_base_(NULL)
 {}
 hiopKronReduction::~hiopKronReduction()
 {
   delete linsolver_;
+  delete Ybb_;
   delete map_nonaux_to_aux_;
+  delete map_base_;
+  delete Ybus_red_base_;
 }
 
 bool hiopKronReduction::go(const std::vector<int>& idx_nonaux_buses,
@@ -36,12 +80,14 @@ bool hiopKronReduction::go(const std::vector<int>& idx_nonaux_buses,
 
   auto* Yba = Ybus.new_slice(idx_aux_buses.data(), idx_aux_buses.size(), idx_nonaux_buses.data(), idx_nonaux_buses.size());
 
-  if(NULL != linsolver_) {
-    assert(false);
-    delete linsolver_;
+  // the solver (and its symbolic analysis of Ybb) is kept from one reduction to the next
+  if(NULL == linsolver_) {
+    linsolver_ = new hiopLinSolverUMFPACKZ(*Ybb);
+  } else {
+    linsolver_->set_sys_mat(*Ybb);
   }
-
-  linsolver_ = new hiopLinSolverUMFPACKZ(*Ybb);
+  delete Ybb_;
+  Ybb_ = Ybb;
 
   int nret = linsolver_->matrixChanged();
   if(nret >= 0) {
@@ -50,17 +96,16 @@ bool hiopKronReduction::go(const std::vector<int>& idx_nonaux_buses,
     //
 
     // Ybb\Yba
-    // hiopMatrixComplexDense Ybbinv_Yba(Yba_->m(), Yba_->n());
-    assert(map_nonaux_to_aux_ == NULL);
-    delete map_nonaux_to_aux_;
-    map_nonaux_to_aux_ = new hiopMatrixComplexDense(Yba->m(), Yba->n());
+    if(NULL == map_nonaux_to_aux_ || map_nonaux_to_aux_->m() != Yba->m() || map_nonaux_to_aux_->n() != Yba->n()) {
+      delete map_nonaux_to_aux_;
+      map_nonaux_to_aux_ = new hiopMatrixComplexDense(Yba->m(), Yba->n());
+      delete map_base_;
+      map_base_ = new hiopMatrixComplexDense(Yba->m(), Yba->n());
+    }
     linsolver_->solve(*Yba, *map_nonaux_to_aux_);
 
     map_nonaux_to_aux_->negate();
     // Ybbinv_Yba.print();
-    delete Ybb;
-    delete linsolver_;
-    linsolver_ = NULL;
 
     // Ybus_red = - Yab*(Ybb\Yba)
     Yba->transTimesMat(0.0, Ybus_red, 1.0, *map_nonaux_to_aux_);
@@ -69,18 +114,167 @@ bool hiopKronReduction::go(const std::vector<int>& idx_nonaux_buses,
     Ybus_red.addSparseMatrix(std::complex<double>(1.0, 0.0), *Yaa);
     delete Yaa;
 
+    // keep the base case for `update`
+    map_base_->copyFrom(*map_nonaux_to_aux_);
+    if(NULL == Ybus_red_base_ || Ybus_red_base_->m() != Ybus_red.m() || Ybus_red_base_->n() != Ybus_red.n()) {
+      delete Ybus_red_base_;
+      Ybus_red_base_ = new hiopMatrixComplexDense(Ybus_red.m(), Ybus_red.n());
+    }
+    Ybus_red_base_->copyFrom(Ybus_red);
+
+    bus_pos_.assign(Ybus.m(), 0);
+    for(int i = 0; i < (int)idx_nonaux_buses.size(); i++) {
+      bus_pos_[idx_nonaux_buses[i]] = i;
+    }
+    for(int i = 0; i < (int)idx_aux_buses.size(); i++) {
+      bus_pos_[idx_aux_buses[i]] = -1 - i;
+    }
   } else {
     printf("Error occured while performing the Kron reduction (factorization issue)\n");
     delete linsolver_;
     linsolver_ = NULL;
+    delete Ybb_;
+    Ybb_ = NULL;
     delete Yaa;
-    delete Ybb;
     delete Yba;
     return false;
   }
   return true;
 }
 
+/**
+ * With Ybus' = Ybus + U*D*U^T, D=diag(dy), and U split in the non-auxiliary and auxiliary rows Ua and Ub,
+ * the Woodbury formula for Ybb' gives (using the symmetry of Ybus and map = -Ybb\Yba)
+ *   Ybus_red' = Ybus_red + Ut*K*Ut^T
+ *   map'      = map - Z*K*Ut^T
+ * where Z = Ybb\Ub, Ut = Ua + map^T*Ub, and K = (I + D*Ub^T*Z)^{-1}*D is small (nchanges x nchanges).
+ */
+bool hiopKronReduction::update(const std::vector<int>& from,
+                               const std::vector<int>& to,
+                               const std::vector<std::complex<double> >& dy,
+                               hiopMatrixComplexDense& Ybus_red)
+{
+  assert(from.size() == dy.size() && to.size() == dy.size());
+  if(NULL == linsolver_ || NULL == map_base_ || NULL == Ybus_red_base_) {
+    printf("Error: the Kron reduction of the base case is needed before updating it\n");
+    return false;
+  }
+  const int k = dy.size();
+  const int nb = map_base_->m();
+  const int na = map_base_->n();
+  assert(Ybus_red.m() == na && Ybus_red.n() == na);
+
+  std::complex<double>** Mbase = map_base_->get_M();
+  std::complex<double>** Mred_base = Ybus_red_base_->get_M();
+  std::complex<double>** M = map_nonaux_to_aux_->get_M();
+  std::complex<double>** Mred = Ybus_red.get_M();
+
+  // columns of Ua and Ub (column-major)
+  std::vector<std::complex<double> > Ua(static_cast<size_t>(na) * k, 0.);
+  std::vector<std::complex<double> > Ub(static_cast<size_t>(nb) * k, 0.);
+  auto add_incidence = [&](int bus, int j, double sign) {
+    assert(bus >= 0 && bus < (int)bus_pos_.size());
+    const int pos = bus_pos_[bus];
+    if(pos >= 0) {
+      Ua[j * na + pos] += sign;
+    } else {
+      Ub[j * nb + (-1 - pos)] += sign;
+    }
+  };
+  for(int j = 0; j < k; j++) {
+    add_incidence(from[j], j, 1.);
+    if(to[j] >= 0) {
+      add_incidence(to[j], j, -1.);
+    }
+  }
+
+  // Z = Ybb\Ub with the factorization of the base Ybb; Ut = Ua + map^T*Ub
+  std::vector<std::complex<double> > Z(static_cast<size_t>(nb) * k, 0.);
+  std::vector<std::complex<double> > Ut(Ua);
+  std::vector<int> cols_aux;
+  for(int j = 0; j < k; j++) {
+    bool touches_aux = false;
+    for(int i = 0; i < nb; i++) {
+      const std::complex<double> u = Ub[j * nb + i];
+      if(u != 0.) {
+        touches_aux = true;
+        for(int c = 0; c < na; c++) {
+          Ut[j * na + c] += Mbase[i][c] * u;
+        }
+      }
+    }
+    // branches between non-auxiliary buses do not need a solve
+    if(touches_aux) {
+      cols_aux.push_back(j);
+    }
+  }
+  // the columns of Ub that need a solve are packed and solved with one multiple right-hand sides call
+  if(!cols_aux.empty()) {
+    const int naux = cols_aux.size();
+    std::vector<std::complex<double> > Ub_aux(static_cast<size_t>(nb) * naux), Z_aux(static_cast<size_t>(nb) * naux);
+    for(int p = 0; p < naux; p++) {
+      std::copy(&Ub[cols_aux[p] * nb], &Ub[cols_aux[p] * nb] + nb, &Ub_aux[p * nb]);
+    }
+    if(!linsolver_->solve(Ub_aux.data(), Z_aux.data(), naux)) {
+      return false;
+    }
+    for(int p = 0; p < naux; p++) {
+      std::copy(&Z_aux[p * nb], &Z_aux[p * nb] + nb, &Z[cols_aux[p] * nb]);
+    }
+  }
+
+  // K = (I + D*Ub^T*Z)^{-1} * D (row-major)
+  std::vector<std::complex<double> > A(static_cast<size_t>(k) * k), K(static_cast<size_t>(k) * k, 0.);
+  for(int r = 0; r < k; r++) {
+    for(int c = 0; c < k; c++) {
+      std::complex<double> g = 0.;
+      for(int i = 0; i < nb; i++) {
+        g += Ub[r * nb + i] * Z[c * nb + i];
+      }
+      A[r * k + c] = (r == c ? 1. : 0.) + dy[r] * g;
+    }
+    K[r * k + r] = dy[r];
+  }
+  if(!solve_small_dense(k, A, K, k)) {
+    printf("Error: singular low-rank update in the Kron reduction\n");
+    return false;
+  }
+
+  // W = K*Ut^T (k x na, row-major)
+  std::vector<std::complex<double> > W(static_cast<size_t>(k) * na, 0.);
+  for(int r = 0; r < k; r++) {
+    for(int s = 0; s < k; s++) {
+      const std::complex<double> K_rs = K[r * k + s];
+      for(int c = 0; c < na; c++) {
+        W[r * na + c] += K_rs * Ut[s * na + c];
+      }
+    }
+  }
+
+  // Ybus_red' = Ybus_red + Ut*W and map' = map - Z*W
+  HIOP_OMP_PARFOR(static_cast<size_type>(na) * na * k)
+  for(int a = 0; a < na; a++) {
+    for(int c = 0; c < na; c++) {
+      std::complex<double> acc = Mred_base[a][c];
+      for(int r = 0; r < k; r++) {
+        acc += Ut[r * na + a] * W[r * na + c];
+      }
+      Mred[a][c] = acc;
+    }
+  }
+  HIOP_OMP_PARFOR(static_cast<size_type>(nb) * na * k)
+  for(int i = 0; i < nb; i++) {
+    for(int c = 0; c < na; c++) {
+      std::complex<double> acc = Mbase[i][c];
+      for(int r = 0; r < k; r++) {
+        acc -= Z[r * nb + i] * W[r * na + c];
+      }
+      M[i][c] = acc;
+    }
+  }
+  return true;
+}
+
 /**
  * Performs v_aux_out = (Ybb\Yba)* v_nonaux_in
  */
@@ -53,6 +53,7 @@
 #include "hiopMatrixComplexSparseTriplet.hpp"
 #include "hiopMatrixComplexDense.hpp"
 
+#include <complex>
 #include <string>
 #include <vector>
 #include <map>
@@ -81,13 +82,33 @@ public:
    *  - Ybus_red: reduced Ybus of size (nonaux,nonaux) = Yaa - Yab'*(Ybb\Yba)
    *
    * The function factorizes Ybb and stores the factorization for later use, for example for use
-   * in @axpy_nonaux_to_aux
+   * in @axpy_nonaux_to_aux and @update. The symbolic analysis of Ybb is reused by the subsequent
+   * calls as long as the sparsity pattern of Ybb does not change.
    */
   bool go(const std::vector<int>& idx_nonaux_buses,
           const std::vector<int>& idx_aux_buses,
           const hiopMatrixComplexSparseTriplet& Ybus,
           hiopMatrixComplexDense& Ybus_red);
 
+  /**
+   * Computes the Kron reduction of a variant of the Ybus passed to the last call to `go` in which the
+   * admittances of a few branches changed. The variant is Ybus + sum_k dy[k] * u_k * u_k^T, with
+   * u_k = e_from[k] - e_to[k], or u_k = e_from[k] for a shunt change (to[k] negative).
+   *
+   * The reduction is obtained by a low-rank (Sherman-Morrison-Woodbury) update of the reduction of the
+   * base Ybus, reusing the factorization of Ybb: it costs one solve with Ybb per changed branch (all in one
+   * multiple right-hand sides call) and O(nonaux^2 * nchanges) operations. The map used by
+   * `apply_nonaux_to_aux` is updated as well. The update is always relative to the base case of the last
+   * `go`, not to the previous update.
+   *
+   * Out parameters
+   *  - Ybus_red: reduced Ybus of the variant, of size (nonaux,nonaux)
+   */
+  bool update(const std::vector<int>& from,
+              const std::vector<int>& to,
+              const std::vector<std::complex<double> >& dy,
+              hiopMatrixComplexDense& Ybus_red);
+
   /**
    * Performs v_aux_out = (Ybb\Yba)* v_nonaux_in
    */
@@ -98,7 +119,13 @@ public:
 
 private:
   hiopLinSolverUMFPACKZ* linsolver_;
+  hiopMatrixComplexSparseTriplet* Ybb_;  // matrix factorized by linsolver_
   hiopMatrixComplexDense* map_nonaux_to_aux_;
+
+  // base case of `update`, computed by the last call to `go`
+  hiopMatrixComplexDense* map_base_;
+  hiopMatrixComplexDense* Ybus_red_base_;
+  std::vector<int> bus_pos_;  // position of each bus in idx_nonaux_buses (>=0) or idx_aux_buses (-1-position)
 };
 
 }  // namespace hiop
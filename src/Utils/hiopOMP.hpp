@@ -0,0 +1,220 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read “Additional BSD Notice” below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopOMP.hpp
+ *
+ * OpenMP helpers for HiOp's threaded host kernels (hiopVectorPar and hiopMatrixSparseTriplet). When
+ * HiOp is built without OpenMP (HIOP_USE_OPENMP not defined), the loop macros expand to nothing and
+ * the kernels run sequentially.
+ *
+ * The number of threads is a runtime setting (see option 'omp_num_threads'). Loops shorter than
+ * `omp::min_len_threaded` are not threaded since the fork-join overhead would not be amortized.
+ *
+ * Sum-reductions are performed over blocks of fixed length `omp::reduce_block_len` whose partial
+ * sums are then added in block order. The result depends only on the length of the data and not
+ * on the number of threads or on the scheduling, which makes norms and dot products reproducible
+ * from run to run.
+ */
+
+#pragma once
+
+#include "hiop_defs.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#ifdef HIOP_USE_OPENMP
+#include <omp.h>
+
+#define HIOP_PRAGMA(x) _Pragma(#x)
+
+/// Threaded and SIMD-vectorized loop over `n` elements
+#define HIOP_OMP_PARFOR_SIMD(n) \
+  HIOP_PRAGMA(omp parallel for simd schedule(static) if(hiop::omp::use_threads(n)) num_threads(hiop::omp::get_num_threads()))
+
+/// Threaded loop whose total work is proportional to `n` (e.g., the rows of a sparse matrix with `n` nonzeros)
+#define HIOP_OMP_PARFOR(n) \
+  HIOP_PRAGMA(omp parallel for schedule(static) if(hiop::omp::use_threads(n)) num_threads(hiop::omp::get_num_threads()))
+
+/// Threaded loop whose iterations have uneven costs adding up to a work proportional to `n`
+#define HIOP_OMP_PARFOR_DYNAMIC(n)                                                     \
+  HIOP_PRAGMA(omp parallel for schedule(dynamic, 16) if(hiop::omp::use_threads(n)) \
+                  num_threads(hiop::omp::get_num_threads()))
+
+/// Threaded and SIMD-vectorized loop over `n` elements with a (min, max, +, &&, ...) reduction on the variable(s)
+#define HIOP_OMP_PARFOR_SIMD_REDUCE(n, op, ...)                                                          \
+  HIOP_PRAGMA(omp parallel for simd schedule(static) reduction(op : __VA_ARGS__) if(hiop::omp::use_threads(n)) \
+                  num_threads(hiop::omp::get_num_threads()))
+
+/// SIMD-vectorized (not threaded) loop with a reduction on `var`; used inside the blocks of `omp::reduce_sum`
+#define HIOP_OMP_SIMD_REDUCE(op, var) HIOP_PRAGMA(omp simd reduction(op : var))
+#else
+#define HIOP_OMP_PARFOR_SIMD(n)
+#define HIOP_OMP_PARFOR(n)
+#define HIOP_OMP_PARFOR_DYNAMIC(n)
+#define HIOP_OMP_PARFOR_SIMD_REDUCE(n, op, ...)
+#define HIOP_OMP_SIMD_REDUCE(op, var)
+#endif
+
+namespace hiop
+{
+namespace omp
+{
+/// Loops shorter than this are executed by the calling thread only
+constexpr size_type min_len_threaded = 8192;
+
+/// Length of the blocks used by the deterministic sum-reductions
+constexpr size_type reduce_block_len = 4096;
+
+/**
+ * Requested number of threads; 0 means the default of the OpenMP runtime (e.g., OMP_NUM_THREADS).
+ * The setting is per calling thread, so that solvers running concurrently (see hiopBatchSolverMDS)
+ * do not change each other's setting.
+ */
+inline int& num_threads_requested()
+{
+  static thread_local int num_threads = 0;
+  return num_threads;
+}
+
+/// Sets the number of threads used by the host kernels; 0 restores the OpenMP runtime default
+inline void set_num_threads(int num_threads) { num_threads_requested() = num_threads >= 0 ? num_threads : 0; }
+
+/// Number of threads the host kernels will use (always 1 when HiOp is built without OpenMP)
+inline int get_num_threads()
+{
+#ifdef HIOP_USE_OPENMP
+  const int nt = num_threads_requested();
+  return nt > 0 ? nt : omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/// Whether a loop of length `n` should be threaded
+inline bool use_threads(size_type n) { return n >= min_len_threaded && get_num_threads() > 1; }
+
+/**
+ * Deterministic sum-reduction over `n` elements. `block_sum(begin, end)` should return the sum
+ * of the terms with indexes in [begin, end). The partial sums of the blocks are computed in
+ * parallel and added sequentially in block order.
+ *
+ * Without OpenMP, `block_sum` is called once over the whole range.
+ */
+template<typename BLOCKSUM>
+inline double reduce_sum(size_type n, const BLOCKSUM& block_sum)
+{
+#ifdef HIOP_USE_OPENMP
+  const size_type nblocks = (n + reduce_block_len - 1) / reduce_block_len;
+  if(nblocks <= 1) {
+    return block_sum(0, n);
+  }
+  std::vector<double> partial(nblocks);
+#pragma omp parallel for schedule(static) if(use_threads(n)) num_threads(get_num_threads())
+  for(size_type b = 0; b < nblocks; ++b) {
+    const size_type begin = b * reduce_block_len;
+    partial[b] = block_sum(begin, std::min(n, begin + reduce_block_len));
+  }
+  double sum = 0.;
+  for(size_type b = 0; b < nblocks; ++b) {
+    sum += partial[b];
+  }
+  return sum;
+#else
+  return block_sum(0, n);
+#endif
+}
+
+/**
+ * Deterministic two-norm over `n` elements. `block_norm(begin, end)` should return the two-norm of the terms
+ * with indexes in [begin, end) (e.g., computed by DNRM2). The norms of the blocks are computed in parallel and
+ * combined in block order relative to the largest of them, so that, as with DNRM2, the result does not overflow
+ * or underflow when the norm itself is representable.
+ *
+ * Without OpenMP, `block_norm` is called once over the whole range.
+ */
+template<typename BLOCKNORM>
+inline double reduce_norm2(size_type n, const BLOCKNORM& block_norm)
+{
+#ifdef HIOP_USE_OPENMP
+  const size_type nblocks = (n + reduce_block_len - 1) / reduce_block_len;
+  if(nblocks <= 1) {
+    return block_norm(0, n);
+  }
+  std::vector<double> partial(nblocks);
+#pragma omp parallel for schedule(static) if(use_threads(n)) num_threads(get_num_threads())
+  for(size_type b = 0; b < nblocks; ++b) {
+    const size_type begin = b * reduce_block_len;
+    partial[b] = block_norm(begin, std::min(n, begin + reduce_block_len));
+  }
+  double scale = 0.;
+  for(size_type b = 0; b < nblocks; ++b) {
+    scale = std::max(scale, partial[b]);
+  }
+  if(!(scale > 0.) || std::isinf(scale)) {
+    // zero, infinite, or NaN norms: the plain sum propagates them
+    double sum = 0.;
+    for(size_type b = 0; b < nblocks; ++b) {
+      sum += partial[b];
+    }
+    return sum;
+  }
+  double ssq = 0.;
+  for(size_type b = 0; b < nblocks; ++b) {
+    const double ratio = partial[b] / scale;
+    ssq += ratio * ratio;
+  }
+  return scale * std::sqrt(ssq);
+#else
+  return block_norm(0, n);
+#endif
+}
+
+}  // end of namespace omp
+}  // end of namespace hiop
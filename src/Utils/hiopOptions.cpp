@@ -827,6 +827,20 @@ void hiopOptionsNLP::register_options()
                         100,
                         "Max number of outer iterative refinement iterations (default 8). "
                         "Setting it to 0 deactivates the outer iterative refinement");
+
+    vector<string> range = {"bicgstab", "fgmres"};
+    register_str_option("ir_outer_solver",
+                        range[0],
+                        range,
+                        "Krylov method of the outer iterative refinement, preconditioned by the solve with the compressed "
+                        "system: 'bicgstab' (default) or 'fgmres', the restarted flexible GMRES, which usually needs fewer "
+                        "applications of the preconditioner on ill-conditioned systems.");
+
+    register_int_option("ir_outer_restart",
+                        20,
+                        1,
+                        100,
+                        "Restart length of the FGMRES outer iterative refinement (default 20).");
   }
 
   // relax bounds
@@ -900,6 +914,13 @@ void hiopOptionsNLP::register_options()
                         "uses Cholesky (available when no eq. constraints "
                         "are present). The last five options are available only with "
                         "'Hessian=analyticalExact'.");
+
+    vector<string> range_keep = {"no", "yes"};
+    register_str_option("keep_kkt",
+                        "no",
+                        range_keep,
+                        "Keep the KKT linear system, including the factorization of the linear solver, at the "
+                        "end of the solve for its reuse by 'resolve' (default 'no').");
   }
 
   //
@@ -930,6 +951,19 @@ void hiopOptionsNLP::register_options()
                         "sparse linear solves.");
   }
 
+  // choose the CPU dense linear solver for the MDS KKT systems
+  //  - 'ldlt': blocked bounded Bunch-Kaufman LDL^T (DSYTRF_RK) with cached workspace and multi-rhs solves
+  //  - 'lapack': LAPACK's DSYTRF/DSYTRS
+  {
+    vector<string> range{"ldlt", "lapack"};
+
+    register_str_option("linear_solver_dense",
+                        "ldlt",
+                        range,
+                        "Selects among the LDLT and LAPACK dense symmetric indefinite solvers for the MDS KKT on "
+                        "the CPU.");
+  }
+
   // choose linear solver for duals intializations for sparse NLP problems
   //  - when only CPU is used (compute_mode is cpu or HIOP_USE_GPU is off), MA57 is chosen by 'auto'
   //  - when GPU mode is on, STRUMPACK is chosen by 'auto' if available
@@ -1136,6 +1170,19 @@ void hiopOptionsNLP::register_options()
                         "KKT solve process");
   }
 
+  // trace of the solver phases with begin/end timestamps
+  {
+    vector<string> range{"no", "yes"};
+    register_str_option("profile_trace",
+                        "no",
+                        range,
+                        "Record the solver phases and write them as Chrome trace and CSV files at the end of the "
+                        "solve (see 'profile_trace_file').");
+    register_str_option("profile_trace_file",
+                        "hiop_trace",
+                        "Path of the trace files without extension; '.json' and '.csv' are appended.");
+  }
+
   // elastic mode
   {
     vector<string> range = {"none", "tighten_bound", "correct_it", "correct_it_adjust_bound"};
@@ -1185,6 +1232,16 @@ void hiopOptionsNLP::register_options()
                         range[0],
                         range,
                         "write internal KKT linear system (matrix, rhs, sol) to file (default 'no')");
+    register_str_option("write_kkt_format",
+                        "iajaaa",
+                        vector<string>({"iajaaa", "binary"}),
+                        "format of the KKT linear systems written with 'write_kkt': one text file per system "
+                        "or one binary file written by a background thread (default 'iajaaa')");
+    register_str_option("write_kkt_compression",
+                        "yes",
+                        vector<string>({"yes", "no"}),
+                        "compress the binary KKT linear systems with delta encoding, and zstd if available "
+                        "(default 'yes')");
     register_str_option("print_options",
                         "no",                                    // default value for the option
                         vector<string>({"yes", "no", "short"}),  // range
@@ -1209,6 +1266,32 @@ void hiopOptionsNLP::register_options()
                         range[0],
                         range,
                         "Determines the memory space to which HiOp will return the solutions. By default,");
+    register_str_option("iterate_full_callback",
+                        "no",
+                        vector<string>({"no", "yes"}),
+                        "Calls the user's iterate_full_callback at each iteration, after iterate_callback, with all "
+                        "the internal iterates (default 'no')");
+  }
+
+  // host threading
+  {
+    register_int_option("omp_num_threads",
+                        0,
+                        0,
+                        4096,
+                        "Number of OpenMP threads used by HiOp's host linear algebra kernels (hiopVectorPar). The "
+                        "value 0 uses the default of the OpenMP runtime (e.g., OMP_NUM_THREADS) and 1 runs the "
+                        "kernels sequentially. Has no effect when HiOp is built without OpenMP (default 0).");
+  }
+
+  // compressed sparsity index for the products with the (host) sparse Jacobians and Hessian
+  {
+    register_str_option("sparse_compressed_spmv",
+                        "no",
+                        vector<string>({"yes", "no"}),
+                        "Keep a CSR and CSC index of the sparsity patterns of the Jacobians and of the Hessian of the "
+                        "Lagrangian and use row-wise (threaded with OpenMP) matrix-vector products for sparse NLPs "
+                        "in the 'default' memory space (default 'no').");
   }
 
   // compute mode
@@ -1552,23 +1635,9 @@ void hiopOptionsNLP::ensure_consistence()
     set_val("moving_lim_rel", 0.);
   }
 
-#ifndef HIOP_USE_AXOM
-  const vector<string> chkpnt_opts = {"checkpoint_save",
-                                      "checkpoint_save_every_N_iter",
-                                      "checkpoint_file",
-                                      "checkpoint_load_on_start"};
-  for(string opt: chkpnt_opts) {
-    if(is_user_defined(opt.c_str())) {
-      log_printf(hovWarning,
-                 "Checkpointing not available since HiOp was not built with AXOM. All checkpointing options "
-                 "are ignored.\n");
-      // reset them to as not being user defined to avoid triggering the message.
-      for(auto opt2: chkpnt_opts) {
-        mOptions_[opt2]->specifiedInFile = false;
-        mOptions_[opt2]->specifiedAtRuntime = false;
-      }
-      break;
-    }
+#ifndef HIOP_USE_OPENMP
+  if(is_user_defined("omp_num_threads")) {
+    log_printf(hovWarning, "option omp_num_threads has no effect since HiOp was not built with OpenMP.\n");
   }
 #endif
 }
@@ -1627,6 +1696,43 @@ void hiopOptionsPriDec::register_options()
                         "Accumulates recourse problem solutions locally on evaluator ranks (default 'false')");
   }
 
+  // number of threads evaluating concurrently the recourse terms on each evaluator rank
+  {
+    register_int_option("recourse_num_threads",
+                        1,
+                        0,
+                        4096,
+                        "Number of threads each evaluator rank uses to evaluate recourse terms concurrently; the "
+                        "master rank sends the contingencies to an evaluator in batches of this size. 0 uses the "
+                        "OpenMP default. Values other than 1 require thread-safe 'eval_f_rterm' and 'eval_grad_rterm'. "
+                        "Has no effect when HiOp is built without OpenMP (default 1)");
+  }
+
+  // scheduling of the contingencies on the evaluator ranks
+  {
+    register_str_option("recourse_schedule",
+                        "fixed",
+                        vector<string>({"fixed", "guided"}),
+                        "Size of the batches of contingencies sent to the evaluator ranks: 'fixed' sends as many "
+                        "contingencies as the rank has threads, 'guided' sends larger batches at the start of the "
+                        "iteration and smaller ones towards the end, based on the solve times measured at the "
+                        "previous iteration (default 'fixed')");
+
+    register_str_option("recourse_order",
+                        "index",
+                        vector<string>({"index", "expensive_first"}),
+                        "Order in which the contingencies are sent to the evaluator ranks: 'index' or "
+                        "'expensive_first', which uses the solve times measured at the previous iteration "
+                        "(default 'index')");
+
+    register_str_option("recourse_warm_start",
+                        "no",
+                        vector<string>({"no", "yes"}),
+                        "Keep the recourse solutions of each rank to warm start the recourse solves at the next "
+                        "iteration and send a contingency to the rank that solved it at the previous iteration "
+                        "when possible (default 'no')");
+  }
+
   //
   // convergence and stopping criteria
   //
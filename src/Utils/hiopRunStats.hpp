@@ -50,6 +50,7 @@
 #define HIOP_RUNSTATS
 
 #include "hiopTimer.hpp"
+#include "hiopTrace.hpp"
 
 #include <sstream>
 #include <iomanip>
@@ -84,6 +85,13 @@ public:
    */
   hiopTimer tmUpdateLinsys;
 
+  /**
+   * Records time spent copying the Hessian and Jacobian blocks into the linsys at current iteration (part of
+   * `tmUpdateLinsys`). KKT classes that assemble the linsys incrementally do this once per iteration, with the
+   * inertia correction or regularization trials only updating the diagonal entries.
+   */
+  hiopTimer tmUpdateLinsysBlocks;
+
   /**
    * Records time spent in lower level factorizations at current iteration. Multiple factorizations can occur if the inertia
    * correction or regularization procedures kick in.
@@ -116,7 +124,8 @@ public:
   hiopTimer tmSolveInner;
 
   /**
-   * Records the number of inner iterative refinement solve iterations. Can be a fractional number for BiCGStab.
+   * Records the number of inner iterative refinement solve iterations. Can be a fractional number for BiCGStab. For
+   * FGMRES, it is the number of applications of the preconditioner.
    * Should be zero if a direct linear solvers is used without IR done explicitly by HiOp.
    */
   double nIterRefinInner;
@@ -137,6 +146,8 @@ public:
   double tmTotalUpdateInit;
   /// Total time recorded by `tmUpdateLinsys`
   double tmTotalUpdateLinsys;
+  /// Total time recorded by `tmUpdateLinsysBlocks`
+  double tmTotalUpdateLinsysBlocks;
   /// Total time recorded by `tmUpdateInnerFact`
   double tmTotalUpdateInnerFact;
   /// Total time recorded by `tmSolveRhsManip`
@@ -153,6 +164,7 @@ public:
     tmTotalPerIter.reset();
     tmUpdateInit.reset();
     tmUpdateLinsys.reset();
+    tmUpdateLinsysBlocks.reset();
     tmUpdateInnerFact.reset();
     nUpdateICCorr = 0;
     tmSolveRhsManip.reset();
@@ -163,6 +175,7 @@ public:
     tmTotal = 0.;
     tmTotalUpdateInit = 0.;
     tmTotalUpdateLinsys = 0.;
+    tmTotalUpdateLinsysBlocks = 0.;
     tmTotalUpdateInnerFact = 0.;
     tmTotalSolveRhsManip = 0.;
     tmTotalSolveInner = 0.;
@@ -177,6 +190,7 @@ public:
 
     tmUpdateInit.reset();
     tmUpdateLinsys.reset();
+    tmUpdateLinsysBlocks.reset();
     tmUpdateInnerFact.reset();
     nUpdateICCorr = 0;
     tmSolveRhsManip.reset();
@@ -191,6 +205,7 @@ public:
 
     tmTotalUpdateInit += tmUpdateInit.getElapsedTime();
     tmTotalUpdateLinsys += tmUpdateLinsys.getElapsedTime();
+    tmTotalUpdateLinsysBlocks += tmUpdateLinsysBlocks.getElapsedTime();
     tmTotalUpdateInnerFact += tmUpdateInnerFact.getElapsedTime();
     tmTotalSolveRhsManip += tmSolveRhsManip.getElapsedTime();
     tmTotalSolveInner += tmSolveInner.getElapsedTime();
@@ -205,7 +220,8 @@ public:
     ss << "Iteration KKT time " << tmTotalPerIter.getElapsedTime() << "s  " << std::endl;
 
     ss << "\tupdate init " << std::setprecision(3) << tmUpdateInit.getElapsedTime() << "s  "
-       << "update linsys " << tmUpdateLinsys.getElapsedTime() << "s  "
+       << "update linsys " << tmUpdateLinsys.getElapsedTime() << "s (blocks " << tmUpdateLinsysBlocks.getElapsedTime()
+       << "s)  "
        << "fact " << tmUpdateInnerFact.getElapsedTime() << "s  "
        << "inertia corrections " << nUpdateICCorr << std::endl;
 
@@ -223,7 +239,7 @@ public:
     ss << "Total KKT time " << std::fixed << std::setprecision(3) << tmTotal << "s  " << std::endl;
 
     ss << "\tupdate init " << std::setprecision(3) << tmTotalUpdateInit << "s  "
-       << "   update linsys " << tmTotalUpdateLinsys << "s  "
+       << "   update linsys " << tmTotalUpdateLinsys << "s (blocks " << tmTotalUpdateLinsysBlocks << "s)  "
        << "   fact " << tmTotalUpdateInnerFact << "s  " << std::endl;
 
     ss << "\tsolve rhs-manip " << tmTotalSolveRhsManip << "s  "
@@ -305,6 +321,7 @@ public:
 #endif
   {
     initialize();
+    attach_trace();
   };
 
   virtual ~hiopRunStats() {};
@@ -322,6 +339,10 @@ public:
 
   hiopRunKKTSolStats kkt;
   hiopLinSolStats linsolv;
+
+  /// Trace of the phases timed by the above timers; enabled by the 'profile_trace' option
+  hiopTrace trace;
+
   inline virtual void initialize()
   {
     tmOptimizTotal = tmSolverInternal = tmSearchDir = tmStartingPoint = tmMultUpdate = tmComm = tmInit = 0.;
@@ -334,6 +355,9 @@ public:
   inline std::string get_summary(int masterRank = 0)
   {
     std::stringstream ss;
+#ifndef HIOP_WITH_TIMERS
+    ss << "(timers disabled: HiOp was built with HIOP_WITH_TIMERS=OFF)" << std::endl;
+#endif
     ss << "Total time " << std::fixed << std::setprecision(3) << tmOptimizTotal.getElapsedTime() << "s  " << std::endl;
 
     ss << "Hiop internal time: " << std::setprecision(3) << "    total " << std::setprecision(3)
@@ -390,8 +414,33 @@ public:
     return ss.str();
   }
 
-#ifdef HIOP_USE_MPI
 private:
+  /// Attaches the timers of the solver phases to `trace`
+  inline void attach_trace()
+  {
+    tmOptimizTotal.trace_as(&trace, "optimization");
+    tmStartingPoint.trace_as(&trace, "starting point");
+    tmEvalObj.trace_as(&trace, "eval_f");
+    tmEvalGrad_f.trace_as(&trace, "eval_grad_f");
+    tmEvalCons.trace_as(&trace, "eval_cons");
+    tmEvalJac_con.trace_as(&trace, "eval_Jac_cons");
+    tmEvalHessL.trace_as(&trace, "eval_Hess_Lagr");
+
+    kkt.tmUpdateInit.trace_as(&trace, "KKT update init");
+    kkt.tmUpdateLinsys.trace_as(&trace, "KKT update linsys");
+    kkt.tmUpdateLinsysBlocks.trace_as(&trace, "KKT update blocks");
+    kkt.tmUpdateInnerFact.trace_as(&trace, "KKT factorization");
+    kkt.tmSolveRhsManip.trace_as(&trace, "KKT rhs manip");
+    kkt.tmSolveInner.trace_as(&trace, "KKT inner solve (IR)");
+    kkt.tmResid.trace_as(&trace, "KKT residual");
+
+    linsolv.tmFactTime.trace_as(&trace, "linsolver factorization");
+    linsolv.tmInertiaComp.trace_as(&trace, "linsolver inertia");
+    linsolv.tmTriuSolves.trace_as(&trace, "linsolver triangular solves");
+    linsolv.tmDeviceTransfer.trace_as(&trace, "linsolver device transfer");
+  }
+
+#ifdef HIOP_USE_MPI
   MPI_Comm comm;
 #endif
 };
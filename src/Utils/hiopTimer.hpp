@@ -49,46 +49,90 @@
 #ifndef HIOP_TIMER
 #define HIOP_TIMER
 
-#ifdef HIOP_USE_MPI
-#include "mpi.h"
-#else
-#include <sys/time.h>
-#endif
+/**
+ * @file hiopTimer.hpp
+ *
+ * Timers of HiOp. The times are taken from a monotonic clock (std::chrono::steady_clock), which is not
+ * affected by adjustments of the system time. When HiOp is built with HIOP_WITH_TIMERS off, the timers
+ * compile to nothing and report zero times.
+ *
+ * - hiopTimer accumulates the time between `start` and `stop` calls made by one thread;
+ * - hiopTimerScope is a RAII guard for a hiopTimer, which can be nested (also recursively);
+ * - hiopTimerPerThread accumulates the time of each OpenMP thread separately, for threaded code;
+ * - hiopStopwatch is always on, regardless of HIOP_WITH_TIMERS, for the timings of drivers and benchmarks.
+ */
+
+#include "hiop_defs.hpp"
+#include "hiopMPI.hpp"
+#include "hiopOMP.hpp"
 
 #include <cassert>
+#include <chrono>
+#include <memory>  // std::align
+#include <new>
+#include <vector>
 
 // to do: sys time: getrusage(RUSAGE_SELF,&usage);
 
 namespace hiop
 {
 
+class hiopTrace;
+
+/// Records the span [t_start, t_end] of the phase `name` in `trace` (see hiopTrace.cpp)
+void hiop_trace_record(hiopTrace& trace, const char* name, double t_start, double t_end);
+
 class hiopTimer
 {
 public:
   hiopTimer()
       : tmElapsed(0.0),
-        tmStart(0.0) {};
+        tmStart(0.0),
+        depth_(0),
+        trace_(nullptr),
+        trace_name_(nullptr) {};
+
+  /// Copies the times only; the copy is not attached to a trace
+  hiopTimer(const hiopTimer& other)
+      : tmElapsed(other.tmElapsed),
+        tmStart(other.tmStart),
+        depth_(0),
+        trace_(nullptr),
+        trace_name_(nullptr)
+  {}
+
+  /// Copies the times only; `this` remains attached to its own trace, if any
+  inline hiopTimer& operator=(const hiopTimer& other)
+  {
+    tmElapsed = other.tmElapsed;
+    tmStart = other.tmStart;
+    return *this;
+  }
+
+  /// Returns the time in seconds from the monotonic clock used by the timers (the origin is arbitrary)
+  static inline double wall_time()
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
 
   // returns the elapsed time (accumulated between start/stop) in seconds
   inline double getElapsedTime() const { return tmElapsed; }
 
   inline void start()
   {
-#ifdef HIOP_USE_MPI
-    tmStart = MPI_Wtime();
-#else
-    gettimeofday(&tv, NULL);
-    tmStart = (static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1000000.0);
+#ifdef HIOP_WITH_TIMERS
+    tmStart = wall_time();
 #endif
   }
 
   inline void stop()
   {
-#ifdef HIOP_USE_MPI
-    tmElapsed += (MPI_Wtime() - tmStart);
-#else
-    gettimeofday(&tv, NULL);
-    tmElapsed += (static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1000000.0 - tmStart);
+#ifdef HIOP_WITH_TIMERS
+    const double tm_stop = wall_time();
+    tmElapsed += (tm_stop - tmStart);
+    if(trace_) {
+      hiop_trace_record(*trace_, trace_name_, tmStart, tm_stop);
+    }
 #endif
   }
 
@@ -105,14 +149,212 @@ public:
     return *this;
   }
 
+  /**
+   * Each start/stop interval of the timer will be recorded as an event named `name` in `trace` (when the
+   * trace is enabled). `name` should be a string literal.
+   */
+  inline void trace_as(hiopTrace* trace, const char* name)
+  {
+    trace_ = trace;
+    trace_name_ = name;
+  }
+
 private:
+  friend class hiopTimerScope;
+
   double tmElapsed;  // in seconds
   double tmStart;
 
-#ifdef HIOP_USE_MPI
+  /// Number of active hiopTimerScope guards
+  int depth_;
+
+  hiopTrace* trace_;
+  const char* trace_name_;
+};
+
+/**
+ * Accumulates the time between `start` and `stop` calls made by one thread. Unlike hiopTimer, it is not
+ * compiled out when HiOp is built with HIOP_WITH_TIMERS off, hence it is used for the times reported by
+ * drivers and benchmarks.
+ */
+class hiopStopwatch
+{
+public:
+  hiopStopwatch()
+      : elapsed_(0.),
+        start_(0.)
+  {}
+
+  inline void start() { start_ = hiopTimer::wall_time(); }
+
+  inline void stop() { elapsed_ += hiopTimer::wall_time() - start_; }
+
+  inline void reset()
+  {
+    elapsed_ = 0.;
+    start_ = 0.;
+  }
+
+  /// Accumulated time in seconds
+  inline double getElapsedTime() const { return elapsed_; }
+
+private:
+  double elapsed_;
+  double start_;
+};
+
+/**
+ * Starts the timer on construction and stops it on destruction, also when the scope is left early by a
+ * return or an exception. Guards of the same timer can be nested: only the outermost one starts and
+ * stops the timer, so that the time of a recursive or nested scope is not counted twice.
+ */
+class hiopTimerScope
+{
+public:
+  explicit hiopTimerScope(hiopTimer& timer)
+      : timer_(timer)
+  {
+    if(0 == timer_.depth_++) {
+      timer_.start();
+    }
+  }
+  ~hiopTimerScope()
+  {
+    if(0 == --timer_.depth_) {
+      timer_.stop();
+    }
+  }
+
+private:
+  hiopTimerScope(const hiopTimerScope&) = delete;
+  hiopTimerScope& operator=(const hiopTimerScope&) = delete;
+
+  hiopTimer& timer_;
+};
+
+/**
+ * Accumulates times separately for each OpenMP thread, with no synchronization between the threads. A
+ * thread calls `start` and `stop` (or uses a hiopTimerPerThread::Scope) inside a parallel region; the times
+ * are read after the region. Without OpenMP, it behaves as a single hiopTimer.
+ */
+class hiopTimerPerThread
+{
+public:
+  explicit hiopTimerPerThread(int num_threads = 0)
+      : slots_(nullptr),
+        num_slots_(0)
+  {
+    reset(num_threads);
+  }
+
+  /// Zeros the times; `num_threads` is the largest number of threads that will use the timer (0 for the default)
+  inline void reset(int num_threads = 0)
+  {
+    if(num_threads <= 0) {
+      num_threads = omp::get_num_threads();
+    }
+    // std::vector does not align the slots to cache lines before C++17, hence the slots are placed in a byte
+    // buffer with room for the alignment
+    num_slots_ = num_threads;
+    storage_.assign((num_slots_ + 1) * sizeof(Slot), 0);
+    void* ptr = storage_.data();
+    size_t space = storage_.size();
+    slots_ = static_cast<Slot*>(std::align(alignof(Slot), num_slots_ * sizeof(Slot), ptr, space));
+    assert(slots_);
+    for(int i = 0; i < num_slots_; ++i) {
+      new(slots_ + i) Slot();
+    }
+  }
+
+  inline void start()
+  {
+#ifdef HIOP_WITH_TIMERS
+    slot().start = hiopTimer::wall_time();
+#endif
+  }
+
+  inline void stop()
+  {
+#ifdef HIOP_WITH_TIMERS
+    Slot& s = slot();
+    s.elapsed += hiopTimer::wall_time() - s.start;
+#endif
+  }
+
+  inline int get_num_threads() const { return num_slots_; }
+
+  /// Time accumulated by thread `tid`
+  inline double get_elapsed_time(int tid) const { return slots_[tid].elapsed; }
+
+  /// Largest time accumulated by a thread, which is the time of the threaded code when the threads are busy
+  inline double get_max_time() const
+  {
+    double tm = 0.;
+    for(int i = 0; i < num_slots_; ++i) {
+      tm = tm > slots_[i].elapsed ? tm : slots_[i].elapsed;
+    }
+    return tm;
+  }
+
+  /// Sum of the times of the threads
+  inline double get_total_time() const
+  {
+    double tm = 0.;
+    for(int i = 0; i < num_slots_; ++i) {
+      tm += slots_[i].elapsed;
+    }
+    return tm;
+  }
+
+  /// RAII guard timing a scope of the calling thread
+  class Scope
+  {
+  public:
+    explicit Scope(hiopTimerPerThread& timer)
+        : timer_(timer)
+    {
+      timer_.start();
+    }
+    ~Scope() { timer_.stop(); }
+
+  private:
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    hiopTimerPerThread& timer_;
+  };
+
+private:
+  hiopTimerPerThread(const hiopTimerPerThread&) = delete;
+  hiopTimerPerThread& operator=(const hiopTimerPerThread&) = delete;
+
+  /// Aligned to a cache line so that the threads do not write to the same line
+  struct alignas(64) Slot
+  {
+    Slot()
+        : elapsed(0.),
+          start(0.)
+    {}
+    double elapsed;
+    double start;
+  };
+
+  inline Slot& slot()
+  {
+#ifdef HIOP_USE_OPENMP
+    const int tid = omp_get_thread_num();
 #else
-  struct timeval tv;
+    const int tid = 0;
 #endif
+    assert(tid < num_slots_ && "more threads than the ones the timer was reset for");
+    return slots_[tid];
+  }
+
+  /// Bytes holding the slots
+  std::vector<unsigned char> storage_;
+  Slot* slots_;
+  int num_slots_;
 };
+
 }  // namespace hiop
 #endif
@@ -0,0 +1,182 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopTrace.cpp
+ *
+ * Event trace of the solver phases, exported as a Chrome trace (JSON) and as CSV.
+ *
+ */
+
+#include "hiopTrace.hpp"
+
+#include <cstdio>
+
+namespace hiop
+{
+
+void hiop_trace_record(hiopTrace& trace, const char* name, double t_start, double t_end)
+{
+  trace.record(name, t_start, t_end);
+}
+
+void hiopTrace::start(MPI_Comm comm)
+{
+  comm_ = comm;
+  rank_ = 0;
+#ifdef HIOP_USE_MPI
+  int ierr = MPI_Comm_rank(comm_, &rank_);
+  assert(MPI_SUCCESS == ierr);
+  // the ranks leave the barrier at about the same time, which aligns their time origins
+  ierr = MPI_Barrier(comm_);
+  assert(MPI_SUCCESS == ierr);
+#endif
+  events_.clear();
+  iter_ = -1;
+  tm_origin_ = hiopTimer::wall_time();
+  enabled_ = true;
+}
+
+void hiopTrace::serialize(std::string& json, std::string& csv) const
+{
+  char buf[512];
+  for(const Event& e: events_) {
+    const double ts = 1e6 * (e.t_start - tm_origin_);
+    const double dur = 1e6 * (e.t_end - e.t_start);
+    snprintf(buf,
+             sizeof(buf),
+             "{\"name\":\"%s\",\"cat\":\"hiop\",\"ph\":\"X\",\"pid\":%d,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,"
+             "\"args\":{\"iter\":%d}},\n",
+             e.name,
+             rank_,
+             ts,
+             dur,
+             e.iter);
+    json += buf;
+    snprintf(buf, sizeof(buf), "%d,%d,%s,%.3f,%.3f\n", rank_, e.iter, e.name, ts, dur);
+    csv += buf;
+  }
+}
+
+#ifdef HIOP_USE_MPI
+/// Concatenates the strings of all ranks on rank 0
+static void gather_strings(const std::string& loc, std::string& all, MPI_Comm comm)
+{
+  int rank, num_ranks;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+  int len = static_cast<int>(loc.size());
+  std::vector<int> lens(num_ranks), displs(num_ranks, 0);
+  MPI_Gather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, 0, comm);
+  if(0 == rank) {
+    for(int r = 1; r < num_ranks; ++r) {
+      displs[r] = displs[r - 1] + lens[r - 1];
+    }
+    all.resize(displs[num_ranks - 1] + lens[num_ranks - 1]);
+  }
+  MPI_Gatherv(loc.data(), len, MPI_CHAR, &all[0], lens.data(), displs.data(), MPI_CHAR, 0, comm);
+}
+#endif
+
+bool hiopTrace::write(const std::string& path, std::string& errors) const
+{
+  std::string json, csv;
+  serialize(json, csv);
+#ifdef HIOP_USE_MPI
+  int num_ranks;
+  MPI_Comm_size(comm_, &num_ranks);
+  if(num_ranks > 1) {
+    std::string json_all, csv_all;
+    gather_strings(json, json_all, comm_);
+    gather_strings(csv, csv_all, comm_);
+    json.swap(json_all);
+    csv.swap(csv_all);
+  }
+#else
+  const int num_ranks = 1;
+#endif
+
+  bool bret = true;
+  if(0 == rank_) {
+    const std::string path_json = path + ".json";
+    FILE* f = fopen(path_json.c_str(), "w");
+    if(nullptr == f) {
+      errors += "could not open '" + path_json + "' for writing\n";
+      bret = false;
+    } else {
+      fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+      for(int r = 0; r < num_ranks; ++r) {
+        fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"rank %d\"}},\n", r, r);
+      }
+      fwrite(json.data(), 1, json.size(), f);
+      // the last element closes the list without a trailing comma
+      fprintf(f, "{\"name\":\"trace_end\",\"ph\":\"M\",\"pid\":0,\"args\":{}}\n]}\n");
+      if(fclose(f)) {
+        errors += "error while writing '" + path_json + "'\n";
+        bret = false;
+      }
+    }
+
+    const std::string path_csv = path + ".csv";
+    f = fopen(path_csv.c_str(), "w");
+    if(nullptr == f) {
+      errors += "could not open '" + path_csv + "' for writing\n";
+      bret = false;
+    } else {
+      fprintf(f, "rank,iter,phase,start_us,duration_us\n");
+      fwrite(csv.data(), 1, csv.size(), f);
+      if(fclose(f)) {
+        errors += "error while writing '" + path_csv + "'\n";
+        bret = false;
+      }
+    }
+  }
+  return bret;
+}
+
+}  // namespace hiop
@@ -0,0 +1,175 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory (LLNL).
+// Written by Cosmin G. Petra, petra1@llnl.gov.
+// LLNL-CODE-742473. All rights reserved.
+//
+// This file is part of HiOp. For details, see https://github.com/LLNL/hiop. HiOp
+// is released under the BSD 3-clause license (https://opensource.org/licenses/BSD-3-Clause).
+// Please also read "Additional BSD Notice" below.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// i. Redistributions of source code must retain the above copyright notice, this list
+// of conditions and the disclaimer below.
+// ii. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the disclaimer (as noted below) in the documentation and/or
+// other materials provided with the distribution.
+// iii. Neither the name of the LLNS/LLNL nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL LAWRENCE LIVERMORE NATIONAL SECURITY, LLC, THE U.S. DEPARTMENT OF ENERGY OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+// AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Additional BSD Notice
+// 1. This notice is required to be provided under our contract with the U.S. Department
+// of Energy (DOE). This work was produced at Lawrence Livermore National Laboratory under
+// Contract No. DE-AC52-07NA27344 with the DOE.
+// 2. Neither the United States Government nor Lawrence Livermore National Security, LLC
+// nor any of their employees, makes any warranty, express or implied, or assumes any
+// liability or responsibility for the accuracy, completeness, or usefulness of any
+// information, apparatus, product, or process disclosed, or represents that its use would
+// not infringe privately-owned rights.
+// 3. Also, reference herein to any specific commercial products, process, or services by
+// trade name, trademark, manufacturer or otherwise does not necessarily constitute or
+// imply its endorsement, recommendation, or favoring by the United States Government or
+// Lawrence Livermore National Security, LLC. The views and opinions of authors expressed
+// herein do not necessarily state or reflect those of the United States Government or
+// Lawrence Livermore National Security, LLC, and shall not be used for advertising or
+// product endorsement purposes.
+
+/**
+ * @file hiopTrace.hpp
+ *
+ * Event trace of the solver phases, exported as a Chrome trace (JSON) and as CSV.
+ *
+ */
+
+#ifndef HIOP_TRACE
+#define HIOP_TRACE
+
+#include "hiopMPI.hpp"
+#include "hiopTimer.hpp"
+
+#include <string>
+#include <vector>
+
+namespace hiop
+{
+
+/**
+ * Records begin/end timestamps of the solver phases (function evaluations, KKT updates, factorizations,
+ * triangular solves, line search trials, etc.) together with the optimization iteration at which they occur.
+ *
+ * The events are recorded by `hiopTimer`s attached to the trace via `hiopTimer::trace_as` and by
+ * `hiopTraceSpan` scopes, and only while the trace is enabled (between `start` and `stop`). The events of
+ * all MPI ranks are written by `write` in the Chrome trace event format, which can be loaded in
+ * chrome://tracing or https://ui.perfetto.dev (one process per MPI rank), and as a CSV file with one event
+ * per line. Timestamps are in microseconds since `start`, which synchronizes the ranks.
+ */
+class hiopTrace
+{
+public:
+  hiopTrace()
+      : enabled_(false),
+        iter_(-1),
+        tm_origin_(0.),
+        rank_(0),
+        comm_(MPI_COMM_SELF)
+  {}
+
+  inline bool is_enabled() const { return enabled_; }
+
+  /// Clears the events and starts recording; collective on `comm`
+  void start(MPI_Comm comm);
+
+  /// Stops recording; the events are kept for `write`
+  inline void stop() { enabled_ = false; }
+
+  /// Sets the iteration number attached to the events recorded from now on
+  inline void set_iteration(int iter) { iter_ = iter; }
+
+  /// Records the span of a phase; `name` should be a string literal
+  inline void record(const char* name, double t_start, double t_end)
+  {
+    if(enabled_) {
+      events_.push_back(Event{name, iter_, t_start, t_end});
+    }
+  }
+
+  inline size_t num_events() const { return events_.size(); }
+
+  /**
+   * Writes the events of all ranks to `path`.json (Chrome trace) and `path`.csv on rank 0. Collective on
+   * the communicator passed to `start`. Returns false and a description in `errors` if the files could not
+   * be written.
+   */
+  bool write(const std::string& path, std::string& errors) const;
+
+private:
+  struct Event
+  {
+    const char* name;
+    int iter;
+    double t_start;
+    double t_end;
+  };
+
+  /// Appends the events of this rank to `json` (comma-separated Chrome trace events) and `csv` (lines)
+  void serialize(std::string& json, std::string& csv) const;
+
+private:
+  bool enabled_;
+  int iter_;
+  double tm_origin_;
+  int rank_;
+  MPI_Comm comm_;
+  std::vector<Event> events_;
+};
+
+/**
+ * Records the lifetime of the object as an event of `trace`, for phases without a dedicated timer. Like the
+ * timers, it compiles to nothing when HIOP_WITH_TIMERS is off.
+ */
+class hiopTraceSpan
+{
+public:
+  hiopTraceSpan(hiopTrace& trace, const char* name)
+      : trace_(trace),
+        name_(name),
+        tm_start_(0.)
+  {
+#ifdef HIOP_WITH_TIMERS
+    if(trace_.is_enabled()) {
+      tm_start_ = hiopTimer::wall_time();
+    }
+#endif
+  }
+  ~hiopTraceSpan()
+  {
+#ifdef HIOP_WITH_TIMERS
+    if(trace_.is_enabled()) {
+      trace_.record(name_, tm_start_, hiopTimer::wall_time());
+    }
+#endif
+  }
+
+private:
+  hiopTraceSpan(const hiopTraceSpan&) = delete;
+  hiopTraceSpan& operator=(const hiopTraceSpan&) = delete;
+
+  hiopTrace& trace_;
+  const char* name_;
+  double tm_start_;
+};
+
+}  // namespace hiop
+#endif
@@ -858,9 +858,111 @@ public:
 
     A.copyRowsFrom(B, select.local_data_const(), n_A_rows);
 
-    fail += verifyAnswer(&A, two),
+    fail += verifyAnswer(&A, two);
+
+    // the pattern is now set up: a second copy only gathers the (new) values
+    B.setToConstant(half);
+    A.copyRowsFrom(B, select.local_data_const(), n_A_rows);
+
+    fail += verifyAnswer(&A, half);
 
-        printMessage(fail, __func__);
+    // another selection of the same size into the same rows: the pattern must be copied again
+    maybeCopyFromDev(&B);
+    const local_ordinal_type* B_iRow = getRowIndices(&B);
+    real_type* B_values = getMatrixData(&B);
+    for(local_ordinal_type k = 0; k < B.numberOfNonzeros(); k++) {
+      B_values[k] = B_iRow[k];
+    }
+    maybeCopyToDev(&B);
+    for(int i = 0; i < select.get_local_size(); i++) {
+      setLocalElement(&select, i, 2 * i + 1);
+    }
+    A.copyRowsFrom(B, select.local_data_const(), n_A_rows);
+
+    maybeCopyFromDev(&A);
+    const local_ordinal_type* A_iRow = getRowIndices(&A);
+    const real_type* A_values = getMatrixData(&A);
+    for(local_ordinal_type k = 0; k < A.numberOfNonzeros(); k++) {
+      if(A_values[k] != static_cast<real_type>(2 * A_iRow[k] + 1)) {
+        fail++;
+        break;
+      }
+    }
+
+    // a copy of the source has its own pattern id: the rows are gathered from the copy
+    hiop::hiopMatrixSparse* C = B.new_copy();
+    if(C->get_pattern_id() == B.get_pattern_id()) {
+      fail++;
+    }
+    maybeCopyFromDev(C);
+    real_type* C_values = getMatrixData(C);
+    for(local_ordinal_type k = 0; k < C->numberOfNonzeros(); k++) {
+      C_values[k] = -C_values[k];
+    }
+    maybeCopyToDev(C);
+    A.copyRowsFrom(*C, select.local_data_const(), n_A_rows);
+
+    maybeCopyFromDev(&A);
+    A_iRow = getRowIndices(&A);
+    A_values = getMatrixData(&A);
+    for(local_ordinal_type k = 0; k < A.numberOfNonzeros(); k++) {
+      if(A_values[k] != -static_cast<real_type>(2 * A_iRow[k] + 1)) {
+        fail++;
+        break;
+      }
+    }
+    delete C;
+
+    printMessage(fail, __func__);
+    return fail;
+  }
+
+  /// @brief Checks that the pattern id of a copy of B is renewed only when its indices are rewritten, and that the
+  /// rows copied from it into a copy of A are then set up again. The first two nonzeros of B must be in row 0, with
+  /// the second one in a column larger than 1.
+  int matrix_pattern_id_follows_indices(hiop::hiopMatrixSparse& A, hiop::hiopMatrixSparse& B, hiop::hiopVectorInt& select)
+  {
+    const int n_A_rows = A.m();
+    assert(A.n() == B.n());
+    assert(n_A_rows <= B.m());
+
+    for(int i = 0; i < select.get_local_size(); i++) {
+      setLocalElement(&select, i, i);
+    }
+
+    int fail{0};
+
+    hiop::hiopMatrixSparse* D = A.new_copy();
+    hiop::hiopMatrixSparse* C = B.new_copy();
+    C->setToConstant(two);
+    D->copyRowsFrom(*C, select.local_data_const(), n_A_rows);
+    fail += verifyAnswer(D, two);
+
+    // rewriting the indices with the same values keeps the pattern
+    const uint64_t pattern_id = C->get_pattern_id();
+    C->copyDiagMatrixToSubblock(two, 0, 0, 0, 1);
+    if(C->get_pattern_id() != pattern_id) {
+      fail++;
+    }
+
+    // moving the first nonzero from (0,0) to (0,1) changes the pattern
+    C->copyDiagMatrixToSubblock(half, 0, 1, 0, 1);
+    if(C->get_pattern_id() == pattern_id) {
+      fail++;
+    }
+
+    // the rows of the new pattern are copied, not only the values
+    D->copyRowsFrom(*C, select.local_data_const(), n_A_rows);
+    maybeCopyFromDev(D);
+    const local_ordinal_type* D_jCol = getColumnIndices(D);
+    const real_type* D_values = getMatrixData(D);
+    if(D_jCol[0] != 1 || D_values[0] != half) {
+      fail++;
+    }
+    delete C;
+    delete D;
+
+    printMessage(fail, __func__);
     return fail;
   }
 
@@ -945,6 +1047,14 @@ public:
     fail += verifyAnswer(&B, B_nnz_st, B_nnz_st + nnz_A_need_to_copy, A_val);
     fail += verifyAnswer(&B, B_nnz_st + nnz_A_need_to_copy, B_nnz, B_val);
 
+    // the pattern is now set up: a second copy only gathers the (new) values of the block
+    A.setToConstant(two);
+    B.copyRowsBlockFrom(A, A_rows_st, n_rows, B_rows_st, B_nnz_st);
+
+    fail += verifyAnswer(&B, 0, B_nnz_st, B_val);
+    fail += verifyAnswer(&B, B_nnz_st, B_nnz_st + nnz_A_need_to_copy, two);
+    fail += verifyAnswer(&B, B_nnz_st + nnz_A_need_to_copy, B_nnz, B_val);
+
     printMessage(fail, __func__);
     return fail;
   }
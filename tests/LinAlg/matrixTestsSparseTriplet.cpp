@@ -56,6 +56,7 @@
  *
  */
 
+#include <algorithm>
 #include <cstring>
 #include <hiopMatrix.hpp>
 #include "matrixTestsSparseTriplet.hpp"
@@ -339,5 +340,61 @@ void MatrixTestsSparseTriplet::setLocalElement(hiop::hiopVectorInt* xvec, int id
   }
 }
 
+/**
+ * Test: the products over the cached CSR/CSC index of the sparsity pattern match the products over
+ * the triplets. The triplets are temporarily reversed so that they are not ordered.
+ */
+bool MatrixTestsSparseTriplet::matrix_compressed_spmv(hiop::hiopMatrixSparse& Amat,
+                                                      hiop::hiopVector& y,
+                                                      hiop::hiopVector& x)
+{
+  auto& A = dynamic_cast<hiop::hiopMatrixSparseTriplet&>(Amat);
+  const local_ordinal_type nnz = A.numberOfNonzeros();
+  assert(y.get_size() == A.m() && "Did you pass in vectors of the correct sizes?");
+  assert(x.get_size() == A.n() && "Did you pass in vectors of the correct sizes?");
+  const real_type alpha = two, beta = half, y_val = three;
+  int fail = 0;
+
+  std::reverse(A.i_row(), A.i_row() + nnz);
+  std::reverse(A.j_col(), A.j_col() + nnz);
+  for(local_ordinal_type k = 0; k < nnz; k++) {
+    A.M()[k] = one + (k % 7) * quarter;
+  }
+  for(local_ordinal_type j = 0; j < getLocalSize(&x); j++) {
+    setLocalElement(&x, j, half + (j % 5));
+  }
+  hiop::hiopVector* y_ref = y.alloc_clone();
+  hiop::hiopVector* x_ref = x.alloc_clone();
+
+  // y <- beta * y + alpha * A * x
+  A.set_compressed_spmv(false);
+  y_ref->setToConstant(y_val);
+  A.timesVec(beta, *y_ref, alpha, x);
+  A.set_compressed_spmv(true);
+  y.setToConstant(y_val);
+  A.timesVec(beta, y, alpha, x);
+  for(local_ordinal_type i = 0; i < getLocalSize(&y); i++) {
+    fail += !isEqual(getLocalElement(&y, i), getLocalElement(y_ref, i));
+  }
+
+  // x <- beta * x + alpha * A^T * y
+  x_ref->copyFrom(x);
+  A.set_compressed_spmv(false);
+  A.transTimesVec(beta, *x_ref, alpha, y);
+  A.set_compressed_spmv(true);
+  A.transTimesVec(beta, x, alpha, y);
+  for(local_ordinal_type j = 0; j < getLocalSize(&x); j++) {
+    fail += !isEqual(getLocalElement(&x, j), getLocalElement(x_ref, j));
+  }
+
+  A.set_compressed_spmv(false);
+  std::reverse(A.i_row(), A.i_row() + nnz);
+  std::reverse(A.j_col(), A.j_col() + nnz);
+  delete y_ref;
+  delete x_ref;
+  printMessage(fail, __func__);
+  return fail;
+}
+
 }  // namespace tests
 }  // namespace hiop
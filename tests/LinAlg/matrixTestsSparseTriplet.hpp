@@ -108,6 +108,9 @@ private:
 
 public:
   virtual void initializeMatrix(hiop::hiopMatrixSparse* mat, local_ordinal_type entries_per_row) override;
+
+  /// @brief Test: products over the compressed index of the pattern match the products over the triplets
+  bool matrix_compressed_spmv(hiop::hiopMatrixSparse& A, hiop::hiopVector& y, hiop::hiopVector& x);
 };
 
 }  // namespace tests
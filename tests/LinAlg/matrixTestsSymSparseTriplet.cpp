@@ -56,6 +56,7 @@
  *
  */
 
+#include <algorithm>
 #include <cstring>
 #include <hiopVectorPar.hpp>
 #include "matrixTestsSymSparseTriplet.hpp"
@@ -197,5 +198,41 @@ local_ordinal_type* MatrixTestsSymSparseTriplet::numNonzerosPerCol(hiop::hiopMat
   return sparsity_pattern;
 }
 
+/// Test: the product over the cached CSR/CSC index of the upper triangle matches the product over the triplets
+bool MatrixTestsSymSparseTriplet::matrix_compressed_spmv(hiop::hiopMatrixSparse& Amat,
+                                                         hiop::hiopVector& y,
+                                                         hiop::hiopVector& x)
+{
+  auto& A = dynamic_cast<hiop::hiopMatrixSymSparseTriplet&>(Amat);
+  assert(y.get_size() == A.m() && "Did you pass in vectors of the correct sizes?");
+  assert(x.get_size() == A.n() && "Did you pass in vectors of the correct sizes?");
+  const real_type alpha = two, beta = half, y_val = three;
+  int fail = 0;
+
+  for(local_ordinal_type k = 0; k < A.numberOfNonzeros(); k++) {
+    A.M()[k] = one + (k % 7) * quarter;
+  }
+  auto* xx = dynamic_cast<hiop::hiopVectorPar*>(&x);
+  for(local_ordinal_type j = 0; j < getLocalSize(&x); j++) {
+    xx->local_data()[j] = half + (j % 5);
+  }
+  hiop::hiopVector* y_ref = y.alloc_clone();
+
+  A.set_compressed_spmv(false);
+  y_ref->setToConstant(y_val);
+  A.timesVec(beta, *y_ref, alpha, x);
+  A.set_compressed_spmv(true);
+  y.setToConstant(y_val);
+  A.timesVec(beta, y, alpha, x);
+  A.set_compressed_spmv(false);
+  for(local_ordinal_type i = 0; i < getLocalSize(&y); i++) {
+    fail += !isEqual(getLocalElement(&y, i), getLocalElement(y_ref, i));
+  }
+
+  delete y_ref;
+  printMessage(fail, __func__);
+  return fail;
+}
+
 }  // namespace tests
 }  // namespace hiop
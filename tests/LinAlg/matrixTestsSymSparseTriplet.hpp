@@ -92,6 +92,10 @@ private:
   virtual int verifyAnswer(hiop::hiopVector* x, std::function<real_type(local_ordinal_type)> expect) override;
   virtual local_ordinal_type* numNonzerosPerRow(hiop::hiopMatrixSparse* mat) override;
   virtual local_ordinal_type* numNonzerosPerCol(hiop::hiopMatrixSparse* mat) override;
+
+public:
+  /// @brief Test: products over the compressed index of the pattern match the products over the triplets
+  bool matrix_compressed_spmv(hiop::hiopMatrixSparse& A, hiop::hiopVector& y, hiop::hiopVector& x);
 };
 
 }  // namespace tests
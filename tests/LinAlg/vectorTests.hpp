@@ -65,6 +65,7 @@
 
 #include <hiopVector.hpp>
 #include <hiopVectorInt.hpp>
+#include <hiopReductionBatch.hpp>
 #include <LinAlgFactory.hpp>
 #include "testBase.hpp"
 
@@ -1475,6 +1476,65 @@ public:
     return 0;
   }
 
+  /**
+   * @brief Test: the reductions queued in a hiopReductionBatch and completed with one blocking or nonblocking
+   * Allreduce give the same results as the reductions of the vectors
+   */
+  bool vector_reduction_batch(hiop::hiopVector& x,
+                              hiop::hiopVector& y,
+                              hiop::hiopVector& pattern,
+                              MPI_Comm comm,
+                              const int rank)
+  {
+    const local_ordinal_type N = getLocalSize(&x);
+    assert(N == getLocalSize(&y));
+    assert(N == getLocalSize(&pattern));
+    int num_ranks = 1;
+#ifdef HIOP_USE_MPI
+    MPI_Comm_size(comm, &num_ranks);
+#endif
+    int fail = 0;
+
+    x.set_to_random_uniform(-one, one);
+    if(rank == 0) setLocalElement(&x, N - 1, -two);
+    y.set_to_random_uniform(half, one);
+    pattern.setToConstant(one);
+    if(rank == 0) setLocalElement(&pattern, N - 1, zero);
+
+    hiop::hiopReductionBatch batch(comm);
+    for(int nonblocking = 0; nonblocking <= 1; nonblocking++) {
+      batch.clear();
+      const int k_onenorm = batch.add_onenorm(x);
+      const int k_infnorm = batch.add_infnorm(x);
+      const int k_twonorm = batch.add_twonorm(x);
+      const int k_dot = batch.add_dot(x, y);
+      const int k_min = batch.add_min(x);
+      const int k_min_pattern = batch.add_min_w_pattern(x, pattern);
+      const int k_pos_x = batch.add_all_positive(x);
+      const int k_pos_y = batch.add_all_positive(y);
+      const int k_sum = batch.add_sum(one);
+      const int k_max = batch.add_max(static_cast<real_type>(rank));
+      const int k_min_rank = batch.add_min(static_cast<real_type>(rank));
+      batch.start(nonblocking == 1);
+      batch.wait();
+
+      fail += !isEqual(batch.value(k_onenorm), x.onenorm());
+      fail += (batch.value(k_infnorm) != x.infnorm());
+      fail += !isEqual(batch.value(k_twonorm), x.twonorm());
+      fail += !isEqual(batch.value(k_dot), x.dotProductWith(y));
+      fail += (batch.value(k_min) != x.min());
+      fail += (batch.value(k_min_pattern) != x.min_w_pattern(pattern));
+      fail += (batch.value(k_pos_x) != zero);
+      fail += (batch.value(k_pos_y) != one);
+      fail += (batch.value(k_sum) != static_cast<real_type>(num_ranks));
+      fail += (batch.value(k_max) != static_cast<real_type>(num_ranks - 1));
+      fail += (batch.value(k_min_rank) != zero);
+    }
+
+    printMessage(fail, __func__, rank);
+    return reduceReturn(fail, &x);
+  }
+
   /**
    * @brief Test: Project vector into bounds
    */
@@ -1742,6 +1802,146 @@ public:
     return reduceReturn(fail, &x);
   }
 
+  /**
+   * @brief Test:
+   * this = base + alpha * dir
+   */
+  bool vector_copy_from_axpy(hiop::hiopVector& x, hiop::hiopVector& base, hiop::hiopVector& dir, const int rank)
+  {
+    assert(getLocalSize(&x) == getLocalSize(&base));
+    assert(getLocalSize(&x) == getLocalSize(&dir));
+
+    x.setToConstant(zero);
+    base.setToConstant(one);
+    dir.setToConstant(two);
+    x.copy_from_axpy(base, half, dir);
+
+    const int fail = verifyAnswer(&x, two);
+    printMessage(fail, __func__, rank);
+    return reduceReturn(fail, &x);
+  }
+
+  /**
+   * @brief Test:
+   * r = pattern ? (a - b - c) : 0, returns the local inf-norm of r
+   */
+  bool vector_bound_residual_w_pattern(hiop::hiopVector& r,
+                                       hiop::hiopVector& a,
+                                       hiop::hiopVector& b,
+                                       hiop::hiopVector& c,
+                                       hiop::hiopVector& pattern,
+                                       const int rank)
+  {
+    const local_ordinal_type N = getLocalSize(&r);
+    assert(N == getLocalSize(&a));
+    assert(N == getLocalSize(&b));
+    assert(N == getLocalSize(&c));
+    assert(N == getLocalSize(&pattern));
+    int fail = 0;
+
+    r.setToConstant(one);
+    a.setToConstant(two);
+    b.setToConstant(half);
+    c.setToConstant(quarter);
+    pattern.setToConstant(one);
+    setLocalElement(&a, 0, -two);
+    setLocalElement(&a, N - 1, 4 * two);
+    setLocalElement(&pattern, N - 1, zero);
+
+    const real_type nrm = r.bound_residual_w_pattern_local(a, b, c, pattern);
+    fail += !isEqual(nrm, two + half + quarter);
+    fail += !isEqual(getLocalElement(&r, 0), -(two + half + quarter));
+    fail += !isEqual(getLocalElement(&r, N - 1), zero);
+    for(local_ordinal_type i = 1; i < N - 1; i++) {
+      fail += !isEqual(getLocalElement(&r, i), one + quarter);
+    }
+
+    printMessage(fail, __func__, rank);
+    return reduceReturn(fail, &r);
+  }
+
+  /**
+   * @brief Test:
+   * r = pattern ? (mu - s*z) : 0, returns the local inf-norm of r and
+   * the local inf-norm of s*z over the pattern
+   */
+  bool vector_complementarity_residual(hiop::hiopVector& r,
+                                       hiop::hiopVector& s,
+                                       hiop::hiopVector& z,
+                                       hiop::hiopVector& pattern,
+                                       const int rank)
+  {
+    const local_ordinal_type N = getLocalSize(&r);
+    assert(N == getLocalSize(&s));
+    assert(N == getLocalSize(&z));
+    assert(N == getLocalSize(&pattern));
+    static const real_type mu = quarter;
+    int fail = 0;
+
+    r.setToConstant(one);
+    s.setToConstant(two);
+    z.setToConstant(half);
+    pattern.setToConstant(one);
+    setLocalElement(&s, 0, 4.0);
+    setLocalElement(&s, N - 1, 16.0);
+    setLocalElement(&pattern, N - 1, zero);
+
+    real_type nrm_nlp = zero;
+    const real_type nrm_bar = r.complementarity_residual_local(mu, s, z, pattern, nrm_nlp);
+    fail += !isEqual(nrm_nlp, two);
+    fail += !isEqual(nrm_bar, two - quarter);
+    fail += !isEqual(getLocalElement(&r, 0), quarter - two);
+    fail += !isEqual(getLocalElement(&r, N - 1), zero);
+    for(local_ordinal_type i = 1; i < N - 1; i++) {
+      fail += !isEqual(getLocalElement(&r, i), quarter - one);
+    }
+
+    printMessage(fail, __func__, rank);
+    return reduceReturn(fail, &r);
+  }
+
+  /**
+   * @brief Test:
+   * Same as fractionToTheBdry_w_pattern applied to a slack and to its
+   * dual, both computed in a single call
+   */
+  bool vector_fraction_to_the_bdry_pair_w_pattern(hiop::hiopVector& s,
+                                                  hiop::hiopVector& ds,
+                                                  hiop::hiopVector& z,
+                                                  hiop::hiopVector& dz,
+                                                  hiop::hiopVector& pattern,
+                                                  const int rank)
+  {
+    const local_ordinal_type N = getLocalSize(&s);
+    assert(N == getLocalSize(&ds));
+    assert(N == getLocalSize(&z));
+    assert(N == getLocalSize(&dz));
+    assert(N == getLocalSize(&pattern));
+    static const real_type tau = half;
+    int fail = 0;
+
+    s.setToConstant(one);
+    z.setToConstant(one);
+    ds.setToConstant(-one);
+    dz.setToConstant(one);
+    pattern.setToConstant(one);
+    setLocalElement(&ds, N - 1, -4 * two);
+    setLocalElement(&dz, N - 1, -4 * two);
+    setLocalElement(&pattern, N - 1, zero);
+    setLocalElement(&dz, 0, -two);
+
+    real_type alpha_primal = zero;
+    real_type alpha_dual = zero;
+    s.fraction_to_the_bdry_pair_w_pattern_local(ds, z, dz, tau, pattern, alpha_primal, alpha_dual);
+    fail += !isEqual(alpha_primal, half);     // -0.5*1/(-1)
+    fail += !isEqual(alpha_dual, quarter);    // -0.5*1/(-2)
+    fail += !isEqual(alpha_primal, s.fractionToTheBdry_w_pattern_local(ds, tau, pattern));
+    fail += !isEqual(alpha_dual, z.fractionToTheBdry_w_pattern_local(dz, tau, pattern));
+
+    printMessage(fail, __func__, rank);
+    return reduceReturn(fail, &s);
+  }
+
   /**
    * @brief Test:
    * \exists e \in this s.t. isnan(e)
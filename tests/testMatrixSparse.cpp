@@ -121,6 +121,7 @@ int main(int argc, char** argv)
     fail += test.matrixSetToConstant(*mxn_sparse);
     fail += test.matrixTimesVec(*mxn_sparse, vec_m, vec_n);
     fail += test.matrixTransTimesVec(*mxn_sparse, vec_m, vec_n);
+    fail += test.matrix_compressed_spmv(*mxn_sparse, vec_m, vec_n);
     fail += test.matrixMaxAbsValue(*mxn_sparse);
     fail += test.matrix_row_max_abs_value(*mxn_sparse, vec_m);
     fail += test.matrix_scale_row(*mxn_sparse, vec_m);
@@ -133,6 +134,8 @@ int main(int argc, char** argv)
     // local_ordinal_type test_offset = 10;
     local_ordinal_type test_offset = 4;
     fail += test.matrixAddMDinvMtransToDiagBlockOfSymDeMatUTri(*mxn_sparse, vec_n, W_dense, test_offset);
+    // the second product reuses the symbolic product pattern cached by the first one
+    fail += test.matrixAddMDinvMtransToDiagBlockOfSymDeMatUTri(*mxn_sparse, vec_n, W_dense, test_offset);
 
     // Need a dense matrix that is big enough for the sparse matrix to map inside the upper triangular part of it
     // hiop::hiopMatrixDenseRowMajor n2xn2_dense(2 * N_global, 2 * N_global);
@@ -154,6 +157,10 @@ int main(int argc, char** argv)
 
     fail += test.matrixTimesMatTrans(*mxn_sparse, *m2xn_sparse, mxm2_dense);
     fail += test.matrixAddMDinvNtransToSymDeMatUTri(*mxn_sparse, *m2xn_sparse, vec_n, W_dense, i_offset, j_offset);
+    fail += test.matrixAddMDinvNtransToSymDeMatUTri(*mxn_sparse, *m2xn_sparse, vec_n, W_dense, i_offset, j_offset);
+    // another M2 replaces the cached product pattern, which is rebuilt when the first M2 is passed again
+    fail += test.matrixAddMDinvNtransToSymDeMatUTri(*mxn_sparse, *mxn_sparse, vec_n, W_dense, i_offset, j_offset);
+    fail += test.matrixAddMDinvNtransToSymDeMatUTri(*mxn_sparse, *m2xn_sparse, vec_n, W_dense, i_offset, j_offset);
 
     // copy sparse matrix to a dense matrix
     hiop::hiopMatrixDenseRowMajor mxn_dense(M_global, N_global);
@@ -172,6 +179,7 @@ int main(int argc, char** argv)
 
     hiop::hiopVectorIntSeq select(M_local);
     fail += test.matrix_copy_rows_from(*mxn_sparse, *m2xn_sparse, select);
+    fail += test.matrix_pattern_id_follows_indices(*mxn_sparse, *m2xn_sparse, select);
 
     // copy the 1st row of mxn_sparse to the last row in m2xn_sparse
     // replace the nonzero index from "nnz-entries_per_row"
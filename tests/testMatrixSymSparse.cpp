@@ -216,6 +216,7 @@ int main(int argc, char** argv)
     hiop::hiopMatrixSparse* m2_sym = hiop::LinearAlgebraFactory::create_matrix_sym_sparse(mem_space, 2 * M_global, nnz_m2);
 
     fail += test.matrixTimesVec(*m_sym, vec_m, vec_m_2);
+    fail += test.matrix_compressed_spmv(*m_sym, vec_m, vec_m_2);
     fail += test.matrixAddUpperTriangleToSymDenseMatrixUpperTriangle(mxm_dense, *m_sym);
     fail += test.matrixStartingAtAddSubDiagonalToStartingAt(vec_m, *m_sym);
 
@@ -53,7 +53,9 @@
  * @author Slaven Peles <slaven.peles@pnnl.gov>, PNNL
  *
  */
+#include <cmath>
 #include <iostream>
+#include <vector>
 #include <assert.h>
 
 // This header contains HiOp's MPI definitions
@@ -61,6 +63,7 @@
 #include <LinAlgFactory.hpp>
 #include <hiopVectorPar.hpp>
 #include <hiopVectorIntSeq.hpp>
+#include <hiopOMP.hpp>
 
 #include "LinAlg/vectorTestsPar.hpp"
 #include "LinAlg/vectorTestsIntSeq.hpp"
@@ -185,6 +188,101 @@ int main(int argc, char** argv)
 #endif  // RAJA
   }
 
+  //
+  // Test the local two-norm of the default vector with large and tiny entries (several reduction blocks with OpenMP)
+  //
+  if(rank == 0) {
+    std::cout << "\nTesting HiOp default vector local two-norm with large and tiny entries:\n";
+    const hiop::size_type n = 20000;
+    hiop::hiopVectorPar v(n);
+    for(double entry: {1e200, 1e-200}) {
+      v.setToConstant(entry);
+      const double expected = std::sqrt(static_cast<double>(n)) * entry;
+      const double actual = v.twonorm_local();
+      if(!(std::fabs(actual - expected) <= 1e-12 * expected)) {
+        std::cout << "  two-norm of a vector of " << entry << " is " << actual << " instead of " << expected << "\n";
+        fail++;
+      }
+    }
+  }
+
+  //
+  // Test that a NaN entry of the default vector is not positive, with and without OpenMP
+  //
+  if(rank == 0) {
+    std::cout << "\nTesting HiOp default vector positivity with a NaN entry:\n";
+    const hiop::size_type n = 20000;
+    hiop::hiopVectorPar v(n);
+    hiop::hiopVectorPar pattern(n);
+    v.setToConstant(1.0);
+    pattern.setToConstant(1.0);
+    v.local_data()[n / 2] = std::nan("");
+    if(v.allPositive_local()) {
+      std::cout << "  allPositive_local is true for a vector with a NaN entry\n";
+      fail++;
+    }
+    if(v.allPositive_w_patternSelect(pattern)) {
+      std::cout << "  allPositive_w_patternSelect is true for a vector with a NaN entry\n";
+      fail++;
+    }
+  }
+
+  //
+  // Test that the reductions of the default vector do not depend on the number of threads; the length is above
+  // omp::min_len_threaded, hence the threaded kernels are used when HiOp is built with OpenMP
+  //
+  if(rank == 0) {
+    std::cout << "\nTesting HiOp default vector reductions with different numbers of threads:\n";
+    const hiop::size_type n = 3 * hiop::omp::min_len_threaded + 101;
+    hiop::hiopVectorPar x(n), d(n), select(n), select2(n), r(n);
+    double* x_vec = x.local_data();
+    double* d_vec = d.local_data();
+    double* sel_vec = select.local_data();
+    double* sel2_vec = select2.local_data();
+    for(hiop::size_type i = 0; i < n; i++) {
+      x_vec[i] = 1.0 + std::fabs(std::sin(0.37 * i)) * std::pow(10.0, i % 7 - 3);
+      d_vec[i] = std::cos(0.11 * i) * std::pow(10.0, i % 5 - 2);
+      sel_vec[i] = i % 3 == 0 ? 0.0 : 1.0;
+      sel2_vec[i] = i % 5 == 0 ? 1.0 : 0.0;
+    }
+
+    auto reductions = [&]() {
+      double nrm_inf_nlp = 0.;
+      const double compl_res = r.complementarity_residual_local(0.1, x, d, select, nrm_inf_nlp);
+      std::vector<double> dots(2);
+      const hiop::hiopVector* dvecs[] = {&d, &select};
+      x.dot_products_with_local(2, dvecs, dots.data());
+      return std::vector<double>{x.twonorm_local(),
+                                 x.onenorm_local(),
+                                 x.infnorm_local(),
+                                 x.sum_local(),
+                                 x.min_local(),
+                                 x.dotProductWith(d),
+                                 dots[0],
+                                 dots[1],
+                                 x.logBarrier_local(select),
+                                 x.linearDampingTerm_local(select, select2, 0.1, 1e-5),
+                                 x.fractionToTheBdry_local(d, 0.99),
+                                 compl_res,
+                                 nrm_inf_nlp};
+    };
+
+    hiop::omp::set_num_threads(1);
+    const std::vector<double> expected = reductions();
+    for(int num_threads: {2, 3, 4}) {
+      hiop::omp::set_num_threads(num_threads);
+      const std::vector<double> actual = reductions();
+      for(size_t k = 0; k < expected.size(); k++) {
+        if(actual[k] != expected[k]) {
+          std::cout << "  reduction " << k << " is " << actual[k] << " with " << num_threads << " threads instead of "
+                    << expected[k] << " with 1 thread\n";
+          fail++;
+        }
+      }
+    }
+    hiop::omp::set_num_threads(0);
+  }
+
   //
   // Test summary
   //
@@ -306,6 +404,7 @@ int runTests(const char* mem_space, MPI_Comm comm)
 
   fail += test.vectorMin(*x, rank);
   fail += test.vectorMin_w_pattern(*x, *y, rank);
+  fail += test.vector_reduction_batch(*x, *y, *z, comm, rank);
   fail += test.vectorProjectIntoBounds(*x, *y, *z, *a, *b, rank);
   fail += test.vectorFractionToTheBdry(*x, *y, rank);
   fail += test.vectorFractionToTheBdry_w_pattern(*x, *y, *z, rank);
@@ -313,6 +412,11 @@ int runTests(const char* mem_space, MPI_Comm comm)
   fail += test.vectorMatchesPattern(*x, *y, rank);
   fail += test.vectorAdjustDuals_plh(*x, *y, *z, *a, rank);
 
+  fail += test.vector_copy_from_axpy(*x, *y, *z, rank);
+  fail += test.vector_bound_residual_w_pattern(*x, *y, *z, *a, *b, rank);
+  fail += test.vector_complementarity_residual(*x, *y, *z, *a, rank);
+  fail += test.vector_fraction_to_the_bdry_pair_w_pattern(*x, *y, *z, *a, *b, rank);
+
   if(rank == 0) {
     fail += test.vectorIsnan(*v);
     fail += test.vectorIsinf(*v);
@@ -0,0 +1,112 @@
+#include "hiopCheckpoint.hpp"
+#include "hiopVectorPar.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace hiop;
+
+/**
+ * Checks that the snapshots of HiOp's native checkpoint format are written (synchronously and
+ * by the background writer) and read back unchanged, and that size mismatches are detected.
+ *
+ * Usage: test_checkpoint [directory for the checkpoint files]
+ */
+int main(int argc, char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+  const std::string dir = argc > 1 ? argv[1] : ".";
+  const std::string path = dir + "/test_checkpoint_#.chk";
+  int fail = 0;
+
+  const size_type n = 1000;
+  hiopVectorPar x(n);
+  for(size_type i = 0; i < n; ++i) {
+    x.local_data()[i] = 1. / (i + 1);
+  }
+
+  // several checkpoints through the asynchronous writer; the later ones supersede the earlier ones
+  const int n_chk = 5;
+  {
+    hiopCheckpointWriter writer;
+    for(int k = 0; k < n_chk; ++k) {
+      hiopCheckpointSnapshot& chk = writer.acquire();
+      chk.clear();
+      chk.set_ranks(1, 0);
+      const double params[] = {(double)k, 0.5 * k};
+      chk.add_array("params", params, 2);
+      x.scale(2.);
+      chk.add_vec("x", x);
+      std::string path_k = path;
+      path_k.replace(path_k.find("#"), 1, std::to_string(k));
+      writer.submit(path_k);
+    }
+    std::string errors;
+    if(!writer.wait(errors)) {
+      printf("checkpoint write failed: %s", errors.c_str());
+      fail++;
+    }
+  }
+
+  // the last checkpoint is always written
+  std::string path_last = path;
+  path_last.replace(path_last.find("#"), 1, std::to_string(n_chk - 1));
+  try {
+    hiopCheckpointSnapshot chk;
+    chk.read(path_last);
+    double params[2];
+    chk.copy_array("params", params, 2);
+    if(params[0] != n_chk - 1 || params[1] != 0.5 * (n_chk - 1)) {
+      printf("wrong parameters loaded from checkpoint\n");
+      fail++;
+    }
+    hiopVectorPar y(n);
+    chk.copy_vec("x", y);
+    y.axpy(-1., x);
+    if(y.infnorm() != 0.) {
+      printf("wrong vector loaded from checkpoint\n");
+      fail++;
+    }
+
+    // size mismatch
+    hiopVectorPar z(n + 1);
+    bool thrown = false;
+    try {
+      chk.copy_vec("x", z);
+    } catch(const std::runtime_error& e) {
+      thrown = true;
+    }
+    if(!thrown) {
+      printf("size mismatch not detected\n");
+      fail++;
+    }
+  } catch(const std::exception& e) {
+    printf("checkpoint read failed: %s\n", e.what());
+    fail++;
+  }
+
+  if(hiopCheckpointSnapshot::rank_file_name("chk", 0, 1) != "chk" ||
+     hiopCheckpointSnapshot::rank_file_name("chk", 3, 4) != "chk.3") {
+    printf("wrong per-rank file names\n");
+    fail++;
+  }
+
+  for(int k = 0; k < n_chk; ++k) {
+    std::string path_k = path;
+    path_k.replace(path_k.find("#"), 1, std::to_string(k));
+    std::remove(path_k.c_str());
+  }
+
+  if(fail) {
+    printf("Checkpoint test failed: %d errors\n", fail);
+  } else {
+    printf("Checkpoint test passed\n");
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}
@@ -0,0 +1,240 @@
+#include "hiopLinSolverSymDenseLDLT.hpp"
+#include "hiopLinSolverSymDenseLapack.hpp"
+#include "hiopMatrixDenseRowMajor.hpp"
+#include "hiopNlpFormulation.hpp"
+#include "hiopInterface.hpp"
+#include "hiopVectorPar.hpp"
+#include "hiopTimer.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace hiop;
+
+/**
+ * Placeholder NLP, only used to provide the options, logger, and run statistics needed by the linear solvers.
+ */
+class DummyNlp : public hiopInterfaceDenseConstraints
+{
+public:
+  bool get_prob_sizes(size_type& n, size_type& m)
+  {
+    n = 1;
+    m = 0;
+    return true;
+  }
+  bool get_vars_info(const size_type&, double* xlow, double* xupp, NonlinearityType* type)
+  {
+    xlow[0] = -1e20;
+    xupp[0] = 1e20;
+    type[0] = hiopNonlinear;
+    return true;
+  }
+  bool get_cons_info(const size_type&, double*, double*, NonlinearityType*) { return true; }
+  bool eval_f(const size_type&, const double* x, bool, double& obj_value)
+  {
+    obj_value = x[0] * x[0];
+    return true;
+  }
+  bool eval_grad_f(const size_type&, const double* x, bool, double* gradf)
+  {
+    gradf[0] = 2 * x[0];
+    return true;
+  }
+  bool eval_cons(const size_type&, const size_type&, const size_type&, const index_type*, const double*, bool, double*)
+  {
+    return true;
+  }
+  bool eval_Jac_cons(const size_type&, const size_type&, const size_type&, const index_type*, const double*, bool, double*)
+  {
+    return true;
+  }
+#ifdef HIOP_USE_MPI
+  bool get_MPI_comm(MPI_Comm& comm_out)
+  {
+    comm_out = MPI_COMM_SELF;
+    return true;
+  }
+#endif
+};
+
+/**
+ * Fills `A` with a matrix having the structure of the compressed MDS KKT [H+D J^T; J -delta I], with H
+ * symmetric positive definite of size nx and J of size m x nx. The inertia is (nx, m, 0).
+ */
+static void fill_kkt(hiopMatrixDense& A, int nx, int m, std::mt19937& gen)
+{
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  const int n = nx + m;
+  double* a = A.local_data();
+  for(int i = 0; i < n; ++i) {
+    for(int j = i; j < n; ++j) {
+      double v = 0.;
+      if(i < nx) {
+        v = unif(gen);
+      } else if(i == j) {
+        v = -1e-8;
+      }
+      a[i * n + j] = a[j * n + i] = v;
+    }
+  }
+  // diagonal dominance makes the (1,1) block positive definite
+  for(int i = 0; i < nx; ++i) {
+    a[i * n + i] = nx + 1.;
+  }
+}
+
+static double rel_residual(hiopMatrixDense& A, const hiopVector& x, const hiopVector& b)
+{
+  hiopVectorPar r(b.get_size());
+  r.copyFrom(b);
+  A.timesVec(1., r, -1., x);
+  return r.infnorm() / (A.max_abs_value() * x.infnorm() + b.infnorm());
+}
+
+/**
+ * Checks that hiopLinSolverSymDenseLDLT computes the same inertia as hiopLinSolverSymDenseLapack and
+ * accurate solutions, with one and with multiple right-hand sides, and compares the factorization and
+ * solve times of the two solvers on KKT matrices of the given sizes.
+ *
+ * Usage: test_dense_ldlt [size1 size2 ...]
+ */
+int main(int argc, char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  std::vector<int> sizes;
+  for(int i = 1; i < argc; ++i) {
+    const int n = std::atoi(argv[i]);
+    if(n > 1) {
+      sizes.push_back(n);
+    }
+  }
+  if(sizes.empty()) {
+    sizes = {500, 2000};
+  }
+  const int nrhs = 8;
+  const int n_facts = 3;
+
+  int fail = 0;
+  {
+    DummyNlp nlp_interface;
+    hiopNlpDenseConstraints nlp(nlp_interface);
+
+    printf("%7s %7s | %23s | %23s | %17s\n", "n", "m", "fact (s): lapack  ldlt", "solve (s): lapack ldlt", "multi-rhs (s)");
+    for(int n : sizes) {
+      const int m = n / 4;
+      const int nx = n - m;
+      std::mt19937 gen(n);
+      std::uniform_real_distribution<double> unif(-1., 1.);
+
+      hiopMatrixDenseRowMajor A(n, n);
+      fill_kkt(A, nx, m, gen);
+
+      hiopVectorPar b(n);
+      for(int i = 0; i < n; ++i) {
+        b.local_data()[i] = unif(gen);
+      }
+      hiopMatrixDenseRowMajor B(nrhs, n);
+      for(int i = 0; i < nrhs * n; ++i) {
+        B.local_data()[i] = unif(gen);
+      }
+
+      hiopLinSolverSymDenseLapack lapack(n, &nlp);
+      hiopLinSolverSymDenseLDLT ldlt(n, &nlp);
+
+      // the first factorization of the LDLT solver includes the workspace query
+      hiopStopwatch tm_fact_lapack, tm_fact_ldlt;
+      int neg_lapack = -2, neg_ldlt = -2;
+      for(int k = 0; k < n_facts; ++k) {
+        lapack.sysMatrix().copyFrom(A);
+        tm_fact_lapack.start();
+        neg_lapack = lapack.matrixChanged();
+        tm_fact_lapack.stop();
+
+        ldlt.sysMatrix().copyFrom(A);
+        tm_fact_ldlt.start();
+        neg_ldlt = ldlt.matrixChanged();
+        tm_fact_ldlt.stop();
+      }
+
+      int num_pos, num_neg, num_null;
+      ldlt.get_inertia(num_pos, num_neg, num_null);
+      if(neg_lapack != m || neg_ldlt != m || num_pos != nx || num_neg != m || num_null != 0) {
+        printf("wrong inertia for n=%d: expected %d negative eigenvalues, lapack %d, ldlt %d (%d, %d, %d)\n",
+               n,
+               m,
+               neg_lapack,
+               neg_ldlt,
+               num_pos,
+               num_neg,
+               num_null);
+        fail++;
+      }
+
+      hiopVectorPar x_lapack(n), x_ldlt(n);
+      x_lapack.copyFrom(b);
+      x_ldlt.copyFrom(b);
+      hiopStopwatch tm_solve_lapack, tm_solve_ldlt;
+      tm_solve_lapack.start();
+      lapack.solve(x_lapack);
+      tm_solve_lapack.stop();
+      tm_solve_ldlt.start();
+      ldlt.solve(x_ldlt);
+      tm_solve_ldlt.stop();
+
+      const double res_lapack = rel_residual(A, x_lapack, b);
+      const double res_ldlt = rel_residual(A, x_ldlt, b);
+      if(!(res_ldlt < 1e-12) || !(res_lapack < 1e-12)) {
+        printf("inaccurate solve for n=%d: relative residual lapack %g, ldlt %g\n", n, res_lapack, res_ldlt);
+        fail++;
+      }
+
+      // multiple right-hand sides in one call vs. one at a time
+      hiopMatrixDenseRowMajor X(nrhs, n);
+      X.copyFrom(B);
+      hiopStopwatch tm_multi;
+      tm_multi.start();
+      if(!ldlt.solve(X)) {
+        printf("multi-rhs solve failed for n=%d\n", n);
+        fail++;
+      }
+      tm_multi.stop();
+      for(int r = 0; r < nrhs; ++r) {
+        hiopVectorPar bcol(n), xcol(n);
+        bcol.copyFrom(B.local_data() + r * n);
+        xcol.copyFrom(X.local_data() + r * n);
+        const double res = rel_residual(A, xcol, bcol);
+        if(!(res < 1e-12)) {
+          printf("inaccurate multi-rhs solve for n=%d, rhs %d: relative residual %g\n", n, r, res);
+          fail++;
+        }
+      }
+
+      printf("%7d %7d | %11.5f %11.5f | %11.5f %11.5f | %8.5f (%d rhs)\n",
+             n,
+             m,
+             tm_fact_lapack.getElapsedTime() / n_facts,
+             tm_fact_ldlt.getElapsedTime() / n_facts,
+             tm_solve_lapack.getElapsedTime(),
+             tm_solve_ldlt.getElapsedTime(),
+             tm_multi.getElapsedTime(),
+             nrhs);
+    }
+  }
+
+  if(fail) {
+    printf("Dense LDLT test failed: %d errors\n", fail);
+  } else {
+    printf("Dense LDLT test passed\n");
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}
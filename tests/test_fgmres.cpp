@@ -0,0 +1,214 @@
+#include "hiopKrylovSolver.hpp"
+#include "hiopLinearOperator.hpp"
+#include "hiopReductionBatch.hpp"
+#include "hiopVectorPar.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace hiop;
+
+/// Nonsymmetric tridiagonal matrix of a 1D convection-diffusion operator with a varying diagonal
+class ConvDiffOpr : public hiopLinearOperator
+{
+public:
+  ConvDiffOpr(size_type n)
+      : diag_(n)
+  {
+    for(size_type i = 0; i < n; i++) {
+      diag_[i] = 2.02 + 1e-2 * (i % 11);
+    }
+  }
+
+  bool times_vec(hiopVector& y, const hiopVector& x)
+  {
+    const double* xd = x.local_data_const();
+    double* yd = y.local_data();
+    const size_type n = static_cast<size_type>(diag_.size());
+    for(size_type i = 0; i < n; i++) {
+      yd[i] = diag_[i] * xd[i] + (i > 0 ? lower_ * xd[i - 1] : 0.) + (i + 1 < n ? upper_ * xd[i + 1] : 0.);
+    }
+    return true;
+  }
+  bool trans_times_vec(hiopVector&, const hiopVector&) { return false; }
+
+  const std::vector<double>& diag() const { return diag_; }
+
+private:
+  std::vector<double> diag_;
+  const double lower_ = -1.4;
+  const double upper_ = -0.6;
+};
+
+/**
+ * Preconditioner made of Jacobi sweeps with the operator. With `vary` the number of sweeps changes at each
+ * application (1, 2, 3, 1, ...), so that the preconditioner is not a fixed linear operator.
+ */
+class JacobiPrecond : public hiopLinearOperator
+{
+public:
+  JacobiPrecond(ConvDiffOpr& A, size_type n, bool vary)
+      : A_(A),
+        Az_(n),
+        vary_(vary),
+        num_applied_(0)
+  {}
+
+  bool times_vec(hiopVector& z, const hiopVector& v)
+  {
+    const int sweeps = vary_ ? 1 + num_applied_ % 3 : 2;
+    const double* vd = v.local_data_const();
+    const std::vector<double>& d = A_.diag();
+    std::vector<double> vcopy(vd, vd + d.size());
+    double* zd = z.local_data();
+    for(size_t i = 0; i < d.size(); i++) {
+      zd[i] = vcopy[i] / d[i];
+    }
+    for(int s = 1; s < sweeps; s++) {
+      A_.times_vec(Az_, z);
+      const double* azd = Az_.local_data_const();
+      for(size_t i = 0; i < d.size(); i++) {
+        zd[i] += (vcopy[i] - azd[i]) / d[i];
+      }
+    }
+    num_applied_++;
+    return true;
+  }
+  bool trans_times_vec(hiopVector&, const hiopVector&) { return false; }
+
+  int num_applied() const { return num_applied_; }
+
+private:
+  ConvDiffOpr& A_;
+  hiopVectorPar Az_;
+  bool vary_;
+  int num_applied_;
+};
+
+/// Relative residual ||b-A*x||/||b||
+static double rel_residual(ConvDiffOpr& A, const hiopVector& b, const hiopVector& x)
+{
+  hiopVector* r = b.alloc_clone();
+  A.times_vec(*r, x);
+  r->axpy(-1.0, b);
+  const double rel = r->twonorm() / b.twonorm();
+  delete r;
+  return rel;
+}
+
+/**
+ * Solves a nonsymmetric system with FGMRES(m) (with a fixed and with a varying preconditioner, and with several
+ * restart lengths) and with BiCGStab, checks the residuals, and compares the number of applications of the
+ * preconditioner. Also checks the batched dot products used by the Gram-Schmidt orthogonalization.
+ *
+ * Usage: test_fgmres [n]
+ */
+int main(int argc, char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+  size_type n = argc > 1 ? std::atoi(argv[1]) : 0;
+  if(n <= 0) {
+    n = 2000;
+  }
+  const double tol = 1e-10;
+  int fail = 0;
+
+  ConvDiffOpr A(n);
+  hiopVectorPar b(n);
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  for(size_type i = 0; i < n; i++) {
+    b.local_data()[i] = unif(gen);
+  }
+
+  printf("%-28s %8s %12s %10s\n", "solver", "iter", "rel resid", "precond");
+  for(int vary = 0; vary < 2; vary++) {
+    for(int restart: {1, 5, 30}) {
+      JacobiPrecond M(A, n, 1 == vary);
+      hiopFGMRESSolver fgmres(n, &A, &M);
+      fgmres.set_restart(restart);
+      fgmres.set_max_num_iter(1000);
+      fgmres.set_tol(tol);
+      hiopVectorPar x(n);
+      x.copyFrom(b);
+      const bool ok = fgmres.solve(&x);
+      const double rel = rel_residual(A, b, x);
+      printf("FGMRES(%3d) %-16s %8.1f %12.3e %10d\n",
+             restart,
+             vary ? "varying precond" : "",
+             fgmres.get_sol_num_iter(),
+             rel,
+             M.num_applied());
+      if(!ok || rel > 2 * tol || M.num_applied() != fgmres.get_sol_num_iter()) {
+        printf("FGMRES(%d) failed: %s", restart, fgmres.get_convergence_info().c_str());
+        fail++;
+      }
+    }
+  }
+  {
+    JacobiPrecond M(A, n, false);
+    hiopBiCGStabSolver bicgstab(n, &A, &M);
+    bicgstab.set_max_num_iter(1000);
+    bicgstab.set_tol(tol);
+    hiopVectorPar x(n);
+    x.copyFrom(b);
+    bicgstab.solve(&x);
+    printf("%-28s %8.1f %12.3e %10d\n", "BiCGStab", bicgstab.get_sol_num_iter(), rel_residual(A, b, x), M.num_applied());
+  }
+
+  // the iteration limit is respected and the best solution so far is returned
+  {
+    JacobiPrecond M(A, n, false);
+    hiopFGMRESSolver fgmres(n, &A, &M);
+    fgmres.set_max_num_iter(3);
+    fgmres.set_tol(tol);
+    hiopVectorPar x(n);
+    x.copyFrom(b);
+    if(fgmres.solve(&x) || fgmres.get_sol_num_iter() != 3 || rel_residual(A, b, x) >= 1.) {
+      printf("FGMRES with 3 iterations: wrong convergence %s", fgmres.get_convergence_info().c_str());
+      fail++;
+    }
+  }
+
+  // batched dot products: vectors reduced in the batch and vectors reduced on their own communicator
+  {
+    std::vector<hiopVectorPar*> vecs;
+    for(int k = 0; k < 5; k++) {
+      vecs.push_back(new hiopVectorPar(n));
+      for(size_type i = 0; i < n; i++) {
+        vecs[k]->local_data()[i] = unif(gen);
+      }
+    }
+    std::vector<const hiopVector*> vptrs(vecs.begin(), vecs.end());
+    for(MPI_Comm comm: {MPI_COMM_SELF, MPI_COMM_WORLD}) {
+      hiopReductionBatch batch(comm);
+      const int first = batch.add_dots(b, 5, vptrs.data());
+      batch.reduce();
+      for(int k = 0; k < 5; k++) {
+        const double expected = b.dotProductWith(*vecs[k]);
+        if(std::fabs(batch.value(first + k) - expected) > 1e-12 * std::fabs(expected) + 1e-14) {
+          printf("batched dot product %d is %.16e instead of %.16e\n", k, batch.value(first + k), expected);
+          fail++;
+        }
+      }
+    }
+    for(auto* v: vecs) {
+      delete v;
+    }
+  }
+
+  if(fail) {
+    printf("FGMRES test failed: %d errors\n", fail);
+  } else {
+    printf("FGMRES test passed\n");
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}
@@ -0,0 +1,146 @@
+#include "hiopFilter.hpp"
+#include "hiopTimer.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <vector>
+
+using namespace hiop;
+
+/**
+ * The list-based filter that `hiopFilter` replaced: all the added pairs are kept (pushed at the front)
+ * and `contains` is a linear scan. Used as reference for the results and the timings.
+ */
+class ListFilter
+{
+public:
+  void initialize(const double& theta_max)
+  {
+    entries_.clear();
+    entries_.push_front(Entry{theta_max, -1e20});
+  }
+  void add(const double& theta, const double& phi) { entries_.push_front(Entry{theta, phi}); }
+  bool contains(const double& theta, const double& phi) const
+  {
+    for(auto& e: entries_) {
+      if(theta >= e.theta && phi >= e.phi) {
+        return true;
+      }
+    }
+    return false;
+  }
+  size_t size() const { return entries_.size(); }
+
+private:
+  struct Entry
+  {
+    double theta, phi;
+  };
+  std::list<Entry> entries_;
+};
+
+/**
+ * Checks that `hiopFilter` accepts and rejects the same pairs as the list-based filter and compares the
+ * time spent by the two in `add` and `contains`.
+ *
+ * The (theta, phi) pairs mimic the ones seen by the line search of a long, hard solve: theta decreases and
+ * phi slowly increases on average, with noise, so that the Pareto front keeps growing while some entries
+ * get dominated. A few trial points are tested for each pair added to the filter.
+ *
+ * Usage: test_filter [number of adds]
+ */
+int main(int argc, char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  int n_adds = 5000;
+  if(argc > 1) {
+    n_adds = std::atoi(argv[1]);
+    if(n_adds <= 0) {
+      n_adds = 5000;
+    }
+  }
+  const int n_trials_per_add = 5;
+  const double theta_max = 1e4;
+
+  // generate the sequence of pairs: `n_trials_per_add` queries followed by one add
+  std::mt19937 gen(12345);
+  std::uniform_real_distribution<double> noise(0.5, 1.5);
+  std::uniform_real_distribution<double> unif(0., 1.);
+
+  const int n_ops = n_adds * (n_trials_per_add + 1);
+  std::vector<double> thetas(n_ops), phis(n_ops);
+  double theta = theta_max / 2;
+  double phi = 1e3;
+  for(int k = 0, op = 0; k < n_adds; ++k) {
+    for(int t = 0; t < n_trials_per_add; ++t, ++op) {
+      thetas[op] = theta * noise(gen);
+      phis[op] = phi + 10. * (unif(gen) - 0.5);
+    }
+    // pair added with the usual margins
+    thetas[op] = 0.99999 * theta * noise(gen);
+    phis[op] = phi - 1e-5 * thetas[op] + 10. * (unif(gen) - 0.5);
+    ++op;
+
+    theta *= 0.999;
+    phi += 0.1;
+  }
+
+  std::vector<char> in_sorted(n_ops, 0), in_list(n_ops, 0);
+
+  hiopFilter filter;
+  hiopStopwatch tm_sorted;
+  tm_sorted.start();
+  filter.initialize(theta_max);
+  for(int op = 0; op < n_ops; ++op) {
+    if((op + 1) % (n_trials_per_add + 1) == 0) {
+      filter.add(thetas[op], phis[op]);
+    } else {
+      in_sorted[op] = filter.contains(thetas[op], phis[op]);
+    }
+  }
+  tm_sorted.stop();
+
+  ListFilter list_filter;
+  hiopStopwatch tm_list;
+  tm_list.start();
+  list_filter.initialize(theta_max);
+  for(int op = 0; op < n_ops; ++op) {
+    if((op + 1) % (n_trials_per_add + 1) == 0) {
+      list_filter.add(thetas[op], phis[op]);
+    } else {
+      in_list[op] = list_filter.contains(thetas[op], phis[op]);
+    }
+  }
+  tm_list.stop();
+
+  int fail = 0;
+  size_t n_rejected = 0;
+  for(int op = 0; op < n_ops; ++op) {
+    if(in_sorted[op] != in_list[op]) {
+      printf("mismatch: (%g, %g) is %s the sorted filter and %s the list filter\n",
+             thetas[op],
+             phis[op],
+             in_sorted[op] ? "in" : "not in",
+             in_list[op] ? "in" : "not in");
+      fail++;
+    }
+    n_rejected += in_list[op];
+  }
+
+  printf("Filter with %d adds and %d queries (%lu rejected)\n", n_adds, n_adds * n_trials_per_add, n_rejected);
+  printf("  sorted Pareto filter: %8.5f s  %6lu entries\n", tm_sorted.getElapsedTime(), filter.size());
+  printf("  list filter:          %8.5f s  %6lu entries\n", tm_list.getElapsedTime(), list_filter.size());
+
+  if(fail) {
+    printf("Filter test failed: %d mismatches\n", fail);
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}
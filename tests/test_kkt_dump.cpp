@@ -0,0 +1,215 @@
+#include "hiopKKTDump.hpp"
+#include "hiopTimer.hpp"
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hiop;
+
+/// Lower triangle triplets with the diagonal entries repeated at the end, as in the sparse KKT matrices
+struct Triplets
+{
+  int n;
+  std::vector<int> irow;
+  std::vector<int> jcol;
+  std::vector<double> vals;
+
+  Triplets(int n_in, int nnz_per_row, std::mt19937& gen)
+      : n(n_in)
+  {
+    std::uniform_int_distribution<int> col_dist(0, n - 1);
+    for(int i = 0; i < n; i++) {
+      for(int k = 0; k < nnz_per_row; k++) {
+        const int j = col_dist(gen) % (i + 1);
+        irow.push_back(i);
+        jcol.push_back(j);
+      }
+    }
+    for(int i = 0; i < n; i++) {
+      irow.push_back(i);
+      jcol.push_back(i);
+    }
+    vals.resize(irow.size());
+  }
+
+  /// Entries of the matrix, with the duplicates summed
+  std::map<std::pair<int, int>, double> entries() const
+  {
+    std::map<std::pair<int, int>, double> e;
+    for(size_t k = 0; k < vals.size(); k++) {
+      e[std::make_pair(irow[k], jcol[k])] += vals[k];
+    }
+    return e;
+  }
+};
+
+static int check_system(const hiopKKTDumpSystem& sys,
+                        int counter,
+                        const std::map<std::pair<int, int>, double>& expected,
+                        const std::vector<double>& rhs,
+                        const std::vector<double>& sol)
+{
+  int fail = 0;
+  std::map<std::pair<int, int>, double> found;
+  for(int64_t i = 0; i < sys.n; i++) {
+    for(int64_t k = sys.row_ptr[i]; k < sys.row_ptr[i + 1]; k++) {
+      found[std::make_pair(static_cast<int>(i), static_cast<int>(sys.col[k]))] = sys.vals[k];
+    }
+  }
+  if(sys.counter != counter || found != expected) {
+    printf("system %d: wrong counter %ld or matrix\n", counter, static_cast<long>(sys.counter));
+    fail++;
+  }
+  if(sys.rhs.size() != 1 || sys.sol.size() != 1 || sys.rhs[0] != rhs || sys.sol[0] != sol) {
+    printf("system %d: wrong rhs or solution\n", counter);
+    fail++;
+  }
+  return fail;
+}
+
+/**
+ * Writes sequences of sparse (with a change of the sparsity pattern) and dense KKT systems with the binary KKT
+ * dump writer, uncompressed and compressed, reads them back, and checks that they are identical. Reports the
+ * time spent by the calling thread and the size of the files.
+ *
+ * Usage: test_kkt_dump [directory for the dump files]
+ */
+int main(int argc, char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+  const std::string dir = argc > 1 ? std::string(argv[1]) + "/" : std::string("");
+  const int n = 20000;
+  const int n_dense = 300;
+  const int n_iter = 6;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+
+  int fail = 0;
+  for(int compress = 0; compress < 2; compress++) {
+    const std::string path = dir + (compress ? "hiop_test_kkt_dump_z.hkkt" : "hiop_test_kkt_dump.hkkt");
+
+    Triplets trip1(n, 4, gen), trip2(n, 5, gen);
+    std::vector<double> dense(n_dense * n_dense);
+    std::vector<std::map<std::pair<int, int>, double>> expected;
+    std::vector<std::vector<double>> rhs, sol;
+
+    hiopStopwatch tm_caller;
+    {
+      hiopKKTDumpWriter writer(path, 1 == compress);
+      for(int it = 0; it < 2 * n_iter; it++) {
+        if(it < n_iter) {
+          // the pattern changes midway; half of the values do not change between iterations
+          Triplets& trip = it < n_iter / 2 ? trip1 : trip2;
+          for(size_t k = 0; k < trip.vals.size(); k++) {
+            if(0 == it || k % 2) {
+              trip.vals[k] = unif(gen);
+            }
+          }
+          expected.push_back(trip.entries());
+          rhs.emplace_back(n);
+          sol.emplace_back(n);
+          tm_caller.start();
+          writer.write_matrix_triplet(it,
+                                      n,
+                                      n / 2,
+                                      n / 4,
+                                      n / 4,
+                                      static_cast<int>(trip.vals.size()),
+                                      trip.irow.data(),
+                                      trip.jcol.data(),
+                                      trip.vals.data());
+          tm_caller.stop();
+        } else {
+          std::map<std::pair<int, int>, double> e;
+          for(int i = 0; i < n_dense; i++) {
+            for(int j = 0; j < n_dense; j++) {
+              dense[i * n_dense + j] = unif(gen);
+              if(j >= i) {
+                e[std::make_pair(i, j)] = dense[i * n_dense + j];
+              }
+            }
+          }
+          expected.push_back(e);
+          rhs.emplace_back(n_dense);
+          sol.emplace_back(n_dense);
+          tm_caller.start();
+          writer.write_matrix_dense(it, n_dense, n_dense / 2, n_dense / 4, n_dense / 4, dense.data());
+          tm_caller.stop();
+        }
+        for(size_t i = 0; i < rhs.back().size(); i++) {
+          rhs.back()[i] = unif(gen);
+          sol.back()[i] = unif(gen);
+        }
+        tm_caller.start();
+        writer.write_rhs(it, static_cast<int>(rhs.back().size()), rhs.back().data());
+        writer.write_sol(it, static_cast<int>(sol.back().size()), sol.back().data());
+        tm_caller.stop();
+      }
+      std::string errors;
+      if(!writer.wait(errors)) {
+        printf("write failed: %s", errors.c_str());
+        fail++;
+      }
+    }
+
+    hiopKKTDumpReader reader;
+    hiopKKTDumpSystem sys;
+    std::string error;
+    int num_read = 0;
+    if(reader.open(path, error)) {
+      while(reader.read_next(sys, error)) {
+        if(num_read < 2 * n_iter) {
+          fail += check_system(sys, num_read, expected[num_read], rhs[num_read], sol[num_read]);
+        }
+        if(sys.triangle != (num_read < n_iter ? 'L' : 'U')) {
+          printf("system %d: wrong triangle '%c'\n", num_read, sys.triangle);
+          fail++;
+        }
+        num_read++;
+      }
+    }
+    if(!error.empty() || num_read != 2 * n_iter) {
+      printf("read %d systems instead of %d: %s\n", num_read, 2 * n_iter, error.c_str());
+      fail++;
+    }
+
+    FILE* f = fopen(path.c_str(), "rb");
+    long size = 0;
+    if(f) {
+      fseek(f, 0, SEEK_END);
+      size = ftell(f);
+      fclose(f);
+    }
+    printf("%s: %.1f MB, %.2f ms per system on the calling thread\n",
+           compress ? "compressed  " : "uncompressed",
+           size / (1024. * 1024.),
+           1e3 * tm_caller.getElapsedTime() / (2 * n_iter));
+    std::remove(path.c_str());
+  }
+
+  // the reader rejects files that are not KKT dumps
+  {
+    hiopKKTDumpReader reader;
+    std::string error;
+    if(reader.open(argv[0], error) || error.empty()) {
+      printf("the reader accepted a file that is not a KKT dump\n");
+      fail++;
+    }
+  }
+
+  if(fail) {
+    printf("KKT dump test failed: %d errors\n", fail);
+  } else {
+    printf("KKT dump test passed\n");
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}
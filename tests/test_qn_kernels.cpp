@@ -0,0 +1,155 @@
+#include "HessianDiagPlusRowRank.hpp"
+#include "hiopMatrixDenseRowMajor.hpp"
+#include "hiopVectorPar.hpp"
+#include "hiopTimer.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace hiop;
+
+/// Reference triple loop for W = S*Diag*X^T, with W of row stride k
+static void reference_product(int l, int k, int n, const double* S, const double* d, const double* X, double* W)
+{
+  for(int i = 0; i < l; i++) {
+    for(int j = 0; j < k; j++) {
+      double acc = 0.;
+      for(int p = 0; p < n; p++) {
+        acc += S[i * n + p] * d[p] * X[j * n + p];
+      }
+      W[i * k + j] = acc;
+    }
+  }
+}
+
+static double max_rel_diff(const double* a, const double* b, size_t len)
+{
+  double diff = 0., nrm = 0.;
+  for(size_t e = 0; e < len; e++) {
+    diff = std::fmax(diff, std::fabs(a[e] - b[e]));
+    nrm = std::fmax(nrm, std::fabs(b[e]));
+  }
+  return diff / std::fmax(nrm, 1e-300);
+}
+
+/**
+ * Checks the blocked products X*Diag*X^T and S*Diag*X^T of the quasi-Newton Hessian (where X is the 2l x n matrix
+ * [S;Y] of the secant pairs, as in the compact representation) against a reference triple loop, and reports
+ * their timings for memory lengths l and numbers of variables n.
+ *
+ * Usage: test_qn_kernels [n1 n2 ...]
+ */
+int main(int argc, char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+  std::vector<int> sizes;
+  for(int i = 1; i < argc; ++i) {
+    const int n = std::atoi(argv[i]);
+    if(n > 0) {
+      sizes.push_back(n);
+    }
+  }
+  if(sizes.empty()) {
+    sizes = {10000, 200000};
+  }
+  const std::vector<int> mem_lengths = {5, 10, 20};
+  const int reps = 3;
+
+  int fail = 0;
+  printf("%9s %4s | %21s | %21s\n", "n", "l", "XDX^T (ms): ref  new", "SDX^T (ms): ref  new");
+  for(int n : sizes) {
+    for(int l : mem_lengths) {
+      const int k = 2 * l;
+      std::mt19937 gen(n + l);
+      std::uniform_real_distribution<double> unif(-1., 1.);
+      hiopMatrixDenseRowMajor X(k, n), S(l, n), W(k, k), WS(l, k);
+      hiopVectorPar d(n);
+      double* Xd = X.local_data();
+      double* Sd = S.local_data();
+      double* dd = d.local_data();
+      for(int p = 0; p < n; p++) {
+        dd[p] = 1. + unif(gen) * 0.5;
+        for(int i = 0; i < k; i++) {
+          Xd[i * n + p] = unif(gen);
+        }
+        for(int i = 0; i < l; i++) {
+          Sd[i * n + p] = unif(gen);
+        }
+      }
+
+      std::vector<double> ref_sym(k * k), ref(l * k);
+      hiopStopwatch tm_ref_sym, tm_sym, tm_ref, tm;
+      for(int r = 0; r < reps; r++) {
+        tm_ref_sym.start();
+        reference_product(k, k, n, Xd, dd, Xd, ref_sym.data());
+        tm_ref_sym.stop();
+        W.setToZero();
+        tm_sym.start();
+        HessianDiagPlusRowRank::sym_mat_times_diag_times_mattrans_local(0., W, 1., X, d);
+        tm_sym.stop();
+
+        tm_ref.start();
+        reference_product(l, k, n, Sd, dd, Xd, ref.data());
+        tm_ref.stop();
+        tm.start();
+        HessianDiagPlusRowRank::mat_times_diag_times_mattrans_local(WS, S, d, X);
+        tm.stop();
+      }
+
+      const double* Wd = W.local_data_const();
+      bool symmetric = true;
+      for(int i = 0; i < k; i++) {
+        for(int j = 0; j < i; j++) {
+          symmetric = symmetric && Wd[i * k + j] == Wd[j * k + i];
+        }
+      }
+      const double err_sym = max_rel_diff(Wd, ref_sym.data(), ref_sym.size());
+      const double err = max_rel_diff(WS.local_data_const(), ref.data(), ref.size());
+      if(err_sym > 1e-12 || err > 1e-12 || !symmetric) {
+        printf("n=%d l=%d: relative errors %.2e and %.2e, symmetric %d\n", n, l, err_sym, err, symmetric);
+        fail++;
+      }
+      printf("%9d %4d | %10.2f %10.2f | %10.2f %10.2f\n",
+             n,
+             l,
+             1e3 * tm_ref_sym.getElapsedTime() / reps,
+             1e3 * tm_sym.getElapsedTime() / reps,
+             1e3 * tm_ref.getElapsedTime() / reps,
+             1e3 * tm.getElapsedTime() / reps);
+    }
+  }
+
+  // beta and alpha of the symmetric product
+  {
+    const int n = 1000, k = 6;
+    hiopMatrixDenseRowMajor X(k, n), W(k, k);
+    hiopVectorPar d(n);
+    X.setToConstant(1.);
+    d.setToConstant(2.);
+    W.setToConstant(3.);
+    HessianDiagPlusRowRank::sym_mat_times_diag_times_mattrans_local(0.5, W, -1., X, d);
+    const double* Wd = W.local_data_const();
+    for(int e = 0; e < k * k; e++) {
+      if(Wd[e] != 1.5 - 2. * n) {
+        printf("W=beta*W+alpha*XDX^T: entry %d is %g instead of %g\n", e, Wd[e], 1.5 - 2. * n);
+        fail++;
+        break;
+      }
+    }
+  }
+
+  if(fail) {
+    printf("Quasi-Newton kernels test failed: %d errors\n", fail);
+  } else {
+    printf("Quasi-Newton kernels test passed\n");
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}
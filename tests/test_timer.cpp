@@ -0,0 +1,131 @@
+#include "hiopTimer.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace hiop;
+
+/// Busy-waits for `sec` seconds (sleeping would not exercise the per-thread accumulation)
+static void busy_wait(double sec)
+{
+  const double t0 = hiopTimer::wall_time();
+  while(hiopTimer::wall_time() - t0 < sec) {
+  }
+}
+
+/// Recursion with a scope guard of the same timer at each level
+static void recurse(hiopTimer& timer, int depth)
+{
+  hiopTimerScope scope(timer);
+  busy_wait(0.001);
+  if(depth > 1) {
+    recurse(timer, depth - 1);
+  }
+}
+
+/**
+ * Checks the monotonic clock, the accumulation of hiopTimer, the nesting of hiopTimerScope, and the
+ * per-thread accumulation of hiopTimerPerThread, and measures the overhead of a start/stop pair.
+ */
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+  int fail = 0;
+
+  // the clock never goes back
+  double t_prev = hiopTimer::wall_time();
+  for(int k = 0; k < 100000; ++k) {
+    const double t = hiopTimer::wall_time();
+    if(t < t_prev) {
+      printf("clock went back by %g s\n", t_prev - t);
+      fail++;
+      break;
+    }
+    t_prev = t;
+  }
+
+#ifdef HIOP_WITH_TIMERS
+  hiopTimer timer;
+  timer.start();
+  busy_wait(0.01);
+  timer.stop();
+  timer.start();
+  busy_wait(0.01);
+  timer.stop();
+  if(timer.getElapsedTime() < 0.02 || timer.getElapsedTime() > 1.) {
+    printf("wrong accumulated time %g s (expected about 0.02 s)\n", timer.getElapsedTime());
+    fail++;
+  }
+
+  // nested scopes count once: 5 levels with 1ms each
+  hiopTimer tm_rec;
+  const double t0 = hiopTimer::wall_time();
+  recurse(tm_rec, 5);
+  const double t_wall = hiopTimer::wall_time() - t0;
+  if(tm_rec.getElapsedTime() < 0.005 || tm_rec.getElapsedTime() > t_wall) {
+    printf("wrong time %g s of nested scopes (wall time %g s)\n", tm_rec.getElapsedTime(), t_wall);
+    fail++;
+  }
+
+  // early exit from a guarded scope
+  hiopTimer tm_early;
+  for(int k = 0; k < 3; ++k) {
+    hiopTimerScope scope(tm_early);
+    busy_wait(0.001);
+    if(k == 1) {
+      break;
+    }
+  }
+  if(tm_early.getElapsedTime() < 0.002 || tm_early.getElapsedTime() > 1.) {
+    printf("wrong time %g s of scopes left early\n", tm_early.getElapsedTime());
+    fail++;
+  }
+
+  // per-thread accumulation: thread t works (t+1) ms
+  const int num_threads = omp::get_num_threads() < 4 ? omp::get_num_threads() : 4;
+  hiopTimerPerThread tm_threads(num_threads);
+#ifdef HIOP_USE_OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(num_threads)
+#endif
+  for(int t = 0; t < num_threads; ++t) {
+    hiopTimerPerThread::Scope scope(tm_threads);
+    busy_wait(0.001 * (t + 1));
+  }
+  double expected_total = 0.;
+  for(int t = 0; t < num_threads; ++t) {
+    expected_total += 0.001 * (t + 1);
+    if(tm_threads.get_elapsed_time(t) < 0.001 * (t + 1)) {
+      printf("thread %d accumulated %g s instead of %g s\n", t, tm_threads.get_elapsed_time(t), 0.001 * (t + 1));
+      fail++;
+    }
+  }
+  if(tm_threads.get_total_time() < expected_total || tm_threads.get_max_time() < 0.001 * num_threads) {
+    printf("wrong per-thread totals: sum %g s, max %g s\n", tm_threads.get_total_time(), tm_threads.get_max_time());
+    fail++;
+  }
+#endif
+
+  // overhead of a start/stop pair
+  const int n_pairs = 1000000;
+  hiopStopwatch tm_overhead;
+  hiopTimer tm_pairs;
+  tm_overhead.start();
+  for(int k = 0; k < n_pairs; ++k) {
+    tm_pairs.start();
+    tm_pairs.stop();
+  }
+  tm_overhead.stop();
+  printf("timer start/stop overhead: %.1f ns per pair\n", 1e9 * tm_overhead.getElapsedTime() / n_pairs);
+
+  if(fail) {
+    printf("Timer test failed: %d errors\n", fail);
+  } else {
+    printf("Timer test passed\n");
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+#include "hiopTrace.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace hiop;
+
+/**
+ * Records events with timers and spans on each rank, writes the trace, and checks (on rank 0) that the CSV
+ * file has one line per event of every rank and that the Chrome trace file is a closed JSON array.
+ *
+ * Usage: test_trace [directory for the trace files]
+ */
+int main(int argc, char** argv)
+{
+  int rank = 0, num_ranks = 1;
+#ifdef HIOP_USE_MPI
+  MPI_Init(&argc, &argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+  std::string path = argc > 1 ? std::string(argv[1]) + "/hiop_test_trace" : std::string("hiop_test_trace");
+
+  int fail = 0;
+  hiopTrace trace;
+  hiopTimer tm_eval, tm_fact;
+  tm_eval.trace_as(&trace, "eval_f");
+  tm_fact.trace_as(&trace, "factorization");
+
+  // not recorded: the trace is not started
+  tm_eval.start();
+  tm_eval.stop();
+
+  trace.start(MPI_COMM_WORLD);
+  const size_t n_iter = 5;
+  for(size_t it = 0; it < n_iter; ++it) {
+    trace.set_iteration(static_cast<int>(it));
+    hiopTraceSpan span(trace, "iteration");
+    tm_eval.start();
+    tm_eval.stop();
+    // two factorizations, as after an inertia correction
+    for(int k = 0; k < 2; ++k) {
+      tm_fact.start();
+      tm_fact.stop();
+    }
+  }
+  trace.stop();
+
+  // not recorded: the trace is stopped
+  tm_fact.start();
+  tm_fact.stop();
+
+  const size_t n_events = 4 * n_iter;
+  if(trace.num_events() != n_events) {
+    printf("rank %d recorded %lu events instead of %lu\n", rank, trace.num_events(), n_events);
+    fail++;
+  }
+
+  std::string errors;
+  if(!trace.write(path, errors)) {
+    printf("trace write failed: %s", errors.c_str());
+    fail++;
+  }
+
+  if(0 == rank && 0 == fail) {
+    std::ifstream csv(path + ".csv");
+    std::string line;
+    size_t n_lines = 0, n_fact = 0;
+    std::getline(csv, line);
+    if(line != "rank,iter,phase,start_us,duration_us") {
+      printf("wrong CSV header '%s'\n", line.c_str());
+      fail++;
+    }
+    while(std::getline(csv, line)) {
+      n_lines++;
+      if(line.find(",factorization,") != std::string::npos) {
+        n_fact++;
+      }
+    }
+    if(n_lines != num_ranks * n_events || n_fact != num_ranks * 2 * n_iter) {
+      printf("wrong number of events in the CSV trace: %lu (%lu factorizations)\n", n_lines, n_fact);
+      fail++;
+    }
+
+    std::ifstream json(path + ".json");
+    std::stringstream ss;
+    ss << json.rdbuf();
+    const std::string str = ss.str();
+    size_t n_json = 0;
+    for(size_t pos = str.find("\"ph\":\"X\""); pos != std::string::npos; pos = str.find("\"ph\":\"X\"", pos + 1)) {
+      n_json++;
+    }
+    if(n_json != num_ranks * n_events || str.find("{\"displayTimeUnit\"") != 0 || str.rfind("]}\n") + 3 != str.size()) {
+      printf("malformed Chrome trace (%lu events)\n", n_json);
+      fail++;
+    }
+    std::remove((path + ".csv").c_str());
+    std::remove((path + ".json").c_str());
+  }
+
+#ifdef HIOP_USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &fail, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if(0 == rank) {
+    if(fail) {
+      printf("Trace test failed: %d errors\n", fail);
+    } else {
+      printf("Trace test passed\n");
+    }
+  }
+#ifdef HIOP_USE_MPI
+  MPI_Finalize();
+#endif
+  return fail ? 1 : 0;
+}